@@ -158,15 +158,17 @@ struct PACK Gdtr {
 struct alignas(16) PACK GDT {
     static constexpr u16 kKernelCodeSelector = 0x08;
     static constexpr u16 kKernelDataSelector = 0x10;
-    static constexpr u16 kUserCodeSelector   = 0x1B;
-    static constexpr u16 kUserDataSelector   = 0x23;
+    static constexpr u16 kUserDataSelector   = 0x1B;
+    static constexpr u16 kUserCodeSelector   = 0x23;
     static constexpr u16 kTssSelector        = 0x28;
 
     GdtEntry<> null_entry;
     GdtEntry<> kernel_code;
     GdtEntry<> kernel_data;
-    GdtEntry<> user_code;
+    /* SYSRET loads SS from STAR[63:48] + 8 and CS from STAR[63:48] + 16, so user data must
+     * directly precede user code */
     GdtEntry<> user_data;
+    GdtEntry<> user_code;
     GdtSystemSegmentDescriptor tss_descriptor;
 };
 
@@ -10,6 +10,13 @@
 
 namespace cpu
 {
+/* Interrupt Stack Table slots, an IDT entry with IST 0 keeps the interrupted stack */
+static constexpr u8 kIstNmi           = 1;
+static constexpr u8 kIstDoubleFault   = 2;
+static constexpr u8 kIstMachineCheck  = 3;
+static constexpr size_t kIstStacks    = 3;
+static constexpr size_t kIstStackSize = 16 * 1024;
+
 struct PACK TSS {
     u32 reserved0;
     u64 rsp0;
@@ -31,6 +31,7 @@ static constexpr byte kReceivedBit = 1; /* Indicates data has been received */
 static constexpr byte kDlabBit =
     0x80; /* Divisor Latch Access Bit - controls access to baud rate divisor */
 static constexpr byte kLineEmpty = 0x20; /* Indicates transmit buffer is empty */
+static constexpr size_t kTransmitFifoSize = 16; /* 16550 transmit FIFO depth */
 
 // ------------------------------
 // Local Helper Functions
@@ -128,7 +129,7 @@ void QemuTerminalInit()
     outb(kLineControlReg, kLineControlConfFlags);
 
     /* Initialize FIFO with configuration */
-    outb(kFifoConfFlags, kFifoConfFlags);
+    outb(kWriteFifoControlReg, kFifoConfFlags);
 
     /* -------------------------------------------------------------- */
     /* Verify port configuration using loopback test */
@@ -179,6 +180,29 @@ void QemuTerminalWriteString(const char *s)
     }
 }
 
+/**
+ * @brief Send a buffer through the serial port
+ *
+ * @param buffer Bytes to transmit, zeros included
+ * @param size Number of bytes to transmit
+ *
+ * Waits for the transmit FIFO to drain once per FIFO sized block instead of once per
+ * character, then pushes the whole block with a single string I/O instruction.
+ */
+void QemuTerminalWrite(const char *buffer, size_t size)
+{
+    while (size > 0) {
+        while (!IsLineEmpty()) {
+        }
+
+        const size_t block = size < kTransmitFifoSize ? size : kTransmitFifoSize;
+        outsb(kCom1Port, buffer, block);
+
+        buffer += block;
+        size -= block;
+    }
+}
+
 /**
  * @brief Receive a single character from the serial port
  *
@@ -20,6 +20,7 @@ extern "C" {
 void QemuTerminalInit();
 void QemuTerminalPutChar(char c);
 void QemuTerminalWriteString(const char *s);
+void QemuTerminalWrite(const char *buffer, size_t size);
 char QemuTerminalGetChar();
 size_t QemuTerminalReadLine(char *buffer, size_t size);
 }
@@ -4,11 +4,13 @@
 
 #include <hal/core.hpp>
 
+#include "cpu/control_registers.hpp"
 #include "cpu/gdt.hpp"
 #include "hardware/core_local.hpp"
 #include "trace_framework.hpp"
 
 extern "C" void GdtFlush(cpu::Gdtr *gdtr, u64 kernel_code_offset, u64 kernel_data_offset);
+extern "C" void SyscallEntry();
 
 namespace arch
 {
@@ -22,6 +24,11 @@ void InitializeCoreLocal()
     auto *core_local = static_cast<hardware::CoreLocal *>(hardware::GetCoreLocalSelf());
     ASSERT_NOT_NULL(core_local);
 
+    for (size_t ist = 0; ist < cpu::kIstStacks; ++ist) {
+        core_local->tss.ist[ist] =
+            reinterpret_cast<u64>(core_local->ist_stacks[ist]) + cpu::kIstStackSize;
+    }
+
     cpu::DefaultGdtInit(core_local->gdt, reinterpret_cast<u64>(&core_local->tss));
     core_local->gdtr.limit = sizeof(cpu::GDT) - 1;
     core_local->gdtr.base  = reinterpret_cast<u64>(&core_local->gdt);
@@ -30,8 +37,57 @@ void InitializeCoreLocal()
     SetCoreLocalData(core_local);
     cpu::LoadTss(cpu::GDT::kTssSelector);
 
+    InitializeSyscallMsrs();
+    InitializePat();
+    EnableWriteProtect();
+
     DEBUG_INFO_HARDWARE(
         "Successfully initialized GDT and TSS for core with id %hu", core_local->lid
     );
 }
+
+void InitializeSyscallMsrs()
+{
+    /* Flags cleared on entry: IF keeps the stub atomic until it is on the kernel stack */
+    static constexpr u64 kRFlagsTF = 1 << 8;
+    static constexpr u64 kRFlagsIF = 1 << 9;
+    static constexpr u64 kRFlagsDF = 1 << 10;
+    static constexpr u64 kRFlagsAC = 1 << 18;
+
+    /* SYSCALL loads CS/SS from STAR[47:32], SYSRET loads SS/CS from STAR[63:48] + 8/16 */
+    static constexpr u64 kSysretBase  = cpu::GDT::kKernelDataSelector;
+    static constexpr u64 kSyscallBase = cpu::GDT::kKernelCodeSelector;
+    static_assert((kSysretBase | 3) + 8 == cpu::GDT::kUserDataSelector);
+    static_assert((kSysretBase | 3) + 16 == cpu::GDT::kUserCodeSelector);
+    static_assert(kSyscallBase + 8 == cpu::GDT::kKernelDataSelector);
+
+    cpu::SetMSR(kIa32Star, (kSysretBase << 48) | (kSyscallBase << 32));
+    cpu::SetMSR(kIa32LStar, reinterpret_cast<u64>(SyscallEntry));
+    cpu::SetMSR(kIa32FMask, kRFlagsTF | kRFlagsIF | kRFlagsDF | kRFlagsAC);
+    cpu::SetMSR(kIa32Efer, cpu::GetMSR(kIa32Efer) | kEferSyscallEnable);
+}
+
+void InitializePat()
+{
+    /* Memory type encodings, every x86_64 processor implements the PAT */
+    static constexpr u64 kUncacheable    = 0x00;
+    static constexpr u64 kWriteCombining = 0x01;
+    static constexpr u64 kWriteThrough   = 0x04;
+    static constexpr u64 kWriteBack      = 0x06;
+    static constexpr u64 kUncachedMinus  = 0x07;
+
+    /* Entry index is PAT:PCD:PWT. Nothing maps entry 4 before this runs, so no flush is needed */
+    static constexpr u64 kPat = kWriteBack | kWriteThrough << 8 | kUncachedMinus << 16 |
+                                kUncacheable << 24 | kWriteCombining << 32 | kWriteThrough << 40 |
+                                kUncachedMinus << 48 | kUncacheable << 56;
+
+    cpu::SetMSR(kIa32Pat, kPat);
+}
+
+void EnableWriteProtect()
+{
+    auto cr0         = cpu::GetCR<cpu::Cr0>();
+    cr0.WriteProtect = true;
+    cpu::SetCR(cr0);
+}
 }  // namespace arch
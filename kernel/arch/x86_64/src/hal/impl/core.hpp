@@ -20,6 +20,13 @@ namespace arch
 static constexpr u32 kIa32FsBase       = 0xC0000100;
 static constexpr u32 kIa32GsBase       = 0xC0000101;
 static constexpr u32 kIa32GsKernelBase = 0xC0000102;
+static constexpr u32 kIa32Efer         = 0xC0000080;
+static constexpr u32 kIa32Star         = 0xC0000081;
+static constexpr u32 kIa32LStar        = 0xC0000082;
+static constexpr u32 kIa32FMask        = 0xC0000084;
+static constexpr u32 kIa32Pat          = 0x277;
+
+static constexpr u64 kEferSyscallEnable = 1 << 0;
 
 struct CoreConfig {
     u16 acpi_id;
@@ -83,11 +90,25 @@ class CoreController : public CoreControllerAPI
 
 struct CoreLocal {
     void *self;
+
+    /* Accessed from the SYSCALL entry stub, keep offsets in sync with interrupts/syscall.nasm */
+    u64 syscall_stack;     ///< Kernel stack loaded on SYSCALL, mirrors tss.rsp0
+    u64 syscall_user_rsp;  ///< Scratch slot for the user stack pointer on SYSCALL
+
     cpu::GDT gdt;
     cpu::Gdtr gdtr;
     cpu::TSS tss;
+
+    /// NMI, #DF and #MC may hit before SYSCALL leaves the user stack, they always switch to these
+    alignas(16) u8 ist_stacks[cpu::kIstStacks][cpu::kIstStackSize];
 };
 
+static constexpr size_t kCoreLocalSyscallStackOffset   = 8;
+static constexpr size_t kCoreLocalSyscallUserRspOffset = 16;
+
+static_assert(offsetof(CoreLocal, syscall_stack) == kCoreLocalSyscallStackOffset);
+static_assert(offsetof(CoreLocal, syscall_user_rsp) == kCoreLocalSyscallUserRspOffset);
+
 // ------------------------------
 // Helpers
 // ------------------------------
@@ -149,6 +170,24 @@ FAST_CALL void SetCoreLocalField(T value)
 
 void InitializeCoreLocal();
 
+/**
+ * @brief Enable the SYSCALL/SYSRET instructions on the calling core and point them at the
+ * kernel entry stub. Requires the GDT layout from cpu::DefaultGdtInit.
+ */
+void InitializeSyscallMsrs();
+
+/**
+ * @brief Program the PAT of the calling core. Entries 0-3 keep their power-on memory types, so
+ * the PWT and PCD page bits mean what they always did, entry 4 becomes write-combining.
+ */
+void InitializePat();
+
+/**
+ * @brief Set CR0.WP on the calling core, so that kernel writes to read-only user pages fault
+ * like user writes do. Copy-on-write pages are then broken before the kernel writes them too.
+ */
+void EnableWriteProtect();
+
 }  // namespace arch
 
 #endif  // KERNEL_ARCH_X86_64_SRC_HAL_IMPL_CORE_HPP_
@@ -21,6 +21,14 @@ WRAP_CALL void DebugTerminalWrite(const char *const buffer)
     QemuTerminalWriteString(buffer);
 }
 
+WRAP_CALL void DebugTerminalWrite(const char *const buffer, const size_t size)
+{
+    /* verify if the usage is permitted */
+    ASSERT_TRUE(FeatureEnabled<FeatureFlag::kDebugOutput>);
+
+    QemuTerminalWrite(buffer, size);
+}
+
 WRAP_CALL void DebugTerminalPutChar(const char c)
 {
     /* verify if the usage is permitted */
@@ -5,6 +5,7 @@
 #include "hal/impl/mmu.hpp"
 
 #include <string.h>
+#include <bits_ext.hpp>
 #include <internal/macros.hpp>
 
 #include "cpu/control_registers.hpp"
@@ -27,11 +28,16 @@ u64 Mmu::ToArchFlags(PageFlags flags)
     if (flags.UserAccessible) {
         arch_flags |= kUserAccessibleBit;
     }
-    if (flags.WriteThrough) {
-        arch_flags |= kWriteThroughCachingBit;
-    }
-    if (flags.CacheDisable) {
-        arch_flags |= kDisableCacheBit;
+    if (flags.WriteCombining) {
+        // PAT entry 4, see InitializePat()
+        arch_flags |= kPageTablePatBit;
+    } else {
+        if (flags.WriteThrough) {
+            arch_flags |= kWriteThroughCachingBit;
+        }
+        if (flags.CacheDisable) {
+            arch_flags |= kDisableCacheBit;
+        }
     }
     if (flags.Global) {
         arch_flags |= kGlobalBit;
@@ -118,4 +124,15 @@ expected<void, MemError> Mmu::SetPageFlags(
     return {};
 }
 
+void Mmu::FlushCacheLines(Mem::VPtr<void> start, size_t size)
+{
+    // CLFLUSH evicts the line from every cache of the coherence domain, whatever the memory type
+    const uptr end = Mem::PtrToUptr(start) + size;
+    for (uptr line = AlignDown(Mem::PtrToUptr(start), kCacheLineSizeBytes); line < end;
+         line += kCacheLineSizeBytes) {
+        asm volatile("clflush (%0)" ::"r"(line) : "memory");
+    }
+    asm volatile("mfence" ::: "memory");
+}
+
 }  // namespace arch
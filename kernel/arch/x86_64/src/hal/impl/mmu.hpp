@@ -39,6 +39,13 @@ class Mmu : public MmuAPI
         Mem::PPtr<void> root, Mem::VPtr<void> vaddr, PageFlags flags
     );
 
+    template <MmuContext Context>
+    expected<void, Mem::MemError> SplitHugePages(
+        Context &ctx, Mem::PPtr<void> root, Mem::VPtr<void> vaddr
+    );
+
+    void FlushCacheLines(Mem::VPtr<void> start, size_t size);
+
     void SwitchRoot(Mem::PPtr<void> root);
 
     void CopyKernelSpace(Mem::PPtr<void> dst_root, Mem::PPtr<void> kernel_root);
@@ -48,6 +55,11 @@ class Mmu : public MmuAPI
     template <TableVisitor Visitor>
     void VisitTables(Mem::PPtr<void> root, Visitor visitor);
 
+    template <PageVisitor Visitor>
+    void VisitMappedPages(
+        Mem::PPtr<void> root, Mem::VPtr<void> start, size_t size, Visitor visitor
+    );
+
     /**
      * @brief Recursively destroys a page table tree.
      * Used for cleanup operations (e.g. destroying an address space or cleaning lower half).
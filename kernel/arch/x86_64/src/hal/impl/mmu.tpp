@@ -5,6 +5,7 @@
 #ifndef KERNEL_ARCH_X86_64_SRC_HAL_IMPL_MMU_TPP_
 #define KERNEL_ARCH_X86_64_SRC_HAL_IMPL_MMU_TPP_
 
+#include "hal/impl/constants.hpp"
 #include "hal/impl/mmu.hpp"
 #include "internal/macros.hpp"
 #include "mem/page_map.hpp"
@@ -210,6 +211,77 @@ expected<Mem::PPtr<void>, Mem::MemError> Mmu::Translate(
     return pte.GetFrameAddress() + (Mem::PtrToUptr(vaddr) & kBitMaskRight<u64, 12>);
 }
 
+template <MmuContext Context>
+expected<void, Mem::MemError> Mmu::SplitHugePages(
+    Context &ctx, Mem::PPtr<void> root, Mem::VPtr<void> vaddr
+)
+{
+    static constexpr u64 kDefTableFlags = kPresentBit | kWriteBit | kUserAccessibleBit;
+
+    // Attributes the smaller pages inherit, the PAT bit of huge pages is handled separately
+    static constexpr u64 kAttrMask = kPresentBit | kWriteBit | kUserAccessibleBit |
+                                     kWriteThroughCachingBit | kDisableCacheBit | kGlobalBit |
+                                     kNoExecuteBit;
+
+    auto *pml4  = reinterpret_cast<PageMapTable<4> *>(Mem::PhysToVirt(root));
+    auto &pml4e = (*pml4)[PmeIdx<4>(vaddr)];
+    RET_UNEXPECTED_IF(!pml4e.IsPresent(), Mem::MemError::NotFound);
+
+    // Level 3: 1 GiB page into 2 MiB pages
+    auto *pdpt  = reinterpret_cast<PageMapTable<3> *>(Mem::PhysToVirt(pml4e.GetNextLevelTable()));
+    auto &pdpte = (*pdpt)[PmeIdx<3>(vaddr)];
+    RET_UNEXPECTED_IF(!pdpte.IsPresent(), Mem::MemError::NotFound);
+
+    if (pdpte.IsHuge()) {
+        const auto &huge = reinterpret_cast<const PageMapEntry<3, kHugePage> &>(pdpte);
+        const u64 attrs  = *reinterpret_cast<const u64 *>(&huge) & (kAttrMask | kPatBit);
+        const uptr base  = Mem::PtrToUptr(huge.GetFrameAddress());
+
+        auto res = ctx.AllocateTable(2);
+        RET_UNEXPECTED_IF_ERR(res);
+
+        auto *pd = reinterpret_cast<PageMapEntry<2, kHugePage> *>(Mem::PhysToVirt(*res));
+        for (size_t i = 0; i < 512; ++i) {
+            pd[i].SetFrameAddress(
+                Mem::UptrToPtr<void>(base + i * PageSize<PageSizeTag::k2Mb>()), attrs
+            );
+            ctx.IncreaseUsage(*res);
+        }
+
+        // The table replaces the huge page in a single store, the range stays mapped throughout
+        PageMapEntry<3> table_entry{};
+        table_entry.SetNextLevelTable(reinterpret_cast<PageMapTable<2> *>(*res), kDefTableFlags);
+        *reinterpret_cast<volatile u64 *>(&pdpte) = *reinterpret_cast<const u64 *>(&table_entry);
+    }
+
+    // Level 2: 2 MiB page into 4 KiB pages
+    auto *pd  = reinterpret_cast<PageMapTable<2> *>(Mem::PhysToVirt(pdpte.GetNextLevelTable()));
+    auto &pde = (*pd)[PmeIdx<2>(vaddr)];
+    RET_UNEXPECTED_IF(!pde.IsPresent(), Mem::MemError::NotFound);
+
+    if (pde.IsHuge()) {
+        const auto &huge = reinterpret_cast<const PageMapEntry<2, kHugePage> &>(pde);
+        const u64 raw    = *reinterpret_cast<const u64 *>(&huge);
+        const u64 attrs  = (raw & kAttrMask) | ((raw & kPatBit) != 0 ? kPageTablePatBit : 0);
+        const uptr base  = Mem::PtrToUptr(huge.GetFrameAddress());
+
+        auto res = ctx.AllocateTable(1);
+        RET_UNEXPECTED_IF_ERR(res);
+
+        auto *pt = reinterpret_cast<PageMapTable<1> *>(Mem::PhysToVirt(*res));
+        for (size_t i = 0; i < 512; ++i) {
+            (*pt)[i].SetFrameAddress(Mem::UptrToPtr<void>(base + i * kPageSizeBytes), attrs);
+            ctx.IncreaseUsage(*res);
+        }
+
+        PageMapEntry<2> table_entry{};
+        table_entry.SetNextLevelTable(reinterpret_cast<PageMapTable<1> *>(*res), kDefTableFlags);
+        *reinterpret_cast<volatile u64 *>(&pde) = *reinterpret_cast<const u64 *>(&table_entry);
+    }
+
+    return {};
+}
+
 template <TableVisitor Visitor>
 void Mmu::VisitTables(Mem::PPtr<void> root, Visitor visitor)
 {
@@ -244,6 +316,58 @@ void Mmu::VisitTables(Mem::PPtr<void> root, Visitor visitor)
     RecVisit.template operator()<4>(root);
 }
 
+template <PageVisitor Visitor>
+void Mmu::VisitMappedPages(
+    Mem::PPtr<void> root, Mem::VPtr<void> start, size_t size, Visitor visitor
+)
+{
+    static constexpr u64 kPml4eSpan = 1ULL << 39;
+    static constexpr u64 kPdpteSpan = 1ULL << 30;
+    static constexpr u64 kPdeSpan   = 1ULL << 21;
+
+    // Moves addr to the start of the next span covered by a single table entry
+    const auto skip = [](uptr &addr, const u64 span) {
+        addr = (addr & ~(span - 1)) + span;
+    };
+
+    auto *pml4 = reinterpret_cast<PageMapTable<4> *>(Mem::PhysToVirt(root));
+
+    uptr addr      = Mem::PtrToUptr(start);
+    const uptr end = addr + size;
+
+    while (addr < end) {
+        const auto vaddr = Mem::UptrToPtr<void>(addr);
+
+        auto &pml4e = (*pml4)[PmeIdx<4>(vaddr)];
+        if (!pml4e.IsPresent()) {
+            skip(addr, kPml4eSpan);
+            continue;
+        }
+
+        auto *pdpt =
+            reinterpret_cast<PageMapTable<3> *>(Mem::PhysToVirt(pml4e.GetNextLevelTable()));
+        auto &pdpte = (*pdpt)[PmeIdx<3>(vaddr)];
+        if (!pdpte.IsPresent() || pdpte.IsHuge()) {
+            skip(addr, kPdpteSpan);
+            continue;
+        }
+
+        auto *pd  = reinterpret_cast<PageMapTable<2> *>(Mem::PhysToVirt(pdpte.GetNextLevelTable()));
+        auto &pde = (*pd)[PmeIdx<2>(vaddr)];
+        if (!pde.IsPresent() || pde.IsHuge()) {
+            skip(addr, kPdeSpan);
+            continue;
+        }
+
+        auto *pt  = reinterpret_cast<PageMapTable<1> *>(Mem::PhysToVirt(pde.GetNextLevelTable()));
+        auto &pte = (*pt)[PmeIdx<1>(vaddr)];
+        if (pte.IsPresent()) {
+            visitor(vaddr, pte.GetFrameAddress());
+        }
+        addr += kPageSizeBytes;
+    }
+}
+
 template <MmuContext Context>
 void Mmu::DestroyTable(Context &ctx, Mem::PPtr<void> table_phys, u8 level)
 {
@@ -36,6 +36,13 @@ WRAP_CALL void TerminalWriteString(const char *data)
     }
 }
 
+WRAP_CALL void TerminalWrite(const char *data, const size_t size)
+{
+    if constexpr (FeatureEnabled<FeatureFlag::kDebugOutput>) {
+        QemuTerminalWrite(data, size);
+    }
+}
+
 WRAP_CALL void TerminalWriteError(const char *data)
 {
     if constexpr (FeatureEnabled<FeatureFlag::kDebugOutput>) {
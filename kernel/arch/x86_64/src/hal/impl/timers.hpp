@@ -8,6 +8,7 @@
 #include <time.h>
 #include <time.hpp>
 #include "drivers/cmos/rtc.hpp"
+#include "drivers/tsc/tsc.hpp"
 #include "trace_framework.hpp"
 
 namespace arch
@@ -27,6 +28,8 @@ WRAP_CALL time_t QuerySystemTime(const Timezone &tz)
     return ConvertDateTimeToPosix(rtcTime, tz);
 }
 
+NODISCARD WRAP_CALL u64 ReadCycleCounter() { return tsc::Read(); }
+
 void PickSystemClockSource();
 void PickSystemEventClockSource();
 
@@ -0,0 +1,29 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025-2026 The AlkOS Authors
+// See the AUTHORS file for the full list of contributors.
+
+#include "hal/impl/user_copy.hpp"
+
+extern "C" {
+// Labels of user_copy.nasm, only their addresses are meaningful
+extern const byte CopyUserBytesAccess[];
+extern const byte CopyUserBytesAccessEnd[];
+extern const byte CopyUserBytesFault[];
+}
+
+namespace arch
+{
+
+bool FixupUserCopyFault(ExceptionData &ed)
+{
+    const u64 rip = ed.isr_stack_frame.rip;
+    if (rip < reinterpret_cast<u64>(CopyUserBytesAccess) ||
+        rip >= reinterpret_cast<u64>(CopyUserBytesAccessEnd)) {
+        return false;
+    }
+
+    ed.isr_stack_frame.rip = reinterpret_cast<u64>(CopyUserBytesFault);
+    return true;
+}
+
+}  // namespace arch
@@ -0,0 +1,29 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025-2026 The AlkOS Authors
+// See the AUTHORS file for the full list of contributors.
+
+#ifndef KERNEL_ARCH_X86_64_SRC_HAL_IMPL_USER_COPY_HPP_
+#define KERNEL_ARCH_X86_64_SRC_HAL_IMPL_USER_COPY_HPP_
+
+#include <types.h>
+
+#include "hal/impl/interrupt_params.hpp"
+
+namespace arch
+{
+
+/**
+ * @brief Copy bytes from or to user space, surviving faults on unmapped or protected pages
+ * @return Number of bytes left uncopied, 0 on success
+ */
+extern "C" size_t CopyUserBytes(void *dst, const void *src, size_t size);
+
+/**
+ * @brief Resume a faulting CopyUserBytes() at its failure path
+ * @return true if the fault was raised by CopyUserBytes() and the frame was redirected
+ */
+bool FixupUserCopyFault(ExceptionData &ed);
+
+}  // namespace arch
+
+#endif  // KERNEL_ARCH_X86_64_SRC_HAL_IMPL_USER_COPY_HPP_
@@ -186,13 +186,32 @@ const char *GetExceptionMsg(const u8 exc_idx)
     return nullptr;
 }
 
+/**
+ * @brief Interrupt Stack Table slot of the vector
+ * @note NMI and #MC can arrive anywhere, #DF usually follows a broken stack, so none of them may
+ * run on the interrupted one - it can still be the user stack right after SYSCALL
+ */
+static u8 GetIstIndex(const u8 idx)
+{
+    switch (idx) {
+        case kNmiVector:
+            return cpu::kIstNmi;
+        case kDoubleFaultVector:
+            return cpu::kIstDoubleFault;
+        case kMachineCheckVector:
+            return cpu::kIstMachineCheck;
+        default:
+            return 0;
+    }
+}
+
 static void IdtSetDescriptor(Idt &idt, const u8 idx, const u64 isr, const IdtEntryFlags flags)
 {
     IdtEntry &entry = idt.idt[idx];
 
     entry.isr_low    = isr & kBitMask16;
     entry.kernel_cs  = cpu::GDT::kKernelCodeSelector;
-    entry.ist        = 0;
+    entry.ist        = GetIstIndex(idx);
     entry.attributes = flags;
     entry.isr_mid    = (isr >> 16) & kBitMask16;
     entry.isr_high   = (isr >> 32) & kBitMask32;
@@ -20,6 +20,10 @@ static constexpr u16 kIrq2Offset     = 0x28;
 static constexpr u16 kSpuriousVector = 0xFF; /* Spurious interrupt vector */
 static constexpr u16 kSyscallVector  = 0x80; /* Syscall interrupt vector */
 
+static constexpr u8 kNmiVector          = 2;
+static constexpr u8 kDoubleFaultVector  = 8;
+static constexpr u8 kMachineCheckVector = 18;
+
 static constexpr u8 kExceptionIdx[]{0,  1,  2,  3,  4,  5,  6,  7,  8,  9,  10, 11, 12, 13, 14, 15,
                                     16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31};
 static constexpr size_t kExceptionCount = sizeof(kExceptionIdx) / sizeof(kExceptionIdx[0]);
@@ -97,7 +101,7 @@ struct PACK IdtEntry {
     u16 isr_low;    // The lower 16 bits of the ISR's address
     u16 kernel_cs;  // The GDT segment selector that the CPU will load into CS before calling the
     // ISR
-    u8 ist;  // The IST in the TSS that the CPU will load into RSP; set to zero for now
+    u8 ist;  // The IST in the TSS that the CPU will load into RSP, zero keeps the current stack
     IdtEntryFlags attributes;  // Type and attributes; see the IDT page
     u16 isr_mid;               // The higher 16 bits of the lower 32 bits of the ISR's address
     u32 isr_high;              // The higher 32 bits of the ISR's address
@@ -39,6 +39,7 @@ static constexpr u64 kAccessedBit            = 1ULL << 5;   ///< Accessed bit
 static constexpr u64 kDirtyBit               = 1ULL << 6;   ///< Dirty bit
 static constexpr u64 kGlobalBit              = 1ULL << 8;   ///< Global bit
 static constexpr u64 kPatBit                 = 1ULL << 12;  ///< PAT bit
+static constexpr u64 kPageTablePatBit        = 1ULL << 7;   ///< PAT bit of 4-KByte pages
 static constexpr u64 kHlatRestartBit         = 1ULL << 13;  ///< HLAT restart bit
 static constexpr u64 kHugePageBit            = 1ULL << 7;   ///< Huge page bit
 static constexpr u64 kNoExecuteBit           = 1ULL << 63;
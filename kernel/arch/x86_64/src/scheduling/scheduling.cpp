@@ -45,7 +45,13 @@ FAST_CALL void LoadFpStateIfNeeded(Sched::Thread *thread)
     }
 }
 
-FAST_CALL void SetTssRsp0(const u64 rsp0) { hardware::GetCoreLocalSelf()->tss.rsp0 = rsp0; }
+FAST_CALL void SetTssRsp0(const u64 rsp0)
+{
+    auto *core_local = hardware::GetCoreLocalSelf();
+
+    core_local->tss.rsp0      = rsp0;
+    core_local->syscall_stack = rsp0;
+}
 
 FAST_CALL void SetNextThreadFs(Sched::Thread *thread)
 {
@@ -8,11 +8,13 @@
 #include <types.h>
 #include <defines.hpp>
 
+#include "alkos/mem.h"
+
 static constexpr u16 kMaxProcesses    = 4096;
 static constexpr u32 kMaxThreads      = kMaxProcesses * 2;
 static constexpr u32 kStackSize       = 64 * 1024;                   // TODO 8 meg
 static constexpr u32 kKernelStackSize = 64 * 1024;                   // TODO 1 meg
-static constexpr u64 kHeapSize        = 16ULL * 1024 * 1024 * 1024;  // 16 GB
+static constexpr u64 kHeapSize        = kMemHeapSize;
 static constexpr u32 kStackAlignment  = 64;
 
 static constexpr u64 kUserSpaceStart          = 0x0;
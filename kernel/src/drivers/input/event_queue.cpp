@@ -0,0 +1,90 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025-2026 The AlkOS Authors
+// See the AUTHORS file for the full list of contributors.
+
+#include "drivers/input/event_queue.hpp"
+
+#include <limits.hpp>
+
+#include "mem/heap.hpp"
+#include "modules/scheduling.hpp"
+#include "modules/timing.hpp"
+#include "scheduling/local_lock.hpp"
+
+namespace Drivers::Input
+{
+
+EventQueue::~EventQueue()
+{
+    if (readers_wq_ != nullptr) {
+        ASSERT_TRUE(readers_wq_->IsEmpty());
+        Mem::KDelete(readers_wq_);
+    }
+}
+
+void EventQueue::Push(const InputEvent &event)
+{
+    if (!has_reader_.load(std::memory_order_acquire)) {
+        return;
+    }
+
+    if (events_.Write(std::span<const InputEvent>(&event, 1)) == 0) {
+        return;
+    }
+
+    if (readers_wq_ != nullptr && !readers_wq_->IsEmpty()) {
+        SchedulingModule::Get().GetScheduler().ReleaseAll(readers_wq_);
+    }
+}
+
+size_t EventQueue::Read(std::span<InputEvent> events, const i64 timeout_ns)
+{
+    has_reader_.store(true, std::memory_order_release);
+
+    auto &scheduler    = SchedulingModule::Get().GetScheduler();
+    auto &system_time  = TimingModule::Get().GetSystemTime();
+    const u64 deadline = timeout_ns < 0 ? std::numeric_limits<u64>::max()
+                                        : system_time.ReadLifeTimeNs() + timeout_ns;
+
+    bool has_turn = false;
+    while (true) {
+        // The keyboard wakes readers with interrupts disabled, nothing is missed between the
+        // check and the block
+        LocalCoreLock core_lock{};
+
+        // The ring takes a single consumer, other readers wait until the current one returns
+        if (!has_turn) {
+            has_turn = !reading_.exchange(true, std::memory_order_acquire);
+        }
+
+        const size_t read    = has_turn ? events_.Read(events) : 0;
+        const bool timed_out = timeout_ns == 0 || system_time.ReadLifeTimeNs() >= deadline;
+        if (read != 0 || events.empty() || timed_out) {
+            if (has_turn) {
+                reading_.store(false, std::memory_order_release);
+                if (readers_wq_ != nullptr && !readers_wq_->IsEmpty()) {
+                    scheduler.ReleaseAll(readers_wq_);
+                }
+            }
+            return read;
+        }
+
+        if (readers_wq_ == nullptr) {
+            const auto new_wq = Mem::KNew<WaitQueueT>();
+            if (!new_wq) {
+                // Degrade to polling
+                scheduler.Yield();
+                continue;
+            }
+            readers_wq_ = new_wq.value();
+        }
+
+        if (timeout_ns < 0) {
+            scheduler.BlockOnWaitQueue(readers_wq_);
+        } else {
+            scheduler.BlockOnWaitQueueUntil(readers_wq_, deadline);
+        }
+    }
+}
+
+}  // namespace Drivers::Input
@@ -0,0 +1,69 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025-2026 The AlkOS Authors
+// See the AUTHORS file for the full list of contributors.
+
+#ifndef KERNEL_SRC_DRIVERS_INPUT_EVENT_QUEUE_HPP_
+#define KERNEL_SRC_DRIVERS_INPUT_EVENT_QUEUE_HPP_
+
+#include <alkos/input.h>
+#include <types.h>
+#include <atomic.hpp>
+#include <data_structures/atomic_cyclic_buffer.hpp>
+#include <span.hpp>
+
+namespace Sched
+{
+struct Thread;
+
+template <class T, int kIntrusiveLevel>
+class WaitQueue;
+}  // namespace Sched
+
+namespace Drivers::Input
+{
+
+/**
+ * @brief Key events of a single process. The keyboard IRQ is the only producer and one reader at
+ * a time the only consumer, so the ring needs no lock. Threads reading concurrently take turns.
+ *
+ * Nothing is queued before the first Read(): processes taking characters from stdin never
+ * collect events they do not want. No descriptor refers to the queue, a Read() with timeout 0
+ * checks for pending events instead of poll().
+ */
+class EventQueue
+{
+    public:
+    static constexpr size_t kCapacity = 128;
+
+    EventQueue() = default;
+    ~EventQueue();
+
+    /**
+     * @brief Queue an event, dropped when the reader fell behind. IRQ safe.
+     */
+    void Push(const InputEvent &event);
+
+    /**
+     * @brief Take the oldest events, waiting for the first one and for the turn of the caller.
+     * Thread context only.
+     * @param timeout_ns Maximal wait, negative waits without limit, 0 only checks
+     * @return Number of events read, 0 on timeout
+     */
+    size_t Read(std::span<InputEvent> events, i64 timeout_ns);
+
+    NODISCARD bool HasEvents() const { return !events_.IsEmpty(); }
+
+    private:
+    using WaitQueueT = Sched::WaitQueue<Sched::Thread, 3>;
+
+    data_structures::AtomicCyclicBuffer<InputEvent, kCapacity> events_;
+    std::atomic<bool> has_reader_{false};
+    std::atomic<bool> reading_{false};
+
+    // Allocated on the first block, readers wait on it for events and for their turn
+    WaitQueueT *readers_wq_{nullptr};
+};
+
+}  // namespace Drivers::Input
+
+#endif  // KERNEL_SRC_DRIVERS_INPUT_EVENT_QUEUE_HPP_
@@ -18,7 +18,7 @@ namespace Drivers::Input
  * from the mechanism of consuming them (Shell/User-space).
  *
  */
-class Keyboard : public IO::IReader
+class Keyboard : public IO::IReader, public IO::IPollable
 {
     public:
     static constexpr size_t kKeyBufferSize = 128;
@@ -36,6 +36,12 @@ class Keyboard : public IO::IReader
      */
     IO::IoResult Read(std::span<byte> buffer) override { return pipe_.Read(buffer); }
 
+    // ------------------------------
+    // IO::IPollable Implementation
+    // ------------------------------
+
+    NODISCARD u16 Poll() const override { return static_cast<u16>(pipe_.Poll() & kPollIn); }
+
     // ------------------------------
     // Protected Interface for Drivers
     // ------------------------------
@@ -52,7 +58,9 @@ class Keyboard : public IO::IReader
     {
         byte b = static_cast<byte>(c);
         // If full drop the keystroke
-        (void)pipe_.Write(std::span<const byte>(&b, 1));
+        if (pipe_.Write(std::span<const byte>(&b, 1))) {
+            WakePollWaiters_();
+        }
     }
 
     private:
@@ -5,6 +5,7 @@
 #include "drivers/input/ps2_keyboard.hpp"
 #include "modules/input.hpp"
 #include "modules/video.hpp"
+#include "time/system_time.hpp"
 #include "trace_framework.hpp"
 
 namespace Drivers::Input
@@ -362,10 +363,20 @@ void Ps2Keyboard::OnInterrupt()
         // Update key state
         UpdateKeyState(base_scancode, !is_break);
 
+        const VirtualKey vk = ScancodeToVirtualKey(base_scancode, is_e0_prefix_);
+
+        // Tab switches sessions and never reaches the focused process
+        if (vk != VK_Unknown && vk != VK_Tab && InputModule::IsInited()) {
+            InputModule::Get().RouteEvent({
+                .time_ns   = static_cast<u64>(timing::SystemTime::ReadLifeTimeNs()),
+                .key       = vk,
+                .pressed   = !is_break,
+                .modifiers = modifiers_,
+            });
+        }
+
         // Only process key press events for input routing
         if (!is_break) {
-            VirtualKey vk = ScancodeToVirtualKey(base_scancode, is_e0_prefix_);
-
             // Special handling for Tab to switch sessions
             if (vk == VK_Tab) {
                 if (VideoModule::IsInited()) {
@@ -8,10 +8,11 @@
 
 using namespace Drivers::Video;
 
-void Framebuffer::Init(Graphics::Surface s, Graphics::PixelFormat pf)
+void Framebuffer::Init(Graphics::Surface s, Graphics::PixelFormat pf, Mem::PPtr<void> phys_base)
 {
     front_surface_ = s;
     format_        = pf;
+    phys_base_     = phys_base;
 }
 
 FramebufferInfo Framebuffer::GetInfo() const
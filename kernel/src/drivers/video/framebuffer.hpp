@@ -10,6 +10,8 @@
 
 #include <expected.hpp>
 
+#include "mem/types.hpp"
+
 namespace Drivers::Video
 {
 
@@ -25,11 +27,12 @@ class Framebuffer
     public:
     Framebuffer() = default;
 
-    void Init(Graphics::Surface s, Graphics::PixelFormat pf);
+    void Init(Graphics::Surface s, Graphics::PixelFormat pf, Mem::PPtr<void> phys_base);
 
     // Accessors
     NODISCARD Graphics::Surface &GetSurface() { return front_surface_; }
     NODISCARD const Graphics::PixelFormat &GetFormat() const { return format_; }
+    NODISCARD Mem::PPtr<void> GetPhysAddress() const { return phys_base_; }
 
     NODISCARD FramebufferInfo GetInfo() const;
     NODISCARD size_t CalculateSize() const;
@@ -37,6 +40,7 @@ class Framebuffer
     private:
     Graphics::Surface front_surface_{};  // Physical VRAM
     Graphics::PixelFormat format_{};
+    Mem::PPtr<void> phys_base_{nullptr};  // Physical VRAM, the surface maps it write-combining
 };
 
 }  // namespace Drivers::Video
@@ -11,6 +11,14 @@ inline constexpr size_t kMaxFdsPerProcess = 128;
 inline constexpr size_t kMaxOpenFiles     = 1014;
 inline constexpr size_t kMaxActiveFiles   = 512;
 inline constexpr size_t kStdioBufferSize  = 4096;
+inline constexpr size_t kMaxIoVecs        = 64;
+inline constexpr size_t kPipeBounceSize   = 512;
+
+inline constexpr size_t kPageCacheSize            = 4096;
+inline constexpr size_t kPageCacheBuckets         = 1024;
+inline constexpr size_t kPageCacheMaxWritebackRun = 16;
+inline constexpr size_t kPageCacheDirtyHighWater  = 256;
+inline constexpr u64 kPageCacheWritebackDelayNs   = 500'000'000;
 }  // namespace Fs
 
 #endif  // KERNEL_SRC_FS_COSTANTS_HPP_
@@ -4,7 +4,10 @@
 
 #include "file_descriptor.hpp"
 
+#include "mem/heap.hpp"
+#include "mem/virt/user_access.hpp"
 #include "modules/scheduling.hpp"
+#include "modules/timing.hpp"
 #include "mutex.hpp"
 #include "scheduling/local_lock.hpp"
 #include "scheduling/processes.hpp"
@@ -65,7 +68,9 @@ FdResult<> FdTable::Free(fd_t fd)
 
     std::lock_guard lock(lock_);
 
-    if (fd <= kStderrFd && entries_[fd] != nullptr && entries_[fd]->IsPipe()) {
+    // The standard streams of a process cannot be closed, anonymous pipes moved onto them can
+    if (fd <= kStderrFd && entries_[fd] != nullptr && entries_[fd]->IsPipe() &&
+        !entries_[fd]->owns_pipe) {
         return std::unexpected(FdError::kPermissionDenied);
     }
 
@@ -139,6 +144,8 @@ FdResult<fd_t> FdTable::DuplicateFdTo(fd_t old_fd, fd_t new_fd)
 
 File::~File()
 {
+    ::VfsModule::Get().GetPageCache().Evict(*this);
+
     auto &ft = ::VfsModule::Get().GetFdManager().GetFileTable();
     ft.files_.Free(pool_idx_);
     --ft.count_;
@@ -146,13 +153,17 @@ File::~File()
 
 FdResult<data_structures::RefPtr<File>> FileTable::GetOrCreate(const vfs::Path &path)
 {
-    RET_UNEXPECTED_IF(path.IsEmpty(), FdError::kInvalidArgument);
+    RET_UNEXPECTED_IF(path.IsEmpty() || !path.IsValid(), FdError::kInvalidArgument);
 
     File *existing = Find(path);
     if (existing != nullptr) {
-        return data_structures::RefPtr(existing, false);
+        return data_structures::RefPtr(existing);
     }
 
+    // Copied up front, moving it into the file below cannot fail anymore
+    vfs::Path file_path = path;
+    RET_UNEXPECTED_IF(!file_path.IsValid(), FdError::kIoError);
+
     const size_t idx = files_.Allocate();
     RET_UNEXPECTED_IF(idx == std::numeric_limits<size_t>::max(), FdError::kIoError);
 
@@ -162,9 +173,12 @@ FdResult<data_structures::RefPtr<File>> FileTable::GetOrCreate(const vfs::Path &
     new (file) File();
     file->pool_idx_ = idx;
 
-    file->size = 0;
-    file->mode = 0;
-    file->path = path;
+    const auto size_result = VfsModule::Get().GetFileSize(path);
+
+    file->size         = size_result.value_or(0);
+    file->backing_size = file->size;
+    file->mode         = 0;
+    file->path         = std::move(file_path);
     ++count_;
 
     return data_structures::RefPtr(file);
@@ -187,6 +201,18 @@ File *FileTable::Find(const vfs::Path &path)
 
 OpenFileEntry::~OpenFileEntry()
 {
+    if (IsPipe()) {
+        const OpenMode mode = static_cast<OpenMode>(flags);
+        auto *pipe          = GetPipe();
+
+        const bool last = pipe->CloseEnds(
+            HasMode(mode, OpenMode::kRead), HasMode(mode, OpenMode::kWrite)
+        );
+        if (last && owns_pipe) {
+            Mem::KDelete(pipe);
+        }
+    }
+
     auto &oft = ::VfsModule::Get().GetFdManager().GetOpenFileTable();
     oft.entries_.Free(pool_idx_);
     --oft.count_;
@@ -219,7 +245,7 @@ FdResult<data_structures::RefPtr<OpenFileEntry>> OpenFileTable::OpenFile(File *f
 }
 
 FdResult<data_structures::RefPtr<OpenFileEntry>> OpenFileTable::OpenPipe(
-    IO::Pipe<kStdioBufferSize> &pipe
+    IO::Pipe<kStdioBufferSize> &pipe, OpenMode flags, bool owns_pipe
 )
 {
     std::lock_guard lock(lock_);
@@ -237,11 +263,14 @@ FdResult<data_structures::RefPtr<OpenFileEntry>> OpenFileTable::OpenPipe(
     entry->pool_idx_ = idx;
 
     entry->handle    = FileHandle::Wrap(&pipe);
-    entry->flags     = static_cast<u32>(OpenMode::kReadWrite);
+    entry->flags     = static_cast<u32>(flags);
     entry->offset    = 0;
     entry->is_append = false;
+    entry->owns_pipe = owns_pipe;
     ++count_;
 
+    pipe.OpenEnds(HasMode(flags, OpenMode::kRead), HasMode(flags, OpenMode::kWrite));
+
     return data_structures::RefPtr(entry);
 }
 
@@ -309,40 +338,172 @@ FdResult<size_t> FdManager::Read(fd_t fd, std::span<byte> buffer)
 {
     RET_UNEXPECTED_IF(buffer.empty(), FdError::kInvalidArgument);
 
-    FdTable *fd_table = GetCurrentProcessFdTable();
-    ASSERT_NOT_NULL(fd_table);
+    auto entry_result = GetEntry_(fd, OpenMode::kRead);
+    RET_UNEXPECTED_IF_ERR(entry_result);
+    OpenFileEntry *entry = *entry_result;
 
-    OpenFileEntry *entry = fd_table->Get(fd);
-    RET_UNEXPECTED_IF(!entry, FdError::kBadFileDescriptor);
+    auto result = ReadAt_(*entry, buffer, entry->offset);
+    RET_UNEXPECTED_IF_ERR(result);
 
-    OpenMode mode = static_cast<OpenMode>(entry->flags);
-    RET_UNEXPECTED_IF(!HasMode(mode, OpenMode::kRead), FdError::kPermissionDenied);
+    if (entry->IsFile()) {
+        entry->offset += *result;
+    }
+    return *result;
+}
+
+FdResult<size_t> FdManager::Write(fd_t fd, std::span<const byte> buffer)
+{
+    RET_UNEXPECTED_IF(buffer.empty(), FdError::kInvalidArgument);
+
+    auto entry_result = GetEntry_(fd, OpenMode::kWrite);
+    RET_UNEXPECTED_IF_ERR(entry_result);
+
+    return WriteShared_(**entry_result, buffer);
+}
+
+FdResult<size_t> FdManager::ReadV(fd_t fd, std::span<const IoVec> iov)
+{
+    RET_UNEXPECTED_IF(!ValidateIoVecs_(iov), FdError::kInvalidArgument);
+
+    auto entry_result = GetEntry_(fd, OpenMode::kRead);
+    RET_UNEXPECTED_IF_ERR(entry_result);
+    OpenFileEntry *entry = *entry_result;
+
+    size_t total = 0;
+    for (const IoVec &vec : iov) {
+        if (vec.length == 0) {
+            continue;
+        }
+
+        // Only the first transfer may block, a pipe that was drained ends the call
+        auto result = ReadAt_(
+            *entry, std::span(static_cast<byte *>(vec.base), vec.length), entry->offset + total,
+            total == 0
+        );
+        if (!result) {
+            // Report the data already transferred, the error surfaces on the next call
+            RET_UNEXPECTED_IF(total == 0, result.error());
+            break;
+        }
+
+        total += *result;
+        if (*result < vec.length) {
+            break;
+        }
+    }
 
     if (entry->IsFile()) {
-        File *file = entry->GetFile();
-        RET_UNEXPECTED_IF(file == nullptr, FdError::kBadFileDescriptor);
+        entry->offset += total;
+    }
+    return total;
+}
+
+FdResult<size_t> FdManager::WriteV(fd_t fd, std::span<const IoVec> iov)
+{
+    RET_UNEXPECTED_IF(!ValidateIoVecs_(iov), FdError::kInvalidArgument);
 
-        auto result = vfs::ReadFile(file->path, buffer.data(), buffer.size(), entry->offset);
-        RET_UNEXPECTED_IF(!result, FdError::kIoError);
+    auto entry_result = GetEntry_(fd, OpenMode::kWrite);
+    RET_UNEXPECTED_IF_ERR(entry_result);
+    OpenFileEntry *entry = *entry_result;
 
-        entry->offset += *result;
-        return *result;
-    } else if (entry->IsPipe()) {
-        auto *pipe = entry->GetPipe();
-        RET_UNEXPECTED_IF(pipe == nullptr, FdError::kBadFileDescriptor);
+    if (entry->IsFile() && entry->is_append) {
+        entry->offset = entry->GetFile()->size;
+    }
 
-        auto result = pipe->Read(buffer);
-        RET_UNEXPECTED_IF(!result, FdError::kIoError);
-        return *result;
+    size_t total = 0;
+    for (const IoVec &vec : iov) {
+        if (vec.length == 0) {
+            continue;
+        }
+
+        auto result = WriteAt_(
+            *entry, std::span(static_cast<const byte *>(vec.base), vec.length),
+            entry->offset + total
+        );
+        if (!result) {
+            // Report the data already transferred, the error surfaces on the next call
+            RET_UNEXPECTED_IF(total == 0, result.error());
+            break;
+        }
+
+        total += *result;
+        if (*result < vec.length) {
+            break;
+        }
     }
 
-    return std::unexpected(FdError::kBadFileDescriptor);
+    if (entry->IsFile()) {
+        entry->offset += total;
+    }
+    return total;
 }
 
-FdResult<size_t> FdManager::Write(fd_t fd, std::span<const byte> buffer)
+FdResult<size_t> FdManager::PRead(fd_t fd, std::span<byte> buffer, u64 offset)
 {
     RET_UNEXPECTED_IF(buffer.empty(), FdError::kInvalidArgument);
 
+    auto entry_result = GetEntry_(fd, OpenMode::kRead);
+    RET_UNEXPECTED_IF_ERR(entry_result);
+
+    // Pipes have no position to read at
+    RET_UNEXPECTED_IF(!(*entry_result)->IsFile(), FdError::kInvalidArgument);
+    return ReadAt_(**entry_result, buffer, offset);
+}
+
+FdResult<size_t> FdManager::PWrite(fd_t fd, std::span<const byte> buffer, u64 offset)
+{
+    RET_UNEXPECTED_IF(buffer.empty(), FdError::kInvalidArgument);
+
+    auto entry_result = GetEntry_(fd, OpenMode::kWrite);
+    RET_UNEXPECTED_IF_ERR(entry_result);
+
+    // Pipes have no position to write at
+    RET_UNEXPECTED_IF(!(*entry_result)->IsFile(), FdError::kInvalidArgument);
+    return WriteAt_(**entry_result, buffer, offset);
+}
+
+FdResult<size_t> FdManager::Splice(fd_t in_fd, fd_t out_fd, size_t count)
+{
+    RET_UNEXPECTED_IF(count == 0, FdError::kInvalidArgument);
+
+    auto in_result = GetEntry_(in_fd, OpenMode::kRead);
+    RET_UNEXPECTED_IF_ERR(in_result);
+    OpenFileEntry *in = *in_result;
+
+    auto out_result = GetEntry_(out_fd, OpenMode::kWrite);
+    RET_UNEXPECTED_IF_ERR(out_result);
+
+    auto result = Transfer_(*in, **out_result, in->offset, count);
+    RET_UNEXPECTED_IF_ERR(result);
+
+    if (in->IsFile()) {
+        in->offset += *result;
+    }
+    return *result;
+}
+
+FdResult<size_t> FdManager::SendFile(fd_t out_fd, fd_t in_fd, u64 &offset, size_t count)
+{
+    RET_UNEXPECTED_IF(count == 0, FdError::kInvalidArgument);
+
+    auto in_result = GetEntry_(in_fd, OpenMode::kRead);
+    RET_UNEXPECTED_IF_ERR(in_result);
+
+    // Pipes have no position to read at
+    RET_UNEXPECTED_IF(!(*in_result)->IsFile(), FdError::kInvalidArgument);
+
+    auto out_result = GetEntry_(out_fd, OpenMode::kWrite);
+    RET_UNEXPECTED_IF_ERR(out_result);
+
+    auto result = Transfer_(**in_result, **out_result, offset, count);
+    RET_UNEXPECTED_IF_ERR(result);
+
+    offset += *result;
+    return *result;
+}
+
+FdResult<OpenFileEntry *> FdManager::GetEntry_(fd_t fd, OpenMode access)
+{
     FdTable *fd_table = GetCurrentProcessFdTable();
     ASSERT_NOT_NULL(fd_table);
 
@@ -350,33 +511,235 @@ FdResult<size_t> FdManager::Write(fd_t fd, std::span<const byte> buffer)
     RET_UNEXPECTED_IF(!entry, FdError::kBadFileDescriptor);
 
     OpenMode mode = static_cast<OpenMode>(entry->flags);
-    RET_UNEXPECTED_IF(!HasMode(mode, OpenMode::kWrite), FdError::kPermissionDenied);
+    RET_UNEXPECTED_IF(!HasMode(mode, access), FdError::kPermissionDenied);
 
-    if (entry->IsFile()) {
-        File *file = entry->GetFile();
+    return entry;
+}
+
+FdResult<size_t> FdManager::ReadAt_(
+    OpenFileEntry &entry, std::span<byte> buffer, u64 offset, bool may_block
+)
+{
+    if (entry.IsFile()) {
+        File *file = entry.GetFile();
         RET_UNEXPECTED_IF(file == nullptr, FdError::kBadFileDescriptor);
 
-        if (entry->is_append) {
-            entry->offset = file->size;
-        }
+        return VfsModule::Get().GetPageCache().Read(*file, buffer, offset);
+    } else if (entry.IsPipe()) {
+        auto *pipe = entry.GetPipe();
+        RET_UNEXPECTED_IF(pipe == nullptr, FdError::kBadFileDescriptor);
 
-        auto result = vfs::WriteFile(file->path, buffer.data(), buffer.size(), entry->offset);
-        RET_UNEXPECTED_IF(!result, FdError::kIoError);
+        const OpenMode mode = static_cast<OpenMode>(entry.flags);
+        return ReadPipe_(*pipe, buffer, may_block && !HasMode(mode, OpenMode::kNonBlock));
+    }
 
-        entry->offset += *result;
-        return *result;
-    } else if (entry->IsPipe()) {
-        auto *pipe = entry->GetPipe();
+    return std::unexpected(FdError::kBadFileDescriptor);
+}
+
+FdResult<size_t> FdManager::WriteAt_(
+    OpenFileEntry &entry, std::span<const byte> buffer, u64 offset
+)
+{
+    if (entry.IsFile()) {
+        File *file = entry.GetFile();
+        RET_UNEXPECTED_IF(file == nullptr, FdError::kBadFileDescriptor);
+
+        const OpenMode mode = static_cast<OpenMode>(entry.flags);
+        return VfsModule::Get().GetPageCache().Write(
+            *file, buffer, offset, HasMode(mode, OpenMode::kSync)
+        );
+    } else if (entry.IsPipe()) {
+        auto *pipe = entry.GetPipe();
         RET_UNEXPECTED_IF(pipe == nullptr, FdError::kBadFileDescriptor);
 
-        auto result = pipe->Write(buffer);
-        RET_UNEXPECTED_IF(!result, FdError::kIoError);
-        return *result;
+        const OpenMode mode = static_cast<OpenMode>(entry.flags);
+        return WritePipe_(*pipe, buffer, !HasMode(mode, OpenMode::kNonBlock));
     }
 
     return std::unexpected(FdError::kBadFileDescriptor);
 }
 
+FdResult<size_t> FdManager::ReadPipe_(
+    IO::Pipe<kStdioBufferSize> &pipe, std::span<byte> buffer, const bool block
+)
+{
+    byte bounce[kPipeBounceSize];
+
+    size_t done = 0;
+    while (done < buffer.size()) {
+        const std::span<byte> chunk(bounce, std::min(kPipeBounceSize, buffer.size() - done));
+
+        // Only the first transfer may block, a pipe that was drained ends the call
+        auto result = block && done == 0 ? pipe.ReadBlocking(chunk) : pipe.Read(chunk);
+        if (!result) {
+            if (done > 0) {
+                break;
+            }
+
+            // Reading past the last writer is end of file, not an error
+            RET_UNEXPECTED_IF(result.error() == IO::Error::Retry, FdError::kWouldBlock);
+            RET_UNEXPECTED_IF(result.error() != IO::Error::EndOfFile, FdError::kIoError);
+            return 0;
+        }
+
+        if (!Mem::CopyToCaller(buffer.data() + done, bounce, *result)) {
+            RET_UNEXPECTED_IF(done == 0, FdError::kInvalidArgument);
+            break;
+        }
+
+        done += *result;
+        if (*result < chunk.size()) {
+            break;
+        }
+    }
+
+    return done;
+}
+
+FdResult<size_t> FdManager::WritePipe_(
+    IO::Pipe<kStdioBufferSize> &pipe, std::span<const byte> buffer, const bool block
+)
+{
+    byte bounce[kPipeBounceSize];
+
+    size_t done = 0;
+    while (done < buffer.size()) {
+        const std::span<const byte> chunk(bounce, std::min(kPipeBounceSize, buffer.size() - done));
+        if (!Mem::CopyFromCaller(bounce, buffer.data() + done, chunk.size())) {
+            RET_UNEXPECTED_IF(done == 0, FdError::kInvalidArgument);
+            break;
+        }
+
+        auto result = block ? pipe.WriteBlocking(chunk) : pipe.Write(chunk);
+        if (!result) {
+            // Report the data already transferred, the error surfaces on the next call
+            if (done > 0) {
+                break;
+            }
+
+            RET_UNEXPECTED_IF(result.error() == IO::Error::Retry, FdError::kWouldBlock);
+            RET_UNEXPECTED_IF(result.error() == IO::Error::EndOfFile, FdError::kBrokenPipe);
+            return std::unexpected(FdError::kIoError);
+        }
+
+        done += *result;
+        if (*result < chunk.size()) {
+            break;
+        }
+    }
+
+    return done;
+}
+
+FdResult<size_t> FdManager::WriteShared_(OpenFileEntry &entry, std::span<const byte> buffer)
+{
+    if (entry.IsFile() && entry.is_append) {
+        entry.offset = entry.GetFile()->size;
+    }
+
+    auto result = WriteAt_(entry, buffer, entry.offset);
+    RET_UNEXPECTED_IF_ERR(result);
+
+    if (entry.IsFile()) {
+        entry.offset += *result;
+    }
+    return *result;
+}
+
+FdResult<size_t> FdManager::Transfer_(
+    OpenFileEntry &in, OpenFileEntry &out, const u64 in_offset, size_t count
+)
+{
+    File *in_file = in.GetFile();
+    auto *in_pipe = in.GetPipe();
+    RET_UNEXPECTED_IF(in_file == nullptr && in_pipe == nullptr, FdError::kBadFileDescriptor);
+
+    // Moving data within one file or pipe would read back what was just written
+    RET_UNEXPECTED_IF(
+        (in_file != nullptr && in_file == out.GetFile()) ||
+            (in_pipe != nullptr && in_pipe == out.GetPipe()),
+        FdError::kInvalidArgument
+    );
+
+    // The total has to be representable in the signed syscall result
+    count = std::min<size_t>(count, std::numeric_limits<ssize_t>::max());
+
+    auto &page_cache = VfsModule::Get().GetPageCache();
+    const bool block = !HasMode(static_cast<OpenMode>(in.flags), OpenMode::kNonBlock);
+
+    size_t total = 0;
+    while (total < count) {
+        // Every chunk is a single cached page or a contiguous run of the pipe buffer, handed
+        // to the output in place
+        std::span<const byte> chunk;
+        if (in_file != nullptr) {
+            auto pinned = page_cache.Pin(*in_file, in_offset + total, count - total);
+            if (!pinned) {
+                RET_UNEXPECTED_IF(total == 0, pinned.error());
+                break;
+            }
+            chunk = *pinned;
+        } else {
+            // Only the first transfer may block, a pipe that was drained ends the call
+            if (total == 0) {
+                const auto ready = in_pipe->WaitReadable(block);
+                if (!ready) {
+                    RET_UNEXPECTED_IF(ready.error() == IO::Error::Retry, FdError::kWouldBlock);
+                    RET_UNEXPECTED_IF(ready.error() != IO::Error::EndOfFile, FdError::kIoError);
+                    return 0;
+                }
+            }
+            chunk = in_pipe->Peek();
+            chunk = chunk.first(std::min(chunk.size(), count - total));
+        }
+
+        if (chunk.empty()) {
+            break;
+        }
+
+        const auto written = WriteShared_(out, chunk);
+        if (in_file != nullptr) {
+            page_cache.Unpin(*in_file, in_offset + total);
+        } else {
+            in_pipe->Consume(written ? *written : 0);
+        }
+
+        if (!written) {
+            // Report the data already transferred, the error surfaces on the next call
+            RET_UNEXPECTED_IF(total == 0, written.error());
+            break;
+        }
+
+        total += *written;
+        if (*written < chunk.size()) {
+            break;
+        }
+    }
+
+    return total;
+}
+
+bool FdManager::ValidateIoVecs_(std::span<const IoVec> iov)
+{
+    if (iov.empty() || iov.size() > kMaxIoVecs) {
+        return false;
+    }
+
+    // The total length has to be representable in the signed syscall result
+    size_t total = 0;
+    for (const IoVec &vec : iov) {
+        if (vec.length > static_cast<size_t>(std::numeric_limits<ssize_t>::max()) - total) {
+            return false;
+        }
+        if (vec.base == nullptr && vec.length != 0) {
+            return false;
+        }
+        total += vec.length;
+    }
+
+    return total > 0;
+}
+
 FdResult<ssize_t> FdManager::Seek(fd_t fd, ssize_t offset, FdSeek whence)
 {
     FdTable *fd_table = GetCurrentProcessFdTable();
@@ -437,6 +800,148 @@ FdResult<fd_t> FdManager::Duplicate(fd_t old_fd, fd_t new_fd)
     return *dup_result;
 }
 
+FdResult<> FdManager::CreatePipe(fd_t (&fds)[2], OpenMode flags)
+{
+    RET_UNEXPECTED_IF(
+        static_cast<u8>(flags) & ~static_cast<u8>(OpenMode::kNonBlock), FdError::kInvalidArgument
+    );
+
+    FdTable *fd_table = GetCurrentProcessFdTable();
+    RET_UNEXPECTED_IF(fd_table == nullptr, FdError::kIoError);
+
+    const auto pipe = Mem::KNew<IO::Pipe<kStdioBufferSize>>();
+    RET_UNEXPECTED_IF(!pipe, FdError::kIoError);
+
+    // From here on the pipe is freed together with the last of its entries
+    auto read_entry = open_file_table_.OpenPipe(**pipe, OpenMode::kRead | flags, true);
+    if (!read_entry) {
+        Mem::KDelete(*pipe);
+        return std::unexpected(read_entry.error());
+    }
+
+    auto write_entry = open_file_table_.OpenPipe(**pipe, OpenMode::kWrite | flags, true);
+    RET_UNEXPECTED_IF_ERR(write_entry);
+
+    const auto read_fd = fd_table->Allocate(std::move(*read_entry));
+    RET_UNEXPECTED_IF_ERR(read_fd);
+
+    const auto write_fd = fd_table->Allocate(std::move(*write_entry));
+    if (!write_fd) {
+        static_cast<void>(fd_table->Free(*read_fd));
+        return std::unexpected(write_fd.error());
+    }
+
+    fds[0] = *read_fd;
+    fds[1] = *write_fd;
+    return {};
+}
+
+FdResult<size_t> FdManager::Poll(std::span<PollFd> fds, const i64 timeout_ns)
+{
+    using WaitQueueT = Sched::WaitQueue<Sched::Thread, Sched::kWaitQueueIntrusiveLevel>;
+
+    RET_UNEXPECTED_IF(fds.size() > kMaxFdsPerProcess, FdError::kInvalidArgument);
+
+    FdTable *fd_table = GetCurrentProcessFdTable();
+    RET_UNEXPECTED_IF(fd_table == nullptr, FdError::kIoError);
+
+    // Entries stay referenced for the whole call, so closing a descriptor concurrently cannot
+    // free a pipe one of the waiters is linked into
+    struct PollSlot {
+        data_structures::RefPtr<OpenFileEntry> entry;
+        IO::PollWaiter waiter;
+    };
+    PollSlot slots[kMaxFdsPerProcess]{};
+
+    for (size_t i = 0; i < fds.size(); ++i) {
+        OpenFileEntry *entry = fds[i].fd >= 0 ? fd_table->Get(fds[i].fd) : nullptr;
+        if (entry != nullptr) {
+            slots[i].entry = data_structures::RefPtr(entry);
+        }
+    }
+
+    auto &scheduler    = SchedulingModule::Get().GetScheduler();
+    auto &system_time  = TimingModule::Get().GetSystemTime();
+    const u64 deadline = timeout_ns < 0 ? std::numeric_limits<u64>::max()
+                                        : system_time.ReadLifeTimeNs() + timeout_ns;
+
+    WaitQueueT *wq = nullptr;
+    size_t ready   = 0;
+    while (true) {
+        // Sources wake waiters with interrupts disabled, nothing is missed between the check
+        // and the block
+        LocalCoreLock core_lock{};
+
+        ready = 0;
+        for (size_t i = 0; i < fds.size(); ++i) {
+            fds[i].revents = fds[i].fd < 0 ? 0 : PollEntry_(slots[i].entry.Get(), fds[i].events);
+            ready += fds[i].revents != 0 ? 1 : 0;
+        }
+
+        if (ready != 0 || timeout_ns == 0 || system_time.ReadLifeTimeNs() >= deadline) {
+            break;
+        }
+
+        if (wq == nullptr) {
+            const auto new_wq = Mem::KNew<WaitQueueT>();
+            if (!new_wq) {
+                // Degrade to polling
+                scheduler.Yield();
+                continue;
+            }
+            wq = new_wq.value();
+
+            for (size_t i = 0; i < fds.size(); ++i) {
+                if (slots[i].entry && slots[i].entry->IsPipe()) {
+                    slots[i].waiter.wq = wq;
+                    slots[i].entry->GetPipe()->AddPollWaiter(&slots[i].waiter);
+                }
+            }
+        }
+
+        if (timeout_ns < 0) {
+            scheduler.BlockOnWaitQueue(wq);
+        } else {
+            scheduler.BlockOnWaitQueueUntil(wq, deadline);
+        }
+    }
+
+    if (wq != nullptr) {
+        LocalCoreLock core_lock{};
+
+        for (size_t i = 0; i < fds.size(); ++i) {
+            if (slots[i].waiter.wq != nullptr) {
+                slots[i].entry->GetPipe()->RemovePollWaiter(&slots[i].waiter);
+            }
+        }
+        Mem::KDelete(wq);
+    }
+
+    return ready;
+}
+
+u16 FdManager::PollEntry_(const OpenFileEntry *entry, const u16 events)
+{
+    if (entry == nullptr) {
+        return kPollInvalid;
+    }
+
+    // Files are served from the page cache and never block
+    u16 ready = entry->IsPipe() ? entry->handle.As<IO::Pipe<kStdioBufferSize>>().Poll()
+                                : static_cast<u16>(kPollIn | kPollOut);
+
+    // Only report the directions this descriptor was opened for
+    const OpenMode mode = static_cast<OpenMode>(entry->flags);
+    if (!HasMode(mode, OpenMode::kRead)) {
+        ready &= ~(kPollIn | kPollHangUp);
+    }
+    if (!HasMode(mode, OpenMode::kWrite)) {
+        ready &= ~(kPollOut | kPollError);
+    }
+
+    return static_cast<u16>(ready & (events | kPollError | kPollHangUp));
+}
+
 FdTable *FdManager::GetCurrentProcessFdTable()
 {
     auto process = SchedulingModule::Get().GetProcesses().GetCurrentProcess();
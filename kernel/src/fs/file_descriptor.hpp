@@ -42,6 +42,8 @@ enum class FdError {
     kPermissionDenied,
     kInvalidArgument,
     kIoError,
+    kWouldBlock,
+    kBrokenPipe,
 };
 
 template <typename T = void>
@@ -109,6 +111,10 @@ inline constexpr fd_t kStderrFd = kFdStdErr;
 /**
  * @brief File represents a file in filesystem
  *
+ * `size` is the logical size seen through the page cache, `backing_size` is the size
+ * currently persisted by the filesystem driver. They differ while the file has dirty pages.
+ * `map_count` counts memory mappings of the file; cached pages of a mapped file are never
+ * reclaimed, as they may be mapped into user address spaces.
  */
 class File : public data_structures::RefCounted<File>
 {
@@ -116,7 +122,9 @@ class File : public data_structures::RefCounted<File>
 
     public:
     u64 size{0};
+    u64 backing_size{0};
     u32 mode{0};
+    u32 map_count{0};
     vfs::Path path;
 
     File() = default;
@@ -163,7 +171,8 @@ class FileTable
  * @brief Tagged union ptr holding either a File* or Pipe*
  *
  * - File: Smart (ref-counted), managed by RefCounted
- * - Pipe: NonOwned, owned by Process (for stdin/stdout/stderr)
+ * - Pipe: NonOwned, owned by Process (for stdin/stdout/stderr) or by its open file entries
+ *   (anonymous pipes, see OpenFileEntry::owns_pipe)
  */
 using FileHandle = data_structures::NonOwningTaggedPtr<File, IO::Pipe<kStdioBufferSize>>;
 
@@ -186,6 +195,7 @@ class OpenFileEntry : public data_structures::RefCounted<OpenFileEntry>
     u32 flags{0};
     u64 offset{0};
     bool is_append{false};
+    bool owns_pipe{false};  // Pipe is freed together with the last entry referencing it
 
     OpenFileEntry() = default;
     ~OpenFileEntry();
@@ -227,7 +237,10 @@ class OpenFileTable
     OpenFileTable &operator=(OpenFileTable &&)      = delete;
 
     FdResult<data_structures::RefPtr<OpenFileEntry>> OpenFile(File *file, OpenMode flags);
-    FdResult<data_structures::RefPtr<OpenFileEntry>> OpenPipe(IO::Pipe<kStdioBufferSize> &pipe);
+    FdResult<data_structures::RefPtr<OpenFileEntry>> OpenPipe(
+        IO::Pipe<kStdioBufferSize> &pipe, OpenMode flags = OpenMode::kReadWrite,
+        bool owns_pipe = false
+    );
 
     FdResult<u64> GetOffset(const OpenFileEntry *entry) const;
     FdResult<> SetOffset(OpenFileEntry *entry, u64 offset) const;
@@ -299,14 +312,75 @@ class FdManager
     FdResult<size_t> Read(fd_t fd, std::span<byte> buffer);
     FdResult<size_t> Write(fd_t fd, std::span<const byte> buffer);
     FdResult<ssize_t> Seek(fd_t fd, ssize_t offset, FdSeek whence);
+
+    /**
+     * @brief Scatter/gather variants, transferring every vector in order in a single call.
+     * Stop at the first short transfer and advance the shared offset by the total. The vector
+     * array itself must be kernel memory, callers copy user arrays in first.
+     */
+    FdResult<size_t> ReadV(fd_t fd, std::span<const IoVec> iov);
+    FdResult<size_t> WriteV(fd_t fd, std::span<const IoVec> iov);
+
+    /**
+     * @brief Positional variants, neither using nor updating the shared offset of the
+     * descriptor. Only valid for files.
+     */
+    FdResult<size_t> PRead(fd_t fd, std::span<byte> buffer, u64 offset);
+    FdResult<size_t> PWrite(fd_t fd, std::span<const byte> buffer, u64 offset);
+
+    /**
+     * @brief Move up to count bytes from in_fd to out_fd without a round trip through user
+     * space. File data is written straight from its cached pages, pipe data straight from the
+     * pipe buffer. Only the first transfer from a pipe may block, like in ReadV().
+     * @return Number of bytes moved, 0 at the end of the input
+     */
+    FdResult<size_t> Splice(fd_t in_fd, fd_t out_fd, size_t count);
+
+    /**
+     * @brief Splice() from a file at the given position, advanced past the data moved. The
+     * shared offset of in_fd is neither used nor updated.
+     */
+    FdResult<size_t> SendFile(fd_t out_fd, fd_t in_fd, u64 &offset, size_t count);
+
     FdResult<fd_t> Duplicate(fd_t fd);
     FdResult<fd_t> Duplicate(fd_t old_fd, fd_t new_fd);
 
+    /**
+     * @brief Create an anonymous pipe, fds[0] becomes the read end and fds[1] the write end.
+     * Only OpenMode::kNonBlock is accepted in flags, it applies to both ends.
+     */
+    FdResult<> CreatePipe(fd_t (&fds)[2], OpenMode flags);
+
+    /**
+     * @brief Wait until at least one of the descriptors is ready or the timeout expires.
+     * Fills revents of every entry and returns the number of entries with non-zero revents.
+     * @param timeout_ns Negative waits without limit, zero only checks the current state
+     */
+    FdResult<size_t> Poll(std::span<PollFd> fds, i64 timeout_ns);
+
     FileTable &GetFileTable() { return file_table_; }
     OpenFileTable &GetOpenFileTable() { return open_file_table_; }
     FdTable *GetCurrentProcessFdTable();
 
     private:
+    FdResult<OpenFileEntry *> GetEntry_(fd_t fd, OpenMode access);
+    FdResult<size_t> ReadAt_(
+        OpenFileEntry &entry, std::span<byte> buffer, u64 offset, bool may_block = true
+    );
+    FdResult<size_t> WriteAt_(OpenFileEntry &entry, std::span<const byte> buffer, u64 offset);
+    FdResult<size_t> WriteShared_(OpenFileEntry &entry, std::span<const byte> buffer);
+
+    // Pipes copy with interrupts disabled, so callers' buffers go through a kernel bounce buffer
+    static FdResult<size_t> ReadPipe_(
+        IO::Pipe<kStdioBufferSize> &pipe, std::span<byte> buffer, bool block
+    );
+    static FdResult<size_t> WritePipe_(
+        IO::Pipe<kStdioBufferSize> &pipe, std::span<const byte> buffer, bool block
+    );
+    FdResult<size_t> Transfer_(OpenFileEntry &in, OpenFileEntry &out, u64 in_offset, size_t count);
+    static bool ValidateIoVecs_(std::span<const IoVec> iov);
+    static u16 PollEntry_(const OpenFileEntry *entry, u16 events);
+
     FileTable file_table_;
     OpenFileTable open_file_table_;
 };
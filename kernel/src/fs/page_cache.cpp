@@ -0,0 +1,701 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025-2026 The AlkOS Authors
+// See the AUTHORS file for the full list of contributors.
+
+#include "page_cache.hpp"
+
+#include <string.h>
+
+#include "mem/virt/user_access.hpp"
+#include "modules/memory.hpp"
+#include "modules/scheduling.hpp"
+#include "modules/timing.hpp"
+#include "mutex.hpp"
+#include "template/scope_guard.hpp"
+#include "scheduling/local_lock.hpp"
+#include "scheduling/thread.hpp"
+#include "trace_framework.hpp"
+#include "vfs.hpp"
+
+namespace Fs
+{
+
+// ============================================================================
+// Construction
+// ============================================================================
+
+PageCache::PageCache()
+{
+    for (auto &bucket : buckets_) {
+        bucket = kNoPage;
+    }
+
+    const auto buffer = Mem::KMalloc(kPageCacheMaxWritebackRun * kPageSize);
+    R_ASSERT_TRUE(buffer.has_value(), "Failed to allocate page cache write-back buffer");
+    writeback_buffer_ = static_cast<byte *>(buffer.value());
+
+    const auto wq = Mem::KNew<Sched::WaitQueue<Sched::Thread, Sched::kWaitQueueIntrusiveLevel>>();
+    R_ASSERT_TRUE(wq.has_value(), "Failed to allocate page cache flusher wait queue");
+    flusher_wq_ = wq.value();
+
+    const auto io = Mem::KNew<Sched::WaitQueue<Sched::Thread, Sched::kWaitQueueIntrusiveLevel>>();
+    R_ASSERT_TRUE(io.has_value(), "Failed to allocate page cache I/O wait queue");
+    io_wq_ = io.value();
+}
+
+// ============================================================================
+// Public interface
+// ============================================================================
+
+FdResult<size_t> PageCache::Read(File &file, std::span<byte> buffer, const u64 offset)
+{
+    u64 size;
+    {
+        LocalCoreLock core_lock{};
+        std::lock_guard lock(lock_);
+        size = file.size;
+    }
+
+    if (offset >= size) {
+        return 0;
+    }
+
+    const size_t to_read = std::min<u64>(buffer.size(), size - offset);
+
+    size_t done = 0;
+    while (done < to_read) {
+        const u64 pos        = offset + done;
+        const size_t in_page = pos % kPageSize;
+        const size_t chunk   = std::min(kPageSize - in_page, to_read - done);
+
+        const auto slot = PinPage_(file, pos / kPageSize, Access::kRead);
+        RET_UNEXPECTED_IF_ERR(slot);
+
+        // The buffer may be user memory backed by a mapped file, so the copy runs without the
+        // cache lock and faults fail it instead of the kernel
+        const auto copied = Mem::CopyToCaller(buffer.data() + done, Data_(*slot) + in_page, chunk);
+
+        {
+            LocalCoreLock core_lock{};
+            std::lock_guard lock(lock_);
+            Unpin_(*slot, false);
+        }
+
+        if (!copied) {
+            // Report the data already transferred, the error surfaces on the next call
+            RET_UNEXPECTED_IF(done == 0, FdError::kInvalidArgument);
+            break;
+        }
+        done += chunk;
+    }
+
+    return done;
+}
+
+FdResult<size_t> PageCache::Write(
+    File &file, std::span<const byte> buffer, const u64 offset, const bool write_through
+)
+{
+    // Whole pages are copied in before their page is pinned, the source may be a mapping of that
+    // very page, whose fault has to read it in. A page allocated for the overwrite takes over the
+    // staging frame instead of being copied to.
+    auto &buddy                        = MemoryModule::Get().GetBuddyPmm();
+    Mem::PPtr<Mem::Page> staging_frame = nullptr;
+    template_lib::ScopeGuard free_staging([&]() {
+        if (staging_frame != nullptr) {
+            buddy.Free(staging_frame);
+        }
+    });
+
+    size_t done = 0;
+    while (done < buffer.size()) {
+        const u64 pos         = offset + done;
+        const size_t in_page  = pos % kPageSize;
+        const size_t chunk    = std::min(kPageSize - in_page, buffer.size() - done);
+        const bool whole_page = in_page == 0 && chunk == kPageSize;
+
+        FdResult<u16> slot;
+        if (whole_page) {
+            if (staging_frame == nullptr) {
+                const auto frame = buddy.Alloc({.order = 0});
+                RET_UNEXPECTED_IF(!frame, FdError::kIoError);
+                staging_frame = *frame;
+            }
+
+            byte *staging = reinterpret_cast<byte *>(Mem::PhysToVirt(staging_frame));
+            if (!Mem::CopyFromCaller(staging, buffer.data() + done, chunk)) {
+                RET_UNEXPECTED_IF(done == 0, FdError::kInvalidArgument);
+                break;
+            }
+
+            slot = PinPage_(file, pos / kPageSize, Access::kOverwrite);
+            RET_UNEXPECTED_IF_ERR(slot);
+
+            // A page allocated for the overwrite stays busy and unseen until it is unpinned
+            if (pages_[*slot].busy) {
+                std::swap(pages_[*slot].frame, staging_frame);
+            } else {
+                memcpy(Data_(*slot), staging, kPageSize);
+            }
+        } else {
+            slot = PinPage_(file, pos / kPageSize, Access::kRead);
+            RET_UNEXPECTED_IF_ERR(slot);
+
+            // The page is read in and not busy, so a fault of the copy on it only pins it again
+            if (!Mem::CopyFromCaller(Data_(*slot) + in_page, buffer.data() + done, chunk)) {
+                // The page may be partially overwritten
+                LocalCoreLock core_lock{};
+                std::lock_guard lock(lock_);
+                Unpin_(*slot, true);
+
+                RET_UNEXPECTED_IF(done == 0, FdError::kInvalidArgument);
+                break;
+            }
+        }
+        done += chunk;
+
+        // Grow the file before the page turns dirty, so that a write-back never clips it
+        LocalCoreLock core_lock{};
+        std::lock_guard lock(lock_);
+        file.size = std::max(file.size, pos + chunk);
+        Unpin_(*slot, true);
+    }
+
+    if (write_through) {
+        // Synchronous writes are written back from the cache as well, so the filesystem never
+        // reads the caller's buffer
+        RET_UNEXPECTED_IF_ERR(Flush_(&file));
+        return done;
+    }
+
+    LocalCoreLock core_lock{};
+    std::lock_guard lock(lock_);
+    if (dirty_count_ >= kPageCacheDirtyHighWater) {
+        // Hand the write-back to the flusher instead of stalling the writer on it
+        SchedulingModule::Get().GetScheduler().ReleaseAll(flusher_wq_);
+    }
+
+    return done;
+}
+
+FdResult<std::span<const byte>> PageCache::Pin(
+    File &file, const u64 offset, const size_t max_size
+)
+{
+    u64 size;
+    {
+        LocalCoreLock core_lock{};
+        std::lock_guard lock(lock_);
+        size = file.size;
+    }
+
+    if (offset >= size || max_size == 0) {
+        return std::span<const byte>{};
+    }
+
+    const size_t in_page = offset % kPageSize;
+    const size_t in_file = std::min<u64>(kPageSize - in_page, size - offset);
+    const size_t length  = std::min(in_file, max_size);
+
+    const auto slot = PinPage_(file, offset / kPageSize, Access::kRead);
+    RET_UNEXPECTED_IF_ERR(slot);
+
+    return std::span<const byte>(Data_(*slot) + in_page, length);
+}
+
+void PageCache::Unpin(File &file, const u64 offset)
+{
+    LocalCoreLock core_lock{};
+    std::lock_guard lock(lock_);
+
+    const u16 slot = Find_(&file, offset / kPageSize);
+    ASSERT_NEQ(slot, kNoPage);
+    Unpin_(slot, false);
+}
+
+FdResult<> PageCache::Flush(File &file) { return Flush_(&file); }
+
+void PageCache::Evict(File &file)
+{
+    // Hold write-back ownership until the pages are gone, so the flusher cannot pick them up
+    AcquireWriteback_();
+
+    if (const auto result = Writeback_(&file); !result) {
+        TRACE_WARN_VFS("Failed to write back %s, dropping dirty pages", file.path.CString());
+    }
+
+    {
+        LocalCoreLock core_lock{};
+        std::lock_guard lock(lock_);
+
+        ASSERT_ZERO(file.map_count);
+        for (u16 slot = 0; slot < kPageCacheSize; ++slot) {
+            if (pages_[slot].file == &file) {
+                Drop_(slot);
+            }
+        }
+    }
+
+    ReleaseWriteback_();
+}
+
+FdResult<Mem::PPtr<Mem::Page>> PageCache::GetFrame(File &file, const u64 index, const bool dirty)
+{
+    const auto slot = PinPage_(file, index, Access::kRead);
+    RET_UNEXPECTED_IF_ERR(slot);
+
+    LocalCoreLock core_lock{};
+    std::lock_guard lock(lock_);
+
+    // Pages of mapped files are never reclaimed, so the frame outlives the pin
+    Unpin_(*slot, dirty);
+    return pages_[*slot].frame;
+}
+
+Mem::PPtr<Mem::Page> PageCache::FindFrame(File &file, const u64 index) const
+{
+    LocalCoreLock core_lock{};
+    std::lock_guard lock(lock_);
+
+    const u16 slot = Find_(&file, index);
+    return slot != kNoPage ? pages_[slot].frame : nullptr;
+}
+
+void PageCache::MarkDirty(File &file, const u64 first_index, const size_t count)
+{
+    LocalCoreLock core_lock{};
+    std::lock_guard lock(lock_);
+
+    for (u64 index = first_index; index < first_index + count; ++index) {
+        if (const u16 slot = Find_(&file, index); slot != kNoPage && !pages_[slot].busy) {
+            MarkDirty_(slot);
+        }
+    }
+}
+
+void PageCache::AddMapping(File &file)
+{
+    LocalCoreLock core_lock{};
+    std::lock_guard lock(lock_);
+
+    ++file.map_count;
+}
+
+void PageCache::RemoveMapping(File &file)
+{
+    LocalCoreLock core_lock{};
+    std::lock_guard lock(lock_);
+
+    ASSERT_NOT_ZERO(file.map_count);
+    --file.map_count;
+}
+
+void PageCache::FlusherWork()
+{
+    auto &scheduler = SchedulingModule::Get().GetScheduler();
+
+    {
+        LocalCoreLock core_lock{};
+        if (dirty_count_ == 0) {
+            scheduler.BlockOnWaitQueue(flusher_wq_);
+        }
+    }
+
+    {
+        // Let subsequent writes land in the same pages before writing them back. Writers that
+        // cross the high-water mark release the queue early.
+        LocalCoreLock core_lock{};
+        if (dirty_count_ < kPageCacheDirtyHighWater) {
+            const u64 now = TimingModule::Get().GetSystemTime().ReadLifeTimeNs();
+            scheduler.BlockOnWaitQueueUntil(flusher_wq_, now + kPageCacheWritebackDelayNs);
+        }
+    }
+
+    TRACE_FREQ_INFO_VFS("Page cache write-back of %zu dirty pages", dirty_count_);
+    if (const auto result = Flush_(nullptr); !result) {
+        TRACE_WARN_VFS("Page cache write-back failed");
+    }
+}
+
+// ============================================================================
+// Lookup
+// ============================================================================
+
+size_t PageCache::Bucket_(const File *file, const u64 index)
+{
+    const u64 key = (Mem::PtrToUptr(file) >> 4) ^ (index * 0x9E3779B97F4A7C15ULL);
+    return static_cast<size_t>(key ^ (key >> 32)) % kPageCacheBuckets;
+}
+
+u16 PageCache::Find_(const File *file, const u64 index) const
+{
+    u16 slot = buckets_[Bucket_(file, index)];
+    while (slot != kNoPage) {
+        if (pages_[slot].file == file && pages_[slot].index == index) {
+            return slot;
+        }
+        slot = pages_[slot].next;
+    }
+    return kNoPage;
+}
+
+void PageCache::Link_(const u16 slot)
+{
+    const size_t bucket = Bucket_(pages_[slot].file, pages_[slot].index);
+    pages_[slot].next   = buckets_[bucket];
+    buckets_[bucket]    = slot;
+}
+
+void PageCache::Unlink_(const u16 slot)
+{
+    u16 *link = &buckets_[Bucket_(pages_[slot].file, pages_[slot].index)];
+    while (*link != slot) {
+        ASSERT_NEQ(*link, kNoPage);
+        link = &pages_[*link].next;
+    }
+    *link             = pages_[slot].next;
+    pages_[slot].next = kNoPage;
+}
+
+// ============================================================================
+// Allocation
+// ============================================================================
+
+FdResult<u16> PageCache::PinPage_(File &file, const u64 index, const Access access)
+{
+    auto &scheduler = SchedulingModule::Get().GetScheduler();
+
+    u16 slot = kNoPage;
+    for (bool written_back = false;;) {
+        {
+            LocalCoreLock core_lock{};
+            bool busy = false;
+            {
+                std::lock_guard lock(lock_);
+
+                if (const u16 cached = Find_(&file, index); cached != kNoPage) {
+                    CachedPage &page = pages_[cached];
+                    if (!page.busy) {
+                        page.referenced = true;
+                        ++page.pins;
+                        return cached;
+                    }
+                    busy = true;
+                } else if (slot = AllocSlot_(); slot != kNoPage) {
+                    // Others wait until the contents are valid
+                    CachedPage &page = pages_[slot];
+                    page.file        = &file;
+                    page.index       = index;
+                    page.pins        = 1;
+                    page.busy        = true;
+                    page.dirty       = false;
+                    page.referenced  = true;
+                    Link_(slot);
+                    ++cached_count_;
+                }
+            }
+
+            if (busy) {
+                scheduler.BlockOnWaitQueue(io_wq_);
+                continue;
+            }
+        }
+
+        if (slot != kNoPage) {
+            break;
+        }
+
+        // Every page is dirty, pinned or mapped: write back and retry once
+        RET_UNEXPECTED_IF(written_back, FdError::kIoError);
+        TRACE_INFO_VFS("Page cache exhausted by dirty pages, forcing write-back");
+        RET_UNEXPECTED_IF_ERR(Flush_(nullptr));
+        written_back = true;
+    }
+
+    if (access == Access::kOverwrite) {
+        return slot;
+    }
+
+    const auto filled = Fill_(slot);
+
+    LocalCoreLock core_lock{};
+    std::lock_guard lock(lock_);
+
+    if (!filled) {
+        Unpin_(slot, false);
+        Drop_(slot);
+        return std::unexpected(FdError::kIoError);
+    }
+
+    pages_[slot].busy = false;
+    scheduler.ReleaseAll(io_wq_);
+    return slot;
+}
+
+void PageCache::Unpin_(const u16 slot, const bool dirty)
+{
+    CachedPage &page = pages_[slot];
+    ASSERT_NOT_ZERO(page.pins);
+    --page.pins;
+
+    if (page.busy) {
+        page.busy = false;
+        SchedulingModule::Get().GetScheduler().ReleaseAll(io_wq_);
+    }
+
+    if (dirty) {
+        MarkDirty_(slot);
+    }
+}
+
+u16 PageCache::AllocSlot_()
+{
+    if (cached_count_ < kPageCacheSize) {
+        for (u16 slot = 0; slot < kPageCacheSize; ++slot) {
+            CachedPage &page = pages_[slot];
+            if (page.file != nullptr) {
+                continue;
+            }
+
+            if (page.frame == nullptr) {
+                auto frame = MemoryModule::Get().GetBuddyPmm().Alloc({.order = 0});
+                if (!frame) {
+                    // Out of physical memory: reclaim cached pages instead of growing
+                    break;
+                }
+                page.frame = *frame;
+            }
+            return slot;
+        }
+    }
+
+    // Second-chance scan over clean pages of unmapped files
+    for (size_t step = 0; step < 2 * kPageCacheSize; ++step) {
+        const auto slot = static_cast<u16>(clock_hand_);
+        clock_hand_     = (clock_hand_ + 1) % kPageCacheSize;
+
+        CachedPage &page = pages_[slot];
+        if (page.file == nullptr || page.dirty || page.pins > 0 || page.file->map_count > 0) {
+            continue;
+        }
+
+        if (page.referenced) {
+            page.referenced = false;
+            continue;
+        }
+
+        Drop_(slot);
+        return slot;
+    }
+
+    return kNoPage;
+}
+
+FdResult<> PageCache::Fill_(const u16 slot)
+{
+    // The page is pinned and busy, nobody else touches it
+    CachedPage &page = pages_[slot];
+    byte *data       = Data_(slot);
+    const u64 start  = page.index * kPageSize;
+
+    size_t valid = 0;
+    if (start < page.file->backing_size) {
+        valid = std::min<u64>(kPageSize, page.file->backing_size - start);
+
+        const auto result = vfs::ReadFile(page.file->path, data, valid, start);
+        RET_UNEXPECTED_IF(!result, FdError::kIoError);
+        valid = *result;
+    }
+
+    memset(data + valid, 0, kPageSize - valid);
+    return {};
+}
+
+void PageCache::Drop_(const u16 slot)
+{
+    CachedPage &page = pages_[slot];
+    ASSERT_NOT_NULL(page.file);
+    ASSERT_ZERO(page.pins);
+
+    Unlink_(slot);
+    if (page.dirty) {
+        --dirty_count_;
+    }
+
+    page.file       = nullptr;
+    page.busy       = false;
+    page.dirty      = false;
+    page.referenced = false;
+    --cached_count_;
+}
+
+// ============================================================================
+// Write-back
+// ============================================================================
+
+void PageCache::MarkDirty_(const u16 slot)
+{
+    if (pages_[slot].dirty) {
+        return;
+    }
+
+    pages_[slot].dirty = true;
+    if (dirty_count_++ == 0) {
+        SchedulingModule::Get().GetScheduler().ReleaseAll(flusher_wq_);
+    }
+}
+
+void PageCache::AcquireWriteback_()
+{
+    auto &scheduler = SchedulingModule::Get().GetScheduler();
+    LocalCoreLock core_lock{};
+
+    while (true) {
+        {
+            std::lock_guard lock(lock_);
+            if (!writeback_active_) {
+                writeback_active_ = true;
+                return;
+            }
+        }
+        scheduler.BlockOnWaitQueue(io_wq_);
+    }
+}
+
+void PageCache::ReleaseWriteback_()
+{
+    LocalCoreLock core_lock{};
+    std::lock_guard lock(lock_);
+
+    ASSERT_TRUE(writeback_active_);
+    writeback_active_ = false;
+    SchedulingModule::Get().GetScheduler().ReleaseAll(io_wq_);
+}
+
+FdResult<> PageCache::Flush_(File *file)
+{
+    AcquireWriteback_();
+    const auto result = Writeback_(file);
+    ReleaseWriteback_();
+
+    return result;
+}
+
+FdResult<> PageCache::Writeback_(File *file)
+{
+    u16 cursor = 0;
+    u16 next   = kNoPage;
+
+    while (true) {
+        File *run_file     = nullptr;
+        u64 start          = 0;
+        size_t count       = 0;
+        size_t length      = 0;
+        const byte *source = nullptr;
+
+        {
+            LocalCoreLock core_lock{};
+            std::lock_guard lock(lock_);
+
+            const u16 first =
+                next != kNoPage && pages_[next].dirty ? next : FindRunStart_(file, cursor);
+            if (first == kNoPage) {
+                return {};
+            }
+
+            count    = CollectRun_(first, next);
+            run_file = pages_[first].file;
+            start    = pages_[first].index * kPageSize;
+
+            if (start < run_file->size) {
+                length = std::min<u64>(count * kPageSize, run_file->size - start);
+
+                // A single page can be written straight from the frame
+                source = Data_(first);
+                if (count > 1) {
+                    for (size_t i = 0; i < count; ++i) {
+                        memcpy(
+                            writeback_buffer_ + i * kPageSize, Data_(writeback_slots_[i]), kPageSize
+                        );
+                    }
+                    source = writeback_buffer_;
+                }
+            }
+        }
+
+        // Pages redirtied during the call stay dirty for the next write-back
+        bool written = true;
+        if (length > 0) {
+            const auto result = vfs::WriteFile(run_file->path, source, length, start);
+            written           = result && *result == length;
+        }
+
+        {
+            LocalCoreLock core_lock{};
+            std::lock_guard lock(lock_);
+
+            for (size_t i = 0; i < count; ++i) {
+                Unpin_(writeback_slots_[i], !written);
+            }
+
+            if (written) {
+                run_file->backing_size = std::max(run_file->backing_size, start + length);
+            }
+        }
+
+        RET_UNEXPECTED_IF(!written, FdError::kIoError);
+    }
+}
+
+u16 PageCache::FindRunStart_(const File *file, u16 &cursor) const
+{
+    for (; cursor < kPageCacheSize; ++cursor) {
+        const CachedPage &page = pages_[cursor];
+        if (!page.dirty || (file != nullptr && page.file != file)) {
+            continue;
+        }
+
+        // A page following a dirty one is written back with the run that starts there
+        if (page.index > 0) {
+            const u16 prev = Find_(page.file, page.index - 1);
+            if (prev != kNoPage && pages_[prev].dirty) {
+                continue;
+            }
+        }
+
+        return cursor++;
+    }
+
+    return kNoPage;
+}
+
+size_t PageCache::CollectRun_(const u16 first, u16 &next)
+{
+    // Follow the run by page index through the hash table, no sorting needed
+    File *file      = pages_[first].file;
+    const u64 index = pages_[first].index;
+
+    size_t count = 0;
+    next         = first;
+    while (next != kNoPage && pages_[next].dirty && count < kPageCacheMaxWritebackRun) {
+        writeback_slots_[count++] = next;
+        next                      = Find_(file, index + count);
+    }
+
+    // Pin the run for the filesystem call and clear it, writers redirty it meanwhile
+    for (size_t i = 0; i < count; ++i) {
+        CachedPage &page = pages_[writeback_slots_[i]];
+        ++page.pins;
+        page.dirty = false;
+    }
+    dirty_count_ -= count;
+
+    // A run cut at the length limit continues in the next call
+    if (next != kNoPage && !pages_[next].dirty) {
+        next = kNoPage;
+    }
+
+    return count;
+}
+
+}  // namespace Fs
@@ -0,0 +1,230 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025-2026 The AlkOS Authors
+// See the AUTHORS file for the full list of contributors.
+
+#ifndef KERNEL_SRC_FS_PAGE_CACHE_HPP_
+#define KERNEL_SRC_FS_PAGE_CACHE_HPP_
+
+#include <types.h>
+#include <span.hpp>
+
+#include "fs/costants.hpp"
+#include "fs/file_descriptor.hpp"
+#include "hal/constants.hpp"
+#include "mem/page.hpp"
+#include "mem/types.hpp"
+#include "scheduling/wait_queue.hpp"
+#include "sync/spinlock.hpp"
+
+namespace Sched
+{
+struct Thread;
+}  // namespace Sched
+
+namespace Fs
+{
+
+// ------------------------------
+// Page Cache
+// -----------------------------
+
+/**
+ * @brief Write-back cache of file data, keyed by (File, page index).
+ *
+ * Reads and non-synchronous writes are served from cached pages. Written pages are only marked
+ * dirty and are written back in coalesced runs (one filesystem call per run of consecutive
+ * dirty pages) by the flusher kworker after kPageCacheWritebackDelayNs, or right away once the
+ * number of dirty pages crosses kPageCacheDirtyHighWater. Only a thread that cannot reclaim a
+ * clean page writes back synchronously.
+ *
+ * The cache lock only guards the page table. Copies from and to callers' buffers, which may be
+ * user memory backed by mapped files, and filesystem I/O run without it on pinned pages. User
+ * buffers are only accessed through the fault-tolerant user copy. A page being read in is marked
+ * busy and other users of it wait on an internal wait queue until the read completes. Write-backs
+ * are serialized, as they share one coalescing buffer.
+ *
+ * The flusher blocks on an internal wait queue while the cache holds no dirty pages and is
+ * released by the write that dirties the first one.
+ */
+class PageCache
+{
+    static constexpr size_t kPageSize = hal::kPageSizeBytes;
+    static constexpr u16 kNoPage      = std::numeric_limits<u16>::max();
+
+    static_assert(kPageCacheSize < kNoPage);
+
+    enum class Access : u8 {
+        kRead,       ///< Read a missing page in from the file
+        kOverwrite,  ///< The caller overwrites the whole page, a missing page is not read in
+    };
+
+    struct CachedPage {
+        File *file{nullptr};
+        u64 index{0};
+        Mem::PPtr<Mem::Page> frame{nullptr};
+        u16 next{kNoPage};
+        u16 pins{0};
+        bool busy{false};
+        bool dirty{false};
+        bool referenced{false};
+    };
+
+    public:
+    PageCache();
+    ~PageCache() = default;
+
+    PageCache(const PageCache &)            = delete;
+    PageCache &operator=(const PageCache &) = delete;
+    PageCache(PageCache &&)                 = delete;
+    PageCache &operator=(PageCache &&)      = delete;
+
+    /**
+     * @brief Read file data through the cache.
+     *
+     * @return Number of bytes read, limited by the logical file size
+     */
+    FdResult<size_t> Read(File &file, std::span<byte> buffer, u64 offset);
+
+    /**
+     * @brief Write file data through the cache.
+     *
+     * @param write_through When set, the dirty pages of the file are written back before
+     *                      returning (OpenMode::kSync semantics)
+     * @return Number of bytes written
+     */
+    FdResult<size_t> Write(
+        File &file, std::span<const byte> buffer, u64 offset, bool write_through
+    );
+
+    /**
+     * @brief Pin the cached page holding offset and expose its data in place, up to the end of
+     * the page, the logical file size or max_size. A pinned page is never reclaimed and the
+     * cache lock is not held, so the data can be handed straight to another file or a pipe.
+     * Every successful call must be paired with Unpin() of the same offset.
+     *
+     * @return Empty span at end of file, nothing is pinned then
+     */
+    FdResult<std::span<const byte>> Pin(File &file, u64 offset, size_t max_size);
+    void Unpin(File &file, u64 offset);
+
+    /**
+     * @brief Write back all dirty pages of the given file.
+     */
+    FdResult<> Flush(File &file);
+
+    /**
+     * @brief Write back and drop all pages of the given file. Called when the file is released.
+     */
+    void Evict(File &file);
+
+    // ------------------------------
+    // Memory mappings
+    // ------------------------------
+
+    /**
+     * @brief Get the physical frame caching the given page of the file, reading it in if needed.
+     *
+     * @param dirty Mark the page dirty, for pages mapped writable into shared mappings
+     */
+    FdResult<Mem::PPtr<Mem::Page>> GetFrame(File &file, u64 index, bool dirty);
+
+    /**
+     * @brief Get the physical frame caching the given page of the file, without reading it in.
+     *
+     * @return nullptr when the page is not cached
+     */
+    NODISCARD Mem::PPtr<Mem::Page> FindFrame(File &file, u64 index) const;
+
+    /**
+     * @brief Mark the cached pages in [first_index, first_index + count) dirty. Used for shared
+     * writable mappings, as stores through the mapping are not tracked.
+     */
+    void MarkDirty(File &file, u64 first_index, size_t count);
+
+    void AddMapping(File &file);
+    void RemoveMapping(File &file);
+
+    /**
+     * @brief Flusher kworker body: blocks until dirty pages exist, waits for the write-back delay
+     * so that consecutive writes coalesce, unless writers already crossed the high-water mark,
+     * then writes back every dirty page.
+     */
+    void FlusherWork();
+
+    NODISCARD size_t GetDirtyCount() const { return dirty_count_; }
+    NODISCARD size_t GetCachedCount() const { return cached_count_; }
+
+    private:
+    // ------------------------------
+    // Lookup
+    // ------------------------------
+
+    NODISCARD static size_t Bucket_(const File *file, u64 index);
+    NODISCARD u16 Find_(const File *file, u64 index) const;
+    void Link_(u16 slot);
+    void Unlink_(u16 slot);
+
+    // ------------------------------
+    // Allocation
+    // ------------------------------
+
+    /**
+     * @brief Find or allocate the page and pin it. Takes the cache lock, which must not be held.
+     * A page allocated with Access::kOverwrite stays busy until it is unpinned.
+     */
+    FdResult<u16> PinPage_(File &file, u64 index, Access access);
+
+    /**
+     * @brief Drop a pin taken by PinPage_(), called with the cache lock held.
+     */
+    void Unpin_(u16 slot, bool dirty);
+
+    NODISCARD u16 AllocSlot_();
+    FdResult<> Fill_(u16 slot);
+    void Drop_(u16 slot);
+
+    // ------------------------------
+    // Write-back
+    // ------------------------------
+
+    void MarkDirty_(u16 slot);
+    void AcquireWriteback_();
+    void ReleaseWriteback_();
+
+    /**
+     * @brief Take write-back ownership and write back the dirty pages of the file, or of all
+     * files when file is nullptr. Neither lock may be held.
+     */
+    FdResult<> Flush_(File *file);
+
+    /**
+     * @brief Flush_() body, requires write-back ownership. The cache lock is only taken to collect
+     * each run and to settle it after the filesystem call.
+     */
+    FdResult<> Writeback_(File *file);
+
+    NODISCARD u16 FindRunStart_(const File *file, u16 &cursor) const;
+    size_t CollectRun_(u16 first, u16 &next);
+
+    NODISCARD FORCE_INLINE_F byte *Data_(const u16 slot) const
+    {
+        return reinterpret_cast<byte *>(Mem::PhysToVirt(pages_[slot].frame));
+    }
+
+    CachedPage pages_[kPageCacheSize]{};
+    u16 buckets_[kPageCacheBuckets]{};
+    size_t clock_hand_{0};
+    size_t cached_count_{0};
+    size_t dirty_count_{0};
+
+    u16 writeback_slots_[kPageCacheMaxWritebackRun]{};
+    byte *writeback_buffer_{nullptr};
+    bool writeback_active_{false};
+    Sched::WaitQueue<Sched::Thread, 3> *flusher_wq_{nullptr};
+    Sched::WaitQueue<Sched::Thread, 3> *io_wq_{nullptr};
+    mutable Spinlock lock_;
+};
+
+}  // namespace Fs
+
+#endif  // KERNEL_SRC_FS_PAGE_CACHE_HPP_
@@ -26,6 +26,7 @@ enum class VfsError {
     kReadOnly,
     kDiskFull,
     kCrossFilesystemRename,
+    kNoMemory,
     kUnknownError,
 };
 
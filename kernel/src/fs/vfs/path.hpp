@@ -5,11 +5,16 @@
 #ifndef KERNEL_SRC_FS_VFS_PATH_HPP_
 #define KERNEL_SRC_FS_VFS_PATH_HPP_
 
-#include <array.hpp>
+#include <string.h>
+#include <algorithm.hpp>
+#include <bits_ext.hpp>
 #include <concepts.hpp>
+#include <limits.hpp>
 #include <string.hpp>
 #include <type_traits.hpp>
 
+#include "mem/heap.hpp"
+
 namespace vfs
 {
 
@@ -17,8 +22,11 @@ namespace vfs
 inline constexpr size_t kMaxPathSize      = 1024;
 inline constexpr size_t kMaxComponents    = 64;
 inline constexpr size_t kMaxComponentSize = 128;
+inline constexpr size_t kInlinePathSize   = 96;
 inline constexpr char kPathSeparator      = '/';
 
+static_assert(kMaxPathSize <= std::numeric_limits<u16>::max());
+
 // Concepts
 template <typename T>
 concept PathStringLike = std::convertible_to<T, std::string_view>;
@@ -28,23 +36,29 @@ concept PathComponentCallback = requires(Callback cb, std::string_view sv) {
     { cb(sv) } -> std::same_as<void>;
 };
 
+class Path;
+
+/**
+ * @brief Why a Path lacks part of what it was built from. Such a path must not be used.
+ */
+enum class PathError : u8 {
+    kNone,
+    kTooLong,   ///< Longer than kMaxPathSize or made of more than kMaxComponents components
+    kNoMemory,  ///< The heap buffer of a long path could not be allocated
+};
+
 // Path component const iterator
 class PathIterator
 {
     public:
     using value_type      = std::string_view;
     using difference_type = std::ptrdiff_t;
-    using pointer         = const std::string_view *;
-    using reference       = const std::string_view &;
+    using reference       = std::string_view;
 
     PathIterator() = delete;
-    PathIterator(const std::array<std::string_view, kMaxComponents> &components, size_t index)
-        : components_(components), index_(index)
-    {
-    }
+    PathIterator(const Path &path, size_t index) : path_(&path), index_(index) {}
 
-    reference operator*() const { return components_[index_]; }
-    pointer operator->() const { return &components_[index_]; }
+    reference operator*() const;
 
     PathIterator &operator++()
     {
@@ -60,63 +74,88 @@ class PathIterator
 
     bool operator==(const PathIterator &other) const
     {
-        return components_ == other.components_ && index_ == other.index_;
+        return path_ == other.path_ && index_ == other.index_;
     }
 
     private:
-    const std::array<std::string_view, kMaxComponents> &components_;
+    const Path *path_;
     size_t index_ = 0;
 };
 
+/**
+ * @brief Compact file system path.
+ *
+ * The path string and a table of (offset, length) pairs locating its components share a single
+ * buffer: characters grow from the front and the component table from the back. Short paths
+ * fit into the inline buffer, longer ones are moved to the kernel heap, so a Path is cheap to
+ * build on the stack and moving a long one only steals the pointer.
+ *
+ * The string is kept in canonical form (single separators, no trailing separator) and its hash
+ * is cached, so equality checks of unrelated paths usually stop at the hash.
+ *
+ * Paths are never silently truncated: a path that exceeds the limits or fails to allocate keeps
+ * what fit and reports why through GetError(), and paths derived from it inherit the error.
+ */
 class Path
 {
+    struct Component {
+        u16 offset;
+        u16 length;
+    };
+
     public:
     static const Path kCurrentDir;
     static const Path kParentDir;
     static const Path kRoot;
 
-    Path() = default;
+    Path() { Seal_(); }
 
     template <PathStringLike T>
     explicit Path(T &&path_str)
     {
         std::string_view sv(std::forward<T>(path_str));
-        path_len_ = std::min(sv.length(), kMaxPathSize - 1);
-        strncpy(raw_path_.data(), sv.data(), path_len_);
-        raw_path_[path_len_] = '\0';
-        Parse();
-    }
+        if (sv.length() >= kMaxPathSize) {
+            sv     = sv.substr(0, kMaxPathSize - 1);
+            error_ = PathError::kTooLong;
+        }
 
-    Path(const Path &other)
-    {
-        raw_path_ = other.raw_path_;
-        path_len_ = other.path_len_;
-        Parse();
+        Reset_(!sv.empty() && sv[0] == kPathSeparator);
+
+        size_t pos = is_absolute_ ? 1 : 0;
+        while (pos < sv.size()) {
+            size_t next_sep = sv.find(kPathSeparator, pos);
+            if (next_sep == std::string_view::npos) {
+                next_sep = sv.size();
+            }
+
+            if (next_sep > pos && !Append_(sv.substr(pos, next_sep - pos))) {
+                break;
+            }
+
+            pos = next_sep + 1;
+        }
+
+        Seal_();
     }
 
+    ~Path() { FreeHeap_(); }
+
+    Path(const Path &other) { CopyFrom_(other); }
+
     Path &operator=(const Path &other)
     {
         if (this != &other) {
-            raw_path_ = other.raw_path_;
-            path_len_ = other.path_len_;
-            Parse();
+            CopyFrom_(other);
         }
         return *this;
     }
 
-    Path(Path &&other) noexcept
-    {
-        raw_path_ = other.raw_path_;
-        path_len_ = other.path_len_;
-        Parse();
-    }
+    Path(Path &&other) noexcept { MoveFrom_(other); }
 
     Path &operator=(Path &&other) noexcept
     {
         if (this != &other) {
-            raw_path_ = other.raw_path_;
-            path_len_ = other.path_len_;
-            Parse();
+            MoveFrom_(other);
         }
         return *this;
     }
@@ -127,11 +166,19 @@ class Path
     bool IsRelative() const noexcept { return !is_absolute_; }
     bool IsRoot() const noexcept { return is_absolute_ && num_components_ == 0; }
 
-    const char *CString() const noexcept { return raw_path_.data(); }
-    std::string_view StringView() const noexcept
-    {
-        return std::string_view(raw_path_.data(), path_len_);
-    }
+    /**
+     * @brief PathError::kNone unless part of the path was lost, see PathError.
+     */
+    PathError GetError() const noexcept { return error_; }
+    bool IsValid() const noexcept { return error_ == PathError::kNone; }
+
+    const char *CString() const noexcept { return Data_(); }
+    std::string_view StringView() const noexcept { return std::string_view(Data_(), path_len_); }
+
+    /**
+     * @brief FNV-1a hash of the canonical path string, computed once on construction.
+     */
+    u32 Hash() const noexcept { return hash_; }
 
     // Component access
     size_t ComponentCount() const noexcept { return num_components_; }
@@ -139,14 +186,19 @@ class Path
 
     std::string_view operator[](size_t index) const noexcept
     {
-        return index < num_components_ ? components_[index] : std::string_view{};
+        if (index >= num_components_) {
+            return {};
+        }
+
+        const Component &component = Component_(index);
+        return std::string_view(Data_() + component.offset, component.length);
     }
 
     std::string_view GetComponent(size_t index) const noexcept { return (*this)[index]; }
 
     std::string_view GetFilename() const noexcept
     {
-        return num_components_ == 0 ? std::string_view{} : components_[num_components_ - 1];
+        return num_components_ == 0 ? std::string_view{} : (*this)[num_components_ - 1];
     }
 
     std::string_view GetStem() const noexcept
@@ -180,25 +232,33 @@ class Path
             return kCurrentDir;
         }
 
-        Path parent;
-        parent.is_absolute_    = is_absolute_;
-        parent.num_components_ = num_components_ - 1;
-        strncpy(parent.raw_path_.data(), raw_path_.data(), std::min(path_len_, kMaxPathSize - 1));
-        for (size_t i = 0; i < parent.num_components_; ++i) {
-            parent.components_[i] = components_[i];
-        }
-        parent.RebuildPath();
+        Path parent = *this;
+        parent.PopBack_();
+        parent.Seal_();
         return parent;
     }
 
+    /**
+     * @brief Path made of the components starting at first_component, absolute if this path is.
+     */
+    Path GetSubpath(size_t first_component) const
+    {
+        Path result;
+        result.Reset_(is_absolute_);
+        result.error_ = error_;
+        for (size_t i = first_component; i < num_components_; ++i) {
+            result.Append_((*this)[i]);
+        }
+        result.Seal_();
+        return result;
+    }
+
     // Iterator interface
     using iterator       = PathIterator;
     using const_iterator = PathIterator;
 
-    iterator begin() { return PathIterator(components_, 0); }
-    iterator end() { return PathIterator(components_, num_components_); }
-    const_iterator begin() const { return PathIterator(components_, 0); }
-    const_iterator end() const { return PathIterator(components_, num_components_); }
+    const_iterator begin() const { return PathIterator(*this, 0); }
+    const_iterator end() const { return PathIterator(*this, num_components_); }
     const_iterator cbegin() const { return begin(); }
     const_iterator cend() const { return end(); }
 
@@ -209,14 +269,11 @@ class Path
             return other;
 
         Path result = *this;
-        // Check for component overflow before appending
-        if (result.num_components_ + other.num_components_ <= kMaxComponents) {
-            for (size_t i = 0; i < other.num_components_; ++i) {
-                result.components_[result.num_components_ + i] = other.components_[i];
-            }
-            result.num_components_ += other.num_components_;
-            result.RebuildPath();
+        result.InheritError_(other);
+        for (size_t i = 0; i < other.num_components_; ++i) {
+            result.Append_(other[i]);
         }
+        result.Seal_();
         return result;
     }
 
@@ -242,10 +299,11 @@ class Path
     Path GetWeaklyCanonical() const
     {
         Path canonical;
-        canonical.is_absolute_ = is_absolute_;
+        canonical.Reset_(is_absolute_);
+        canonical.error_ = error_;
 
         for (size_t i = 0; i < num_components_; ++i) {
-            const auto &component = components_[i];
+            const auto component = (*this)[i];
 
             if (component == kCurrentDir.StringView()) {
                 continue;  // Skip "."
@@ -253,22 +311,17 @@ class Path
 
             if (component == kParentDir.StringView()) {
                 if (canonical.num_components_ > 0 &&
-                    canonical.components_[canonical.num_components_ - 1] !=
-                        kParentDir.StringView()) {
-                    canonical.num_components_--;  // Pop back
+                    canonical.GetFilename() != kParentDir.StringView()) {
+                    canonical.PopBack_();
                 } else if (canonical.IsRelative()) {
-                    if (canonical.num_components_ < kMaxComponents) {
-                        canonical.components_[canonical.num_components_++] = component;
-                    }
+                    canonical.Append_(component);
                 }
             } else {
-                if (canonical.num_components_ < kMaxComponents) {
-                    canonical.components_[canonical.num_components_++] = component;
-                }
+                canonical.Append_(component);
             }
         }
 
-        canonical.RebuildPath();
+        canonical.Seal_();
         return canonical;
     }
 
@@ -280,10 +333,10 @@ class Path
     {
         for (size_t i = 0; i < num_components_; ++i) {
             if constexpr (std::same_as<std::invoke_result_t<Callback, std::string_view>, bool>) {
-                if (!callback(components_[i]))
+                if (!callback((*this)[i]))
                     break;
             } else {
-                callback(components_[i]);
+                callback((*this)[i]);
             }
         }
     }
@@ -295,10 +348,10 @@ class Path
             return;
         for (size_t i = num_components_; i-- > 0;) {
             if constexpr (std::same_as<std::invoke_result_t<Callback, std::string_view>, bool>) {
-                if (!callback(components_[i]))
+                if (!callback((*this)[i]))
                     break;
             } else {
-                callback(components_[i]);
+                callback((*this)[i]);
             }
         }
     }
@@ -306,17 +359,9 @@ class Path
     // Comparison operators
     bool operator==(const Path &other) const noexcept
     {
-        if (is_absolute_ != other.is_absolute_ || num_components_ != other.num_components_) {
-            return false;
-        }
-
-        for (size_t i = 0; i < num_components_; ++i) {
-            if (components_[i] != other.components_[i]) {
-                return false;
-            }
-        }
-
-        return true;
+        // Canonical strings are equal exactly when the components are
+        return hash_ == other.hash_ && is_absolute_ == other.is_absolute_ &&
+               StringView() == other.StringView();
     }
 
     bool operator!=(const Path &other) const noexcept { return !(*this == other); }
@@ -329,9 +374,9 @@ class Path
 
         size_t min_components = std::min(num_components_, other.num_components_);
         for (size_t i = 0; i < min_components; ++i) {
-            if (components_[i] < other.components_[i]) {
+            if ((*this)[i] < other[i]) {
                 return true;
-            } else if (components_[i] > other.components_[i]) {
+            } else if ((*this)[i] > other[i]) {
                 return false;
             }
         }
@@ -350,83 +395,195 @@ class Path
     }
 
     private:
-    void Parse()
+    // ------------------------------
+    // Storage
+    // ------------------------------
+
+    char *Data_() noexcept { return heap_ != nullptr ? heap_ : inline_; }
+    const char *Data_() const noexcept { return heap_ != nullptr ? heap_ : inline_; }
+    size_t Capacity_() const noexcept
     {
-        num_components_ = 0;
-        std::string_view full_path(raw_path_.data(), path_len_);
+        return heap_ != nullptr ? heap_capacity_ : kInlinePathSize;
+    }
 
-        if (full_path.empty()) {
-            is_absolute_ = false;
-            return;
-        }
+    // The component table grows downwards from the end of the buffer
+    Component &Component_(size_t index) noexcept
+    {
+        auto *table_end = reinterpret_cast<Component *>(Data_() + Capacity_());
+        return *(table_end - 1 - index);
+    }
+    const Component &Component_(size_t index) const noexcept
+    {
+        auto *table_end = reinterpret_cast<const Component *>(Data_() + Capacity_());
+        return *(table_end - 1 - index);
+    }
 
-        is_absolute_ = (full_path[0] == kPathSeparator);
+    /**
+     * @brief Make room for the given number of characters (including the terminator) and
+     * components, moving the path to the heap if the current buffer is too small.
+     */
+    bool Reserve_(size_t chars, size_t components)
+    {
+        const size_t needed = chars + components * sizeof(Component);
+        if (needed <= Capacity_()) {
+            return true;
+        }
 
-        size_t start = is_absolute_ ? 1 : 0;
-        size_t pos   = start;
+        const size_t capacity = AlignUp(std::max(needed, 2 * Capacity_()), alignof(Component));
+        auto buffer_res       = Mem::KMalloc(capacity);
+        if (!buffer_res) {
+            InheritError_(PathError::kNoMemory);
+            return false;
+        }
 
-        while (pos < full_path.size() && num_components_ < kMaxComponents) {
-            size_t next_sep = full_path.find(kPathSeparator, pos);
-            if (next_sep == std::string_view::npos) {
-                next_sep = full_path.size();
-            }
+        char *buffer            = static_cast<char *>(*buffer_res);
+        const size_t table_size = num_components_ * sizeof(Component);
+        memcpy(buffer, Data_(), path_len_ + 1);
+        memcpy(buffer + capacity - table_size, Data_() + Capacity_() - table_size, table_size);
 
-            if (next_sep > pos) {  // Non-empty component
-                components_[num_components_++] = full_path.substr(pos, next_sep - pos);
-            }
+        FreeHeap_();
+        heap_          = buffer;
+        heap_capacity_ = static_cast<u16>(capacity);
+        return true;
+    }
 
-            pos = next_sep + 1;
+    void FreeHeap_() noexcept
+    {
+        if (heap_ != nullptr) {
+            Mem::KFree(heap_);
+            heap_          = nullptr;
+            heap_capacity_ = 0;
         }
     }
 
-    void RebuildPath()
+    // ------------------------------
+    // Building
+    // ------------------------------
+
+    void Reset_(bool absolute) noexcept
     {
-        char *current         = raw_path_.data();
-        const char *const end = raw_path_.data() + kMaxPathSize;
+        is_absolute_    = absolute;
+        num_components_ = 0;
+        path_len_       = absolute ? 1 : 0;
 
-        if (is_absolute_) {
-            if (current < end) {
-                *current++ = kPathSeparator;
-            }
+        char *data      = Data_();
+        data[0]         = kPathSeparator;
+        data[path_len_] = '\0';
+    }
+
+    bool Append_(std::string_view component)
+    {
+        const bool needs_separator = num_components_ > 0;
+        const size_t offset        = path_len_ + (needs_separator ? 1 : 0);
+        const size_t new_len       = offset + component.length();
+        if (num_components_ >= kMaxComponents || new_len >= kMaxPathSize) {
+            InheritError_(PathError::kTooLong);
+            return false;
+        }
+        if (!Reserve_(new_len + 1, num_components_ + 1U)) {
+            return false;
         }
 
-        for (size_t i = 0; i < num_components_; ++i) {
-            if (i > 0) {
-                if (current < end) {
-                    *current++ = kPathSeparator;
-                }
-            }
-            // Ensure we don't write past the end of the buffer
-            size_t copy_len = std::min(components_[i].length(), static_cast<size_t>(end - current));
-            strncpy(current, components_[i].data(), copy_len);
-            current += copy_len;
+        char *data = Data_();
+        if (needs_separator) {
+            data[path_len_] = kPathSeparator;
         }
+        memcpy(data + offset, component.data(), component.length());
+        data[new_len] = '\0';
+
+        Component_(num_components_++) = {
+            .offset = static_cast<u16>(offset),
+            .length = static_cast<u16>(component.length()),
+        };
+        path_len_ = static_cast<u16>(new_len);
+        return true;
+    }
+
+    void PopBack_() noexcept
+    {
+        const Component &last = Component_(--num_components_);
+        const size_t root_len = is_absolute_ ? 1 : 0;
+
+        path_len_          = static_cast<u16>(num_components_ > 0 ? last.offset - 1U : root_len);
+        Data_()[path_len_] = '\0';
+    }
 
-        path_len_ = current - raw_path_.data();
-        if (path_len_ < kMaxPathSize) {
-            raw_path_[path_len_] = '\0';
+    void CopyFrom_(const Path &other)
+    {
+        Reset_(false);
+        error_ = other.error_;
+        if (!Reserve_(other.path_len_ + 1U, other.num_components_)) {
+            Seal_();
+            return;
         }
 
-        // Re-point all string_views to our internal buffer
-        is_absolute_          = (path_len_ > 0 && raw_path_[0] == kPathSeparator);
-        size_t current_offset = is_absolute_ ? 1 : 0;
-        for (size_t i = 0; i < num_components_; ++i) {
-            size_t component_len = components_[i].length();
-            components_[i] = std::string_view(raw_path_.data() + current_offset, component_len);
-            current_offset += component_len + 1;  // +1 for the separator
+        memcpy(Data_(), other.Data_(), other.path_len_ + 1U);
+        for (size_t i = 0; i < other.num_components_; ++i) {
+            Component_(i) = other.Component_(i);
         }
+
+        path_len_       = other.path_len_;
+        num_components_ = other.num_components_;
+        is_absolute_    = other.is_absolute_;
+        hash_           = other.hash_;
     }
 
-    // Member variables
-    std::array<char, kMaxPathSize> raw_path_{};
-    size_t path_len_ = 0;
+    void MoveFrom_(Path &other) noexcept
+    {
+        if (other.heap_ == nullptr) {
+            // Inline paths always fit into any buffer, so this cannot allocate
+            CopyFrom_(other);
+            return;
+        }
+
+        FreeHeap_();
+        heap_           = other.heap_;
+        heap_capacity_  = other.heap_capacity_;
+        path_len_       = other.path_len_;
+        num_components_ = other.num_components_;
+        is_absolute_    = other.is_absolute_;
+        hash_           = other.hash_;
+        error_          = other.error_;
+
+        other.heap_          = nullptr;
+        other.heap_capacity_ = 0;
+        other.Reset_(false);
+        other.error_ = PathError::kNone;
+        other.Seal_();
+    }
 
-    std::array<std::string_view, kMaxComponents> components_{};
-    size_t num_components_ = 0;
+    // The first error sticks, it tells why the path is incomplete
+    void InheritError_(PathError error) noexcept
+    {
+        if (error_ == PathError::kNone) {
+            error_ = error;
+        }
+    }
+    void InheritError_(const Path &other) noexcept { InheritError_(other.error_); }
 
-    bool is_absolute_ = false;
+    void Seal_() noexcept
+    {
+        u32 hash         = 2166136261U;
+        const char *data = Data_();
+        for (size_t i = 0; i < path_len_; ++i) {
+            hash = (hash ^ static_cast<u8>(data[i])) * 16777619U;
+        }
+        hash_ = hash;
+    }
+
+    // Member variables
+    alignas(Component) char inline_[kInlinePathSize]{};
+    char *heap_         = nullptr;
+    u16 heap_capacity_  = 0;
+    u16 path_len_       = 0;
+    u16 num_components_ = 0;
+    bool is_absolute_   = false;
+    PathError error_    = PathError::kNone;
+    u32 hash_           = 0;
 };
 
+inline PathIterator::reference PathIterator::operator*() const { return (*path_)[index_]; }
+
 inline const Path Path::kCurrentDir = Path(".");
 inline const Path Path::kParentDir  = Path("..");
 inline const Path Path::kRoot       = Path(std::string_view(&kPathSeparator, 1));
@@ -27,6 +27,14 @@ WRAP_CALL size_t DebugTerminalReadLine(char *buffer, size_t buffer_size);
  * @note This function should block until something is written to the terminal.
  */
 WRAP_CALL void DebugTerminalWrite(const char *buffer);
+
+/**
+ * @brief Writes a buffer of the given size to the architecture-specific debug terminal.
+ * @param buffer The bytes to be written, not required to be null-terminated.
+ * @param size Number of bytes to write.
+ * @note This function should push the bytes in blocks rather than one character at a time.
+ */
+WRAP_CALL void DebugTerminalWrite(const char *buffer, size_t size);
 }  // namespace arch
 
 #endif  // KERNEL_SRC_HAL_API_DEBUG_TERMINAL_HPP_
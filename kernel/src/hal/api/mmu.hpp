@@ -26,6 +26,7 @@ struct PageFlags {
     bool UserAccessible : 1;
     bool WriteThrough : 1;
     bool CacheDisable : 1;
+    bool WriteCombining : 1;  ///< Takes precedence over WriteThrough and CacheDisable
     bool Global : 1;
     bool NoExecute : 1;
 };
@@ -77,6 +78,15 @@ concept TableVisitor = requires(Func f, Mem::PPtr<void> table, u8 level, size_t
     { f(table, level, count) } -> std::same_as<void>;
 };
 
+/**
+ * @brief Concept for a visitor function called for mapped pages.
+ * Visitor signature: void(Mem::VPtr<void> vaddr, Mem::PPtr<void> frame)
+ */
+template <typename Func>
+concept PageVisitor = requires(Func f, Mem::VPtr<void> vaddr, Mem::PPtr<void> frame) {
+    { f(vaddr, frame) } -> std::same_as<void>;
+};
+
 struct MmuAPI {
     /**
      * @brief Maps a physical page to a virtual address in the specified page table hierarchy.
@@ -119,6 +129,22 @@ struct MmuAPI {
         Mem::PPtr<void> root, Mem::VPtr<void> vaddr, PageFlags flags
     );
 
+    /**
+     * @brief Replaces the huge pages mapping vaddr by tables of base pages with the same
+     * translation and attributes, so that SetPageFlags() can change single pages. Does nothing
+     * for addresses already mapped by base pages.
+     */
+    template <MmuContext Context>
+    expected<void, Mem::MemError> SplitHugePages(
+        Context &ctx, Mem::PPtr<void> root, Mem::VPtr<void> vaddr
+    );
+
+    /**
+     * @brief Writes back and invalidates the cache lines of [start, start + size) in every cache
+     * of the system. Required once the memory type of the range changed.
+     */
+    void FlushCacheLines(Mem::VPtr<void> start, size_t size);
+
     /**
      * @brief Translates a virtual address to physical using the specified root.
      * @param ctx The MMU context (unused for simple translation but kept for API consistency if
@@ -144,6 +170,17 @@ struct MmuAPI {
     template <TableVisitor Visitor>
     void VisitTables(Mem::PPtr<void> root, Visitor visitor);
 
+    /**
+     * @brief Calls the visitor for every page mapped in [start, start + size).
+     *
+     * Parts of the range without page tables are skipped a whole table at a time, so sparse
+     * ranges are cheap to walk. Huge pages are not reported.
+     */
+    template <PageVisitor Visitor>
+    void VisitMappedPages(
+        Mem::PPtr<void> root, Mem::VPtr<void> start, size_t size, Visitor visitor
+    );
+
     /**
      * @brief Synchronizes a top-level page table entry from a source root to a destination root.
      * Used for lazy kernel mapping synchronization (e.g. updating a user process's kernel view).
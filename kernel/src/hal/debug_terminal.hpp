@@ -17,6 +17,13 @@ WRAP_CALL void DebugTerminalWrite(const char *str)
     }
 }
 
+WRAP_CALL void DebugTerminalWrite(const char *buffer, const size_t size)
+{
+    if constexpr (FeatureEnabled<FeatureFlag::kDebugOutput>) {
+        arch::DebugTerminalWrite(buffer, size);
+    }
+}
+
 WRAP_CALL void DebugTerminalPutChar(const char c)
 {
     if constexpr (FeatureEnabled<FeatureFlag::kDebugOutput>) {
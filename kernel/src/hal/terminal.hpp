@@ -29,6 +29,14 @@ WRAP_CALL void TerminalPutChar(char c) { arch::TerminalPutChar(c); }
  */
 WRAP_CALL void TerminalWriteString(const char *data) { arch::TerminalWriteString(data); }
 
+/**
+ * @brief Writes a buffer of the given size to the terminal.
+ * @param data The bytes to write, not required to be null-terminated.
+ * @param size Number of bytes to write.
+ * @note Should push the bytes in blocks rather than one character at a time.
+ */
+WRAP_CALL void TerminalWrite(const char *data, size_t size) { arch::TerminalWrite(data, size); }
+
 /**
  * @brief Writes an error message to the terminal.
  * @param data The error string to write.
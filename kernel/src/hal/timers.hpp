@@ -24,6 +24,11 @@ WRAP_CALL time_t QuerySystemTime(const Timezone &tz) { return arch::QuerySystemT
  */
 WRAP_CALL void PickSystemClockSource() { arch::PickSystemClockSource(); }
 WRAP_CALL void PickSystemEventClockSource() { arch::PickSystemEventClockSource(); }
+
+/**
+ * @brief Read a free running per-core cycle counter, cheap enough for hot path measurements
+ */
+NODISCARD WRAP_CALL u64 ReadCycleCounter() { return arch::ReadCycleCounter(); }
 }  // namespace hal
 
 #endif  // KERNEL_SRC_HAL_TIMERS_HPP_
@@ -0,0 +1,18 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025-2026 The AlkOS Authors
+// See the AUTHORS file for the full list of contributors.
+
+#ifndef KERNEL_SRC_HAL_USER_COPY_HPP_
+#define KERNEL_SRC_HAL_USER_COPY_HPP_
+
+#include "hal/impl/user_copy.hpp"
+
+namespace hal
+{
+
+using arch::CopyUserBytes;
+using arch::FixupUserCopyFault;
+
+}  // namespace hal
+
+#endif  // KERNEL_SRC_HAL_USER_COPY_HPP_
@@ -53,6 +53,13 @@ class CoresController final : public hal::CoreController
         return core_arr_[MapHwToLogical(hwid)];
     }
 
+    NODISCARD FORCE_INLINE_F size_t GetCoreCount() const { return core_arr_.size(); }
+
+    NODISCARD FORCE_INLINE_F CoreLocal &GetCoreLocalByLid(const u16 lid)
+    {
+        return core_local_table_[lid];
+    }
+
     NODISCARD FORCE_INLINE_F Core &GetCurrentCore()
     {
         const u32 hwid = hal::GetCurrentCoreId();
@@ -8,6 +8,7 @@
 #include "hal/constants.hpp"
 #include "hal/core.hpp"
 #include "scheduling/thread.hpp"
+#include "syscalls/stats.hpp"
 
 namespace hardware
 {
@@ -16,6 +17,9 @@ struct alignas(hal::kCacheLineSizeBytes) CoreLocal : hal::CoreLocal {
     u16 lid;
 
     Sched::Thread *thread_control_block;
+
+    /* Syscall counters, only used with the syscall_stats feature */
+    Syscall::CoreSyscallStats *syscall_stats{nullptr};
 };
 
 #define PREPARE_CORE_LOCAL_ACCESS(name, rv, field)                       \
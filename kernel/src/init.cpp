@@ -18,8 +18,11 @@
 #include "modules/timing.hpp"
 #include "modules/vfs.hpp"
 #include "modules/video.hpp"
+#include "scheduling/kworker.hpp"
+#include "scheduling/threads.hpp"
 #include "trace_framework.hpp"
 
+#include "internal/memory_routines.hpp"
 #include "internal/stdio.hpp"
 
 /* GCC CXX provided function initializing global constructors */
@@ -30,6 +33,9 @@ void KernelInit(const hal::RawBootArguments &raw_args)
     hal::TerminalInit();
     hal::ArchInit(raw_args);
 
+    /* CPU features are known now, pick the mem* implementations */
+    InitMemoryRoutines();
+
     BootArguments args = SanitizeBootArgs(raw_args);
 
     MemoryModule::Init(args);
@@ -66,8 +72,17 @@ void KernelInit(const hal::RawBootArguments &raw_args)
     SchedulingModule::Init();
     SchedulingModule::Get().GetTaskMgr().InitializeMultitasking();
 
+    /* Changes the memory type of VRAM in the direct map, which is only safe while no other core
+     * has touched it */
+    VideoModule::Init(args, MemoryModule::Get().GetHeap());
+
     HardwareModule::Get().GetCoresController().BootUpAllCores();
 
-    VideoModule::Init(args, MemoryModule::Get().GetHeap());
     InputModule::Init();
+
+    /* The compositor draws through the window manager, spawn it only once video is up */
+    const auto compositor = SchedulingModule::Get().GetTaskMgr().SpawnKernelProcess(
+        "kworker-compositor", {}, Sched::PrepareKThreadTask(Sched::CompositorMain)
+    );
+    R_ASSERT_TRUE(static_cast<bool>(compositor), "Failed to spawn compositor...");
 }
@@ -0,0 +1,146 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025-2026 The AlkOS Authors
+// See the AUTHORS file for the full list of contributors.
+
+#include "io/pipe.hpp"
+
+#include "mem/heap.hpp"
+#include "modules/scheduling.hpp"
+#include "scheduling/local_lock.hpp"
+
+namespace IO
+{
+
+PipeBase::~PipeBase()
+{
+    if (readers_wq_ != nullptr) {
+        ASSERT_TRUE(readers_wq_->IsEmpty());
+        Mem::KDelete(readers_wq_);
+    }
+    if (writers_wq_ != nullptr) {
+        ASSERT_TRUE(writers_wq_->IsEmpty());
+        Mem::KDelete(writers_wq_);
+    }
+}
+
+IoResult PipeBase::ReadBlocking(std::span<byte> buffer)
+{
+    while (true) {
+        // Interrupts stay disabled between the check and the block, so a writer running on
+        // this core (e.g. an IRQ) cannot slip its wake-up in between
+        LocalCoreLock core_lock{};
+
+        auto result = Read(buffer);
+        if (result || result.error() != Error::Retry) {
+            return result;
+        }
+
+        Block_(readers_wq_);
+    }
+}
+
+IoResult PipeBase::WriteBlocking(std::span<const byte> buffer)
+{
+    size_t done = 0;
+    while (done < buffer.size()) {
+        LocalCoreLock core_lock{};
+
+        auto result = Write(buffer.subspan(done));
+        if (result) {
+            done += *result;
+            continue;
+        }
+
+        if (result.error() != Error::Retry) {
+            // Report the data already transferred, the error surfaces on the next call
+            RET_UNEXPECTED_IF(done == 0, result.error());
+            break;
+        }
+
+        Block_(writers_wq_);
+    }
+
+    return done;
+}
+
+expected<void, Error> PipeBase::WaitReadable(const bool block)
+{
+    while (true) {
+        LocalCoreLock core_lock{};
+
+        // Sampled before checking for data, as in Read()
+        const bool write_closed = IsWriteClosed_();
+        if (Poll() & kPollIn) {
+            return {};
+        }
+
+        RET_UNEXPECTED_IF(write_closed, Error::EndOfFile);
+        RET_UNEXPECTED_IF(!block, Error::Retry);
+
+        Block_(readers_wq_);
+    }
+}
+
+void PipeBase::OpenEnds(const bool read, const bool write)
+{
+    LocalCoreLock core_lock{};
+
+    if (read && readers_++ == 0) {
+        read_closed_.store(false, std::memory_order_release);
+    }
+    if (write && writers_++ == 0) {
+        write_closed_.store(false, std::memory_order_release);
+    }
+}
+
+bool PipeBase::CloseEnds(const bool read, const bool write)
+{
+    LocalCoreLock core_lock{};
+
+    if (read) {
+        ASSERT_NOT_ZERO(readers_);
+        if (--readers_ == 0) {
+            read_closed_.store(true, std::memory_order_release);
+            WakeWriters_();
+            WakePollWaiters_();
+        }
+    }
+    if (write) {
+        ASSERT_NOT_ZERO(writers_);
+        if (--writers_ == 0) {
+            write_closed_.store(true, std::memory_order_release);
+            WakeReaders_();
+            WakePollWaiters_();
+        }
+    }
+
+    return readers_ == 0 && writers_ == 0;
+}
+
+void PipeBase::Block_(WaitQueueT *&wq)
+{
+    auto &scheduler = SchedulingModule::Get().GetScheduler();
+
+    if (wq == nullptr) {
+        const auto new_wq = Mem::KNew<WaitQueueT>();
+        if (!new_wq) {
+            // Degrade to polling, the caller retries after the yield
+            scheduler.Yield();
+            return;
+        }
+        wq = new_wq.value();
+    }
+
+    scheduler.BlockOnWaitQueue(wq);
+}
+
+void PipeBase::Wake_(WaitQueueT *wq)
+{
+    if (wq == nullptr || wq->IsEmpty()) {
+        return;
+    }
+
+    SchedulingModule::Get().GetScheduler().ReleaseAll(wq);
+}
+
+}  // namespace IO
@@ -5,29 +5,109 @@
 #ifndef KERNEL_SRC_IO_PIPE_HPP_
 #define KERNEL_SRC_IO_PIPE_HPP_
 
+#include <atomic.hpp>
 #include <data_structures/atomic_cyclic_buffer.hpp>
 
 #include "internal/macros.hpp"
 #include "io/stream.hpp"
 
+namespace Sched
+{
+struct Thread;
+
+template <class T, int kIntrusiveLevel>
+class WaitQueue;
+}  // namespace Sched
+
 namespace IO
 {
 
+/**
+ * @brief Size independent part of a pipe: open end bookkeeping and the threads blocked on it.
+ *
+ * Read() and Write() never block and are IRQ safe. ReadBlocking() and WriteBlocking() put the
+ * calling thread to sleep until the other side makes progress, they must only be called from
+ * thread context.
+ *
+ * Once every write end that was opened is closed, reads of an empty pipe return
+ * Error::EndOfFile. Once every read end that was opened is closed, writes return
+ * Error::EndOfFile. Pipes whose ends are never opened (e.g. fed by a driver) never close.
+ */
+class PipeBase : public IStream
+{
+    public:
+    PipeBase() = default;
+    ~PipeBase() override;
+
+    /// Block until at least one byte was read or the pipe reached its end
+    IoResult ReadBlocking(std::span<byte> buffer);
+
+    /// Block until the whole buffer was written or every reader went away
+    IoResult WriteBlocking(std::span<const byte> buffer);
+
+    /**
+     * @brief Wait until the pipe holds data, for readers consuming it in place.
+     * @return Error::EndOfFile once empty with every write end closed, Error::Retry if empty and
+     *         block is not set
+     */
+    expected<void, Error> WaitReadable(bool block);
+
+    void OpenEnds(bool read, bool write);
+
+    /// @return true if no end of the pipe remains open
+    NODISCARD bool CloseEnds(bool read, bool write);
+
+    protected:
+    using WaitQueueT = Sched::WaitQueue<Sched::Thread, 3>;
+
+    NODISCARD FORCE_INLINE_F bool IsReadClosed_() const
+    {
+        return read_closed_.load(std::memory_order_acquire);
+    }
+
+    NODISCARD FORCE_INLINE_F bool IsWriteClosed_() const
+    {
+        return write_closed_.load(std::memory_order_acquire);
+    }
+
+    FORCE_INLINE_F void WakeReaders_() { Wake_(readers_wq_); }
+    FORCE_INLINE_F void WakeWriters_() { Wake_(writers_wq_); }
+
+    private:
+    static void Block_(WaitQueueT *&wq);
+    static void Wake_(WaitQueueT *wq);
+
+    // Allocated on the first block, most pipes never put anybody to sleep
+    WaitQueueT *readers_wq_{nullptr};
+    WaitQueueT *writers_wq_{nullptr};
+
+    u32 readers_{0};
+    u32 writers_{0};
+    std::atomic<bool> read_closed_{false};
+    std::atomic<bool> write_closed_{false};
+};
+
 /// Assumes Single Producer - Single Consumer
 /// Because it uses atomics and not locks
 ///
 /// under the hood, it's IRQ safe
 /// (Can connect eg. a Keyboard IRQ as a writer)
 template <size_t Size>
-class Pipe : public IStream
+class Pipe : public PipeBase
 {
     public:
-    Pipe()          = default;
-    virtual ~Pipe() = default;
+    Pipe()           = default;
+    ~Pipe() override = default;
 
     IoResult Write(std::span<const byte> buffer) override
     {
+        RET_UNEXPECTED_IF(IsReadClosed_(), Error::EndOfFile);
+
         size_t bytes_written = buffer_.Write(buffer);
+        if (bytes_written != 0) {
+            WakeReaders_();
+            WakePollWaiters_();
+        }
 
         RET_UNEXPECTED_IF(bytes_written == 0 && buffer.size() > 0, Error::Retry);
         return bytes_written;
@@ -35,12 +115,56 @@ class Pipe : public IStream
 
     IoResult Read(std::span<byte> buffer) override
     {
+        // Sampled before reading: everything written before the close is then visible
+        const bool write_closed = IsWriteClosed_();
+
         size_t bytes_read = buffer_.Read(buffer);
+        if (bytes_read != 0) {
+            WakeWriters_();
+            WakePollWaiters_();
+        }
 
-        RET_UNEXPECTED_IF(bytes_read == 0 && buffer.size() > 0, Error::Retry);
+        if (bytes_read == 0 && buffer.size() > 0) {
+            return unexpected(write_closed ? Error::EndOfFile : Error::Retry);
+        }
         return bytes_read;
     }
 
+    /**
+     * @brief Zero-copy read: the first contiguous run of buffered bytes, left in place until
+     * released with Consume(). Reader side only, like Read().
+     */
+    NODISCARD std::span<const byte> Peek() const { return buffer_.Peek(); }
+
+    void Consume(const size_t count)
+    {
+        if (count == 0) {
+            return;
+        }
+
+        buffer_.Consume(count);
+        WakeWriters_();
+        WakePollWaiters_();
+    }
+
+    NODISCARD u16 Poll() const override
+    {
+        u16 events = 0;
+        if (!buffer_.IsEmpty()) {
+            events |= kPollIn;
+        }
+        if (!buffer_.IsFull()) {
+            events |= kPollOut;
+        }
+        if (IsWriteClosed_()) {
+            events |= kPollHangUp;
+        }
+        if (IsReadClosed_()) {
+            events |= kPollError;
+        }
+        return events;
+    }
+
     private:
     data_structures::AtomicCyclicBuffer<byte, Size> buffer_;
 };
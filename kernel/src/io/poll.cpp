@@ -0,0 +1,28 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025-2026 The AlkOS Authors
+// See the AUTHORS file for the full list of contributors.
+
+#include "io/poll.hpp"
+
+#include "modules/scheduling.hpp"
+
+namespace IO
+{
+
+void IPollable::WakePollWaitersSlow_()
+{
+    using NodeT = data_structures::IntrusiveDoubleListNode<PollWaiter, 0>;
+
+    auto &scheduler = SchedulingModule::Get().GetScheduler();
+
+    // Several hooks of one thread may sit on the same source, only the first release matters
+    PollWaiter *waiter = poll_waiters_.Front();
+    while (waiter != nullptr) {
+        if (!waiter->wq->IsEmpty()) {
+            scheduler.ReleaseAll(waiter->wq);
+        }
+        waiter = waiter->NodeT::next;
+    }
+}
+
+}  // namespace IO
@@ -0,0 +1,69 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025-2026 The AlkOS Authors
+// See the AUTHORS file for the full list of contributors.
+
+#ifndef KERNEL_SRC_IO_POLL_HPP_
+#define KERNEL_SRC_IO_POLL_HPP_
+
+#include <data_structures/intrusive_linked_list.hpp>
+
+#include "alkos/fd.h"
+#include "internal/macros.hpp"
+
+namespace Sched
+{
+struct Thread;
+
+template <class T, int kIntrusiveLevel>
+class WaitQueue;
+}  // namespace Sched
+
+namespace IO
+{
+
+/**
+ * @brief Hook of a thread waiting for readiness of several sources at once.
+ *
+ * The waiting thread links one hook into every source it watches, all pointing at the same
+ * wait queue, and blocks on that queue. Any of the sources releases it.
+ */
+struct PollWaiter : data_structures::IntrusiveDoubleListNode<PollWaiter, 0> {
+    Sched::WaitQueue<Sched::Thread, 3> *wq{nullptr};
+};
+
+/**
+ * @brief Source of readiness events.
+ *
+ * Readiness is level triggered: Poll() reports the current state as PollEvents, and registered
+ * waiters are woken whenever that state may have changed. Waiters must be added, removed and
+ * woken with local interrupts disabled.
+ */
+class IPollable
+{
+    public:
+    virtual ~IPollable() = default;
+
+    /// @return Mask of PollEvents that are ready right now
+    NODISCARD virtual u16 Poll() const = 0;
+
+    FORCE_INLINE_F void AddPollWaiter(PollWaiter *waiter) { poll_waiters_.PushBack(waiter); }
+
+    FORCE_INLINE_F void RemovePollWaiter(PollWaiter *waiter) { poll_waiters_.Remove(waiter); }
+
+    protected:
+    FORCE_INLINE_F void WakePollWaiters_()
+    {
+        if (!poll_waiters_.IsEmpty()) {
+            WakePollWaitersSlow_();
+        }
+    }
+
+    private:
+    void WakePollWaitersSlow_();
+
+    data_structures::IntrusiveDoubleList<PollWaiter, 0> poll_waiters_;
+};
+
+}  // namespace IO
+
+#endif  // KERNEL_SRC_IO_POLL_HPP_
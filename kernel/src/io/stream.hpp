@@ -11,6 +11,7 @@
 #include "internal/macros.hpp"
 
 #include "io/error.hpp"
+#include "io/poll.hpp"
 #include "mem/types.hpp"
 
 namespace IO
@@ -79,10 +80,13 @@ class IWriter
 /**
  * @brief A Stream is a bidirectional device (e.g., Serial Port, TCP Socket).
  */
-class IStream : public IReader, public IWriter
+class IStream : public IReader, public IWriter, public IPollable
 {
     public:
     virtual ~IStream() = default;
+
+    /// Devices without readiness tracking report themselves as always ready
+    NODISCARD u16 Poll() const override { return kPollIn | kPollOut; }
 };
 
 }  // namespace IO
@@ -8,10 +8,12 @@
 namespace Mem
 {
 
+// Values start at 1, so that errors can be returned from syscalls as negative numbers
 enum class MemError {
-    OutOfMemory,
+    OutOfMemory = 1,
     InvalidArgument,
     NotFound,
+    BadAddress,
 };
 
 }  // namespace Mem
@@ -25,6 +27,8 @@ static constexpr const char *to_string(const Mem::MemError &error)
             return "NotFound";
         case Mem::MemError::InvalidArgument:
             return "InvalidArgument";
+        case Mem::MemError::BadAddress:
+            return "BadAddress";
     }
 
     return "unknown error";
@@ -97,6 +97,37 @@ expected<void, MemError> AS::AddArea(VMemArea *vma)
     return {};
 }
 
+bool AS::IsAccessible(VPtr<void> ptr, const size_t size)
+{
+    std::lock_guard guard(area_list_lock_);
+
+    uptr addr      = PtrToUptr(ptr);
+    const uptr end = addr + size;
+    while (addr < end) {
+        auto res = FindAreaLocked(UptrToPtr<void>(addr));
+        if (!res) {
+            return false;
+        }
+
+        const VMemArea *vma = **res;
+        const auto flags    = vma->GetFlags();
+        if (!flags.readable && !flags.writable && !flags.executable) {
+            return false;
+        }
+        addr = PtrToUptr(vma->GetEnd());
+    }
+
+    return true;
+}
+
+void AS::ReleaseAllFrames()
+{
+    std::lock_guard guard(area_list_lock_);
+    for (auto *vma : area_list_) {
+        vma->ReleaseFrames(*this);
+    }
+}
+
 bool AS::AreasOverlap(const VMemArea *a, const VMemArea *b)
 {
     const auto a_s = reinterpret_cast<uptr>(a->GetStart());
@@ -106,7 +137,7 @@ bool AS::AreasOverlap(const VMemArea *a, const VMemArea *b)
     return a_s < b_e && b_s < a_e;
 }
 
-expected<TlbHint, MemError> AS::RmArea(VPtr<void> ptr)
+expected<VMemArea *, MemError> AS::UnlinkArea(VPtr<void> ptr)
 {
     std::lock_guard guard(area_list_lock_);
 
@@ -115,16 +146,9 @@ expected<TlbHint, MemError> AS::RmArea(VPtr<void> ptr)
     auto it       = *res;
     VMemArea *vma = *it;
 
-    // Do MMU unmap
-    auto start = vma->GetStart();
-    auto size  = vma->GetSize();
-    mmu_->UnmapRange(*ctx_, page_table_root_, start, size);
-
-    // Remove from list and delete object
     area_list_.Remove(it.GetNode());
-    KDelete(vma);
-
-    return TlbHint{start, size};
+    ++generation_;
+    return vma;
 }
 
 expected<TlbHint, MemError> AS::UpdateAreaFlags(VPtr<void> ptr, VirtualMemAreaFlags vmaf)
@@ -138,18 +162,24 @@ expected<TlbHint, MemError> AS::UpdateAreaFlags(VPtr<void> ptr, VirtualMemAreaFl
     RET_UNEXPECTED_IF(vma->GetStart() != ptr, MemError::InvalidArgument);
 
     vma->SetFlags(vmaf);
+    ++generation_;
 
     auto start = vma->GetStart();
     auto size  = vma->GetSize();
 
     bool is_kernel = IsKernelSpace(start);
 
+    // A present page cannot be made inaccessible, so no-access user pages stay mapped (keeping
+    // their contents) but become supervisor-only
+    const bool accessible = vmaf.readable || vmaf.writable || vmaf.executable;
+
     hal::PageFlags pf{
         .Present        = true,
         .Writable       = vmaf.writable,
-        .UserAccessible = !is_kernel,
+        .UserAccessible = !is_kernel && accessible,
         .WriteThrough   = vmaf.write_through,
         .CacheDisable   = vmaf.cache_disable,
+        .WriteCombining = vmaf.write_combining,
         .Global         = is_kernel,
         .NoExecute      = !vmaf.executable
     };
@@ -158,13 +188,39 @@ expected<TlbHint, MemError> AS::UpdateAreaFlags(VPtr<void> ptr, VirtualMemAreaFl
     uptr end_u   = start_u + size;
 
     for (uptr v = start_u; v < end_u; v += hal::kPageSizeBytes) {
-        auto res = mmu_->SetPageFlags(page_table_root_, UptrToPtr<void>(v), pf);
+        hal::PageFlags page_flags = pf;
+        page_flags.Writable       = pf.Writable && !vma->IsCopyOnWrite(*this, UptrToPtr<void>(v));
+
+        auto res = mmu_->SetPageFlags(page_table_root_, UptrToPtr<void>(v), page_flags);
         RET_UNEXPECTED_IF(!res && res.error() != MemError::NotFound, res.error());
     }
 
     return TlbHint{start, size};
 }
 
+expected<TlbHint, MemError> AS::RetargetArea(
+    VPtr<void> ptr, PPtr<void> phys_start, VirtualMemAreaFlags flags
+)
+{
+    std::lock_guard guard(area_list_lock_);
+
+    auto res = FindAreaLocked(ptr);
+    RET_UNEXPECTED_IF_ERR(res);
+    VMemArea *vma = *res.value();
+
+    RET_UNEXPECTED_IF(vma->GetStart() != ptr, MemError::InvalidArgument);
+    RET_UNEXPECTED_IF(!vma->Retarget(phys_start), MemError::InvalidArgument);
+    vma->SetFlags(flags);
+    ++generation_;
+
+    // Pages fault back in from the new range, with the new flags
+    auto start = vma->GetStart();
+    auto size  = vma->GetSize();
+    mmu_->UnmapRange(*ctx_, page_table_root_, start, size);
+
+    return TlbHint{start, size};
+}
+
 expected<AS::AddrSpMutIt, MemError> AS::FindAreaLocked(VPtr<void> ptr)
 {
     for (auto it = area_list_.begin(); it != area_list_.end(); ++it) {
@@ -70,6 +70,12 @@ class AddressSpace
     void Lock() { area_list_lock_.Lock(); }
     void Unlock() { area_list_lock_.Unlock(); }
 
+    /**
+     * @brief Whether [ptr, ptr + size) lies in areas with some access permission. No-access
+     * areas stay mapped as supervisor pages, which the kernel could still touch.
+     */
+    bool IsAccessible(VPtr<void> ptr, size_t size);
+
     private:
     // Store pointers to polymorphic VMemArea objects
     using AddrSpIt = data_structures::DoubleLinkedList<VMemArea *>::ConstIterator;
@@ -81,8 +87,14 @@ class AddressSpace
     // Takes ownership of vma pointer
     expected<void, MemError> AddArea(VMemArea *vma);
 
-    expected<TlbHint, MemError> RmArea(VPtr<void> ptr);
+    // Removes the area from the list, the caller unmaps and deletes it
+    expected<VMemArea *, MemError> UnlinkArea(VPtr<void> ptr);
+    // Returns the frames of every area, the mappings themselves are left in place
+    void ReleaseAllFrames();
     expected<TlbHint, MemError> UpdateAreaFlags(VPtr<void> ptr, VirtualMemAreaFlags flags);
+    expected<TlbHint, MemError> RetargetArea(
+        VPtr<void> ptr, PPtr<void> phys_start, VirtualMemAreaFlags flags
+    );
     expected<GapInfo, MemError> FindGap(
         size_t size, VPtr<void> start = nullptr, VPtr<void> end = nullptr
     );
@@ -102,6 +114,9 @@ class AddressSpace
     /// @note The list is sorted by the start address of the VMA objects.
     data_structures::DoubleLinkedList<VMemArea *> area_list_;
     Spinlock area_list_lock_;
+    /// @brief Bumped whenever an area is removed or changed, lets the page fault handler notice
+    /// changes made while it ran without the lock.
+    u64 generation_{0};
 
     // Dependencies
     KernelMmuContext *ctx_;
@@ -13,6 +13,7 @@
 #include "mem/mmu/contexts.hpp"
 #include "mem/virt/addr_space.hpp"
 #include "modules/memory.hpp"
+#include "modules/vfs.hpp"
 #include "trace_framework.hpp"
 
 namespace Mem
@@ -29,6 +30,7 @@ static bool MapPage(AddressSpace &as, VPtr<void> vaddr, PPtr<void> paddr, Virtua
         .UserAccessible = !is_kernel,
         .WriteThrough   = flags.write_through,
         .CacheDisable   = flags.cache_disable,
+        .WriteCombining = flags.write_combining,
         .Global         = is_kernel,
         .NoExecute      = !flags.executable
     };
@@ -48,17 +50,41 @@ static bool MapPage(AddressSpace &as, VPtr<void> vaddr, PPtr<void> paddr, Virtua
     return true;
 }
 
-static bool CheckWritePermissions(
+static bool CheckAccessPermissions(
     VPtr<void> addr, const PageFaultData::ErrorCode &err, VirtualMemAreaFlags flags
 )
 {
+    // Rejected faults end in the unresolvable fault path: a segfault for user mode,
+    // a panic for the kernel
+    if (!flags.readable && !flags.writable && !flags.executable) {
+        TRACE_WARN_MEMORY("Access to no-access memory area at %p", addr);
+        return false;
+    }
     if (err.write && !flags.writable) {
-        hal::KernelPanicFormat("Write to read-only memory area at %p", addr);
+        TRACE_WARN_MEMORY("Write to read-only memory area at %p", addr);
         return false;
     }
     return true;
 }
 
+// -----------------------------------------------------------------------------
+// VMemArea
+// -----------------------------------------------------------------------------
+
+void VMemArea::ReleaseFrames(AddressSpace &as) const
+{
+    auto &pmm = MemoryModule::Get().GetBitmapPmm();
+
+    MemoryModule::Get().GetMmu().VisitMappedPages(
+        as.PageTableRoot(), start_, size_,
+        [&](VPtr<void> vaddr, PPtr<void> frame) {
+            if (OwnsFrame(vaddr, frame)) {
+                pmm.Free(reinterpret_cast<PPtr<Page>>(frame));
+            }
+        }
+    );
+}
+
 // -----------------------------------------------------------------------------
 // AnonymousVMemArea
 // -----------------------------------------------------------------------------
@@ -67,7 +93,7 @@ bool AnonymousVMemArea::HandleFault(
     VPtr<void> fault_addr, const PageFaultData::ErrorCode &err, AddressSpace &as
 )
 {
-    if (!CheckWritePermissions(fault_addr, err, flags_)) {
+    if (!CheckAccessPermissions(fault_addr, err, flags_)) {
         return false;
     }
 
@@ -99,7 +125,7 @@ bool DirectMappingVMemArea::HandleFault(
     VPtr<void> fault_addr, const PageFaultData::ErrorCode &err, AddressSpace &as
 )
 {
-    if (!CheckWritePermissions(fault_addr, err, flags_)) {
+    if (!CheckAccessPermissions(fault_addr, err, flags_)) {
         return false;
     }
 
@@ -115,6 +141,170 @@ bool DirectMappingVMemArea::HandleFault(
     return MapPage(as, aligned_vaddr, phys_page, flags_);
 }
 
+// -----------------------------------------------------------------------------
+// FileBackedVMemArea
+// -----------------------------------------------------------------------------
+
+FileBackedVMemArea::FileBackedVMemArea(
+    VPtr<void> start, size_t size, VirtualMemAreaFlags flags, Fs::File &file, u64 file_offset,
+    bool shared
+)
+    : VMemArea(start, size, flags),
+      file_(&file),
+      file_offset_(file_offset),
+      shared_(shared),
+      created_writable_(flags.writable)
+{
+    ASSERT_TRUE(IsAligned(file_offset, hal::kPageSizeBytes));
+
+    // The area keeps the file, and thereby its cached pages, alive
+    file_->AddRef();
+    VfsModule::Get().GetPageCache().AddMapping(*file_);
+}
+
+FileBackedVMemArea::~FileBackedVMemArea()
+{
+    auto &cache = VfsModule::Get().GetPageCache();
+
+    // Stores through the mapping are not tracked, so everything the process could have
+    // modified is handed to write-back when the mapping goes away.
+    if (shared_ && created_writable_) {
+        cache.MarkDirty(*file_, PageIndex_(start_), size_ / hal::kPageSizeBytes);
+    }
+
+    cache.RemoveMapping(*file_);
+    file_->Release();
+}
+
+bool FileBackedVMemArea::HandleFault(
+    VPtr<void> fault_addr, const PageFaultData::ErrorCode &err, AddressSpace &as
+)
+{
+    if (!CheckAccessPermissions(fault_addr, err, flags_)) {
+        return false;
+    }
+
+    TRACE_FREQ_INFO_MEMORY("Handling File-Backed Fault at %p", fault_addr);
+
+    const bool writable_shared = shared_ && flags_.writable;
+
+    // Read in by the page fault handler, see GetFaultFilePage()
+    const auto frame = VfsModule::Get().GetPageCache().FindFrame(*file_, PageIndex_(fault_addr));
+    if (frame == nullptr) {
+        TRACE_WARN_MEMORY("File page for fault at %p is not cached", fault_addr);
+        return false;
+    }
+
+    VPtr<void> aligned_vaddr = AlignDown(fault_addr, hal::kPageSizeBytes);
+
+    if (!shared_ && err.write) {
+        return MapPrivateCopy_(as, aligned_vaddr, frame);
+    }
+
+    // Private pages stay read-only until written, so the cached frame can be shared
+    VirtualMemAreaFlags map_flags = flags_;
+    map_flags.writable            = writable_shared;
+
+    return MapPage(as, aligned_vaddr, frame, map_flags);
+}
+
+bool FileBackedVMemArea::HandleProtectionFault(
+    VPtr<void> fault_addr, const PageFaultData::ErrorCode &err, AddressSpace &as
+)
+{
+    if (shared_ || !err.write || !flags_.writable) {
+        return false;
+    }
+
+    TRACE_FREQ_INFO_MEMORY("Handling Copy-On-Write Fault at %p", fault_addr);
+
+    const auto frame = VfsModule::Get().GetPageCache().FindFrame(*file_, PageIndex_(fault_addr));
+    if (frame == nullptr) {
+        return false;
+    }
+
+    VPtr<void> aligned_vaddr = AlignDown(fault_addr, hal::kPageSizeBytes);
+
+    auto &mmu = MemoryModule::Get().GetMmu();
+    mmu.Unmap(MemoryModule::Get().GetKernelMmuContext(), as.PageTableRoot(), aligned_vaddr);
+    MemoryModule::Get().GetTlb().InvalidatePage(aligned_vaddr);
+
+    return MapPrivateCopy_(as, aligned_vaddr, frame);
+}
+
+FaultFilePage FileBackedVMemArea::GetFaultFilePage(
+    VPtr<void> fault_addr, const PageFaultData::ErrorCode &err
+) const
+{
+    // Protection faults only resolve as copy-on-write of the cached page
+    if (err.present && (shared_ || !err.write || !flags_.writable)) {
+        return {};
+    }
+
+    return {file_, PageIndex_(fault_addr), !err.present && shared_ && flags_.writable};
+}
+
+std::expected<void, MemError> FileBackedVMemArea::Sync(AddressSpace &)
+{
+    if (!shared_ || !created_writable_) {
+        return {};
+    }
+
+    auto &cache = VfsModule::Get().GetPageCache();
+    cache.MarkDirty(*file_, PageIndex_(start_), size_ / hal::kPageSizeBytes);
+
+    const auto result = cache.Flush(*file_);
+    RET_UNEXPECTED_IF(!result, MemError::InvalidArgument);
+
+    return {};
+}
+
+bool FileBackedVMemArea::OwnsFrame(VPtr<void> vaddr, PPtr<void> frame) const
+{
+    // Pages of mapped files are never reclaimed, so a frame differing from the cached one is a
+    // private copy made on write
+    return !shared_ && !IsCachedFrame_(vaddr, frame);
+}
+
+bool FileBackedVMemArea::IsCopyOnWrite(AddressSpace &as, VPtr<void> vaddr) const
+{
+    if (shared_) {
+        return false;
+    }
+
+    auto &memory     = MemoryModule::Get();
+    const auto frame = memory.GetMmu().Translate(
+        memory.GetKernelMmuContext(), as.PageTableRoot(), vaddr
+    );
+    return frame && IsCachedFrame_(vaddr, *frame);
+}
+
+u64 FileBackedVMemArea::PageIndex_(VPtr<void> addr) const
+{
+    const uptr page = AlignDown(Mem::PtrToUptr(addr), hal::kPageSizeBytes);
+    return (page - Mem::PtrToUptr(start_) + file_offset_) / hal::kPageSizeBytes;
+}
+
+bool FileBackedVMemArea::IsCachedFrame_(VPtr<void> vaddr, PPtr<void> frame) const
+{
+    const auto cached = VfsModule::Get().GetPageCache().FindFrame(*file_, PageIndex_(vaddr));
+    return cached != nullptr && Mem::PtrToUptr(cached) == Mem::PtrToUptr(frame);
+}
+
+bool FileBackedVMemArea::MapPrivateCopy_(AddressSpace &as, VPtr<void> vaddr, PPtr<void> source)
+{
+    auto page_res = MemoryModule::Get().GetBitmapPmm().Alloc();
+    if (!page_res) {
+        TRACE_FATAL_MEMORY("OOM during copy-on-write page fault");
+        return false;
+    }
+
+    PPtr<void> phys_page = *page_res;
+    memcpy(Mem::PhysToVirt(phys_page), Mem::PhysToVirt(source), hal::kPageSizeBytes);
+
+    return MapPage(as, vaddr, phys_page, flags_);
+}
+
 // -----------------------------------------------------------------------------
 // KernelSyncVMemArea
 // -----------------------------------------------------------------------------
@@ -6,9 +6,16 @@
 #define KERNEL_SRC_MEM_VIRT_AREA_HPP_
 
 #include <types.h>
+#include <expected.hpp>
+#include "mem/error.hpp"
 #include "mem/types.hpp"
 #include "mem/virt/page_fault_data.hpp"
 
+namespace Fs
+{
+class File;
+}  // namespace Fs
+
 namespace Mem
 {
 
@@ -20,9 +27,27 @@ struct VirtualMemAreaFlags {
     bool executable : 1;
     bool write_through : 1 = false;
     bool cache_disable : 1 = false;
+    bool write_combining : 1 = false;
 };
 using VMemAreaFlags = VirtualMemAreaFlags;
 
+/**
+ * @brief Who created an area. Processes may only unmap or re-protect their own mappings.
+ */
+enum class VMemAreaOrigin : u8 {
+    kKernel,  ///< Stack, heap, loaded segments and buffers shared by the kernel
+    kMmap,    ///< Mapped by the process itself
+};
+
+/**
+ * @brief Page of a file a fault has to read in before the area can resolve it.
+ */
+struct FaultFilePage {
+    Fs::File *file{nullptr};  ///< nullptr when the fault needs no file page
+    u64 index{0};
+    bool dirty{false};  ///< The page is mapped writable into a shared mapping
+};
+
 /**
  * @brief Abstract base class representing a Virtual Memory Area.
  * Defines the range, permissions, and behavior on page faults.
@@ -48,6 +73,60 @@ class VMemArea
         VPtr<void> fault_addr, const PageFaultData::ErrorCode &err, AddressSpace &as
     ) = 0;
 
+    /**
+     * @brief Handles a protection fault on a page that is already mapped within this area.
+     * @return true if the fault was resolved (e.g. copy-on-write), false otherwise.
+     */
+    virtual bool HandleProtectionFault(VPtr<void>, const PageFaultData::ErrorCode &, AddressSpace &)
+    {
+        return false;
+    }
+
+    /**
+     * @brief The file page the fault needs cached. The page fault handler reads it in without
+     * the address space lock, as the page cache blocks, before calling the handlers above.
+     */
+    NODISCARD virtual FaultFilePage GetFaultFilePage(
+        VPtr<void>, const PageFaultData::ErrorCode &
+    ) const
+    {
+        return {};
+    }
+
+    /**
+     * @brief Writes modified contents of this area back to its backing store, if it has one.
+     */
+    virtual std::expected<void, MemError> Sync(AddressSpace &) { return {}; }
+
+    /**
+     * @brief Whether the frame mapped at vaddr belongs to this area and is freed with it.
+     */
+    NODISCARD virtual bool OwnsFrame(VPtr<void>, PPtr<void>) const { return false; }
+
+    /**
+     * @brief Returns the frames owned by this area to the physical allocator, leaving its pages
+     * mapped. Only for address spaces nobody runs in anymore, Vmm::RmArea() unmaps live areas
+     * before freeing their frames.
+     */
+    void ReleaseFrames(AddressSpace &as) const;
+
+    /**
+     * @brief Whether the access permissions of this area may be changed to the given ones.
+     */
+    NODISCARD virtual bool CanChangeFlags(VirtualMemAreaFlags) const { return true; }
+
+    /**
+     * @brief Whether the mapped page at vaddr shares its frame copy-on-write. Such pages stay
+     * read-only when the area becomes writable, so the first write still copies them.
+     */
+    NODISCARD virtual bool IsCopyOnWrite(AddressSpace &, VPtr<void>) const { return false; }
+
+    /**
+     * @brief Back the area with another physical range of the same size. Only direct mappings
+     * support it, the caller unmaps the pages so they fault in from the new range.
+     */
+    NODISCARD virtual bool Retarget(PPtr<void>) { return false; }
+
     // Getters
     NODISCARD VPtr<void> GetStart() const { return start_; }
     NODISCARD size_t GetSize() const { return size_; }
@@ -56,14 +135,17 @@ class VMemArea
         return reinterpret_cast<VPtr<void>>(reinterpret_cast<uptr>(start_) + size_);
     }
     NODISCARD VirtualMemAreaFlags GetFlags() const { return flags_; }
+    NODISCARD VMemAreaOrigin GetOrigin() const { return origin_; }
 
     // Mutators
     void SetFlags(VirtualMemAreaFlags flags) { flags_ = flags; }
+    void SetOrigin(VMemAreaOrigin origin) { origin_ = origin; }
 
     protected:
     VPtr<void> start_;
     size_t size_;
     VirtualMemAreaFlags flags_;
+    VMemAreaOrigin origin_{VMemAreaOrigin::kKernel};
 };
 
 /**
@@ -77,6 +159,8 @@ class AnonymousVMemArea final : public VMemArea
     bool HandleFault(
         VPtr<void> fault_addr, const PageFaultData::ErrorCode &err, AddressSpace &as
     ) override;
+
+    NODISCARD bool OwnsFrame(VPtr<void>, PPtr<void>) const override { return true; }
 };
 
 /**
@@ -96,10 +180,71 @@ class DirectMappingVMemArea final : public VMemArea
         VPtr<void> fault_addr, const PageFaultData::ErrorCode &err, AddressSpace &as
     ) override;
 
+    NODISCARD bool Retarget(PPtr<void> phys_start) override
+    {
+        phys_start_ = phys_start;
+        return true;
+    }
+
     private:
     PPtr<void> phys_start_;
 };
 
+/**
+ * @brief Represents a mapping of a file, backed by the frames of the page cache.
+ *
+ * Shared mappings map the cached frames directly, so stores reach the file on write-back.
+ * Private mappings map the cached frames read-only, which lets every process mapping the same
+ * file share them, and copy a page on the first write to it.
+ */
+class FileBackedVMemArea final : public VMemArea
+{
+    public:
+    FileBackedVMemArea(
+        VPtr<void> start, size_t size, VirtualMemAreaFlags flags, Fs::File &file, u64 file_offset,
+        bool shared
+    );
+    ~FileBackedVMemArea() override;
+
+    bool HandleFault(
+        VPtr<void> fault_addr, const PageFaultData::ErrorCode &err, AddressSpace &as
+    ) override;
+
+    bool HandleProtectionFault(
+        VPtr<void> fault_addr, const PageFaultData::ErrorCode &err, AddressSpace &as
+    ) override;
+
+    NODISCARD FaultFilePage GetFaultFilePage(
+        VPtr<void> fault_addr, const PageFaultData::ErrorCode &err
+    ) const override;
+
+    std::expected<void, MemError> Sync(AddressSpace &as) override;
+
+    /**
+     * @brief Only private copies of written pages, the cached frames belong to the cache.
+     */
+    NODISCARD bool OwnsFrame(VPtr<void> vaddr, PPtr<void> frame) const override;
+
+    // Write access to the file was checked at map time, so only shared mappings created
+    // writable may gain write access. Private mappings copy pages on write anyway.
+    NODISCARD bool CanChangeFlags(VirtualMemAreaFlags flags) const override
+    {
+        return !flags.writable || !shared_ || created_writable_;
+    }
+
+    NODISCARD bool IsCopyOnWrite(AddressSpace &as, VPtr<void> vaddr) const override;
+
+    private:
+    NODISCARD u64 PageIndex_(VPtr<void> addr) const;
+    NODISCARD bool IsCachedFrame_(VPtr<void> vaddr, PPtr<void> frame) const;
+    NODISCARD bool MapPrivateCopy_(AddressSpace &as, VPtr<void> vaddr, PPtr<void> source);
+
+    Fs::File *file_;
+    u64 file_offset_;
+    bool shared_;
+    bool created_writable_;
+};
+
 /**
  * @brief Represents the kernel address space area.
  * Handles lazy synchronization of kernel mappings into user address spaces.
@@ -8,9 +8,11 @@
 
 #include "hal/intr_parser.hpp"
 #include "hal/panic.hpp"
+#include "hal/user_copy.hpp"
 #include "mem/virt/addr_space.hpp"
 #include "modules/memory.hpp"
 #include "modules/scheduling.hpp"
+#include "modules/vfs.hpp"
 #include "trace_framework.hpp"
 
 namespace Mem
@@ -67,7 +69,7 @@ NO_RET void PanicPageFault(const PageFaultData &pfd, const hal::ExceptionData &d
     );
 }
 
-void HandleUnresolvableFault(const PageFaultData &pfd, const hal::ExceptionData &data)
+void HandleUnresolvableFault(const PageFaultData &pfd, hal::ExceptionData &data)
 {
     if (hal::IsInterruptFromUserSpace(data)) {
         auto pid = hardware::GetRunningPid();
@@ -83,7 +85,8 @@ void HandleUnresolvableFault(const PageFaultData &pfd, const hal::ExceptionData
         }
 
         SchedulingModule::Get().GetTaskMgr().CommitSuicide();
-    } else {
+    } else if (!hal::FixupUserCopyFault(data)) {
+        // Faults of the user copy routine fail the copy, any other kernel fault is a bug
         PanicPageFault(pfd, data);
     }
 }
@@ -112,10 +115,45 @@ Sched::Thread *PageFaultHandler(intr::LitExcEntry &, hal::ExceptionData *data)
     }
     VMemArea *vma = *(*vma_res);
 
+    // Reading a file page in blocks, and the page cache copies from user memory that faults into
+    // this handler itself, so the lock is dropped meanwhile. The file is kept alive by a reference
+    // of its own, as the area may go away. Any change to the areas or to the faulting page makes
+    // the access fault again instead.
+    if (const auto page = vma->GetFaultFilePage(f_ptr, err); page.file != nullptr) {
+        auto &memory         = MemoryModule::Get();
+        const u64 generation = as.generation_;
+        const auto mapped    = memory.GetMmu().Translate(
+            memory.GetKernelMmuContext(), as.PageTableRoot(), f_ptr
+        );
+
+        page.file->AddRef();
+        as.Unlock();
+
+        const auto frame =
+            VfsModule::Get().GetPageCache().GetFrame(*page.file, page.index, page.dirty);
+        page.file->Release();
+
+        as.Lock();
+        if (!frame) {
+            TRACE_WARN_MEMORY("Failed to read in file page for fault at %p", f_ptr);
+            HandleUnresolvableFault(pfd, *data);
+            return nullptr;
+        }
+
+        const auto remapped = memory.GetMmu().Translate(
+            memory.GetKernelMmuContext(), as.PageTableRoot(), f_ptr
+        );
+        if (as.generation_ != generation || mapped.has_value() != remapped.has_value() ||
+            (mapped && *mapped != *remapped)) {
+            return nullptr;
+        }
+    }
+
     if (err.present) {
-        // Protection violation
-        // TODO: CoW handling would go here via vma->HandleProtectionFault()
-        HandleUnresolvableFault(pfd, *data);
+        // Protection violation, resolvable only by areas implementing copy-on-write
+        if (!vma->HandleProtectionFault(f_ptr, err, as)) {
+            HandleUnresolvableFault(pfd, *data);
+        }
         return nullptr;
     }
 
@@ -0,0 +1,89 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025-2026 The AlkOS Authors
+// See the AUTHORS file for the full list of contributors.
+
+#include "mem/virt/user_access.hpp"
+
+#include <string.h>
+#include <algorithm.hpp>
+#include <internal/macros.hpp>
+
+#include "hal/constants.hpp"
+#include "hal/user_copy.hpp"
+#include "mem/virt/addr_space.hpp"
+#include "modules/memory.hpp"
+
+namespace Mem
+{
+
+namespace
+{
+// No-access areas stay mapped as supervisor pages, so copies into them would not fault
+bool IsAccessibleUserRange(const void *user_ptr, const size_t size)
+{
+    auto &as = MemoryModule::Get().GetVmm().GetCurrentAddressSpace();
+    return size == 0 || as.IsAccessible(const_cast<void *>(user_ptr), size);
+}
+}  // namespace
+
+std::expected<void, MemError> CopyFromUser(void *dst, const void *user_src, const size_t size)
+{
+    RET_UNEXPECTED_IF(!IsUserRange(user_src, size), MemError::BadAddress);
+    RET_UNEXPECTED_IF(!IsAccessibleUserRange(user_src, size), MemError::BadAddress);
+    RET_UNEXPECTED_IF(hal::CopyUserBytes(dst, user_src, size) != 0, MemError::BadAddress);
+    return {};
+}
+
+std::expected<void, MemError> CopyToUser(void *user_dst, const void *src, const size_t size)
+{
+    RET_UNEXPECTED_IF(!IsUserRange(user_dst, size), MemError::BadAddress);
+    RET_UNEXPECTED_IF(!IsAccessibleUserRange(user_dst, size), MemError::BadAddress);
+    RET_UNEXPECTED_IF(hal::CopyUserBytes(user_dst, src, size) != 0, MemError::BadAddress);
+    return {};
+}
+
+std::expected<void, MemError> CopyFromCaller(void *dst, const void *src, const size_t size)
+{
+    if (IsKernelSpace(src)) {
+        memcpy(dst, src, size);
+        return {};
+    }
+    return CopyFromUser(dst, src, size);
+}
+
+std::expected<void, MemError> CopyToCaller(void *dst, const void *src, const size_t size)
+{
+    if (IsKernelSpace(dst)) {
+        memcpy(dst, src, size);
+        return {};
+    }
+    return CopyToUser(dst, src, size);
+}
+
+std::expected<size_t, MemError> CopyStringFromUser(
+    char *dst, const char *user_src, const size_t capacity
+)
+{
+    RET_UNEXPECTED_IF(user_src == nullptr, MemError::BadAddress);
+
+    // Copy page by page, so no page past the one holding the terminator is ever touched
+    size_t copied = 0;
+    while (copied < capacity) {
+        const u64 src        = reinterpret_cast<u64>(user_src) + copied;
+        const size_t to_page = hal::kPageSizeBytes - (src & (hal::kPageSizeBytes - 1));
+        const size_t chunk   = std::min(to_page, capacity - copied);
+
+        const auto result = CopyFromUser(dst + copied, user_src + copied, chunk);
+        RET_UNEXPECTED_IF_ERR(result);
+
+        const size_t length = strnlen(dst + copied, chunk);
+        if (length < chunk) {
+            return copied + length;
+        }
+        copied += chunk;
+    }
+
+    return std::unexpected(MemError::InvalidArgument);
+}
+
+}  // namespace Mem
@@ -0,0 +1,86 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025-2026 The AlkOS Authors
+// See the AUTHORS file for the full list of contributors.
+
+#ifndef KERNEL_SRC_MEM_VIRT_USER_ACCESS_HPP_
+#define KERNEL_SRC_MEM_VIRT_USER_ACCESS_HPP_
+
+#include <defines.hpp>
+#include <expected.hpp>
+#include <limits.hpp>
+
+#include "constants.hpp"
+#include "mem/error.hpp"
+
+namespace Mem
+{
+
+/**
+ * @brief Check that [start, start + size) lies entirely in the user half of the address space
+ */
+NODISCARD FAST_CALL bool IsUserRange(const u64 start, const u64 size)
+{
+    return start <= kUserSpaceEndExclusive && size <= kUserSpaceEndExclusive - start;
+}
+
+NODISCARD FAST_CALL bool IsUserRange(const void *start, const u64 size)
+{
+    return IsUserRange(reinterpret_cast<u64>(start), size);
+}
+
+/**
+ * @brief Check that an array of count elements lies entirely in user space
+ */
+template <typename T>
+NODISCARD FORCE_INLINE_F bool IsUserArray(const T *start, const u64 count)
+{
+    return count <= std::numeric_limits<u64>::max() / sizeof(T) &&
+           IsUserRange(start, count * sizeof(T));
+}
+
+/**
+ * @brief Copy size bytes from user space, faults on the user pages fail the copy instead of
+ * panicking the kernel
+ */
+NODISCARD std::expected<void, MemError> CopyFromUser(void *dst, const void *user_src, size_t size);
+
+/**
+ * @brief Copy size bytes to user space, faults on the user pages fail the copy instead of
+ * panicking the kernel
+ */
+NODISCARD std::expected<void, MemError> CopyToUser(void *user_dst, const void *src, size_t size);
+
+/**
+ * @brief Copy a null terminated string from user space, reading at most capacity bytes
+ * @return Length of the string without the terminator, InvalidArgument if it does not fit
+ */
+NODISCARD std::expected<size_t, MemError> CopyStringFromUser(
+    char *dst, const char *user_src, size_t capacity
+);
+
+/**
+ * @brief Copy from a buffer handed in by a syscall or by the kernel itself. User buffers go
+ * through CopyFromUser(), kernel buffers are copied directly.
+ */
+NODISCARD std::expected<void, MemError> CopyFromCaller(void *dst, const void *src, size_t size);
+
+/**
+ * @brief Copy to a buffer handed in by a syscall or by the kernel itself, see CopyFromCaller()
+ */
+NODISCARD std::expected<void, MemError> CopyToCaller(void *dst, const void *src, size_t size);
+
+template <typename T>
+NODISCARD FORCE_INLINE_F std::expected<void, MemError> CopyFromUser(T &dst, const T *user_src)
+{
+    return CopyFromUser(&dst, user_src, sizeof(T));
+}
+
+template <typename T>
+NODISCARD FORCE_INLINE_F std::expected<void, MemError> CopyToUser(T *user_dst, const T &src)
+{
+    return CopyToUser(user_dst, &src, sizeof(T));
+}
+
+}  // namespace Mem
+
+#endif  // KERNEL_SRC_MEM_VIRT_USER_ACCESS_HPP_
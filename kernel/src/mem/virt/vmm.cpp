@@ -4,8 +4,10 @@
 
 #include "mem/virt/vmm.hpp"
 
+#include <algorithm.hpp>
 #include <bits_ext.hpp>
 #include <internal/macros.hpp>
+#include <mutex.hpp>
 #include <template/scope_guard.hpp>
 
 #include "constants.hpp"
@@ -79,6 +81,7 @@ expected<VPtr<AddressSpace>, MemError> Vmm::CreateUserAddrSpace()
 
 expected<void, MemError> Vmm::DestroyUserAddrSpace(VPtr<AddressSpace> as)
 {
+    as->ReleaseAllFrames();
     mmu_->ClearUserMappings(*ctx_, as->PageTableRoot());
     KDelete(as);
     return {};
@@ -102,15 +105,70 @@ expected<VPtr<void>, MemError> Vmm::AddArea(VPtr<AddrSp> as, VMemArea *vma)
 
 expected<void, MemError> Vmm::RmArea(VPtr<AddrSp> as, VPtr<void> region_start)
 {
-    auto hint_res = as->RmArea(region_start);
-    RET_UNEXPECTED_IF_ERR(hint_res);
-    auto hint = *hint_res;
+    // Unlinked first, so no fault maps the area again while it is torn down
+    auto vma_res = as->UnlinkArea(region_start);
+    RET_UNEXPECTED_IF_ERR(vma_res);
+    VMemArea *vma = *vma_res;
 
-    tlb_->InvalidateRange(hint.start, hint.size);
+    UnmapArea_(*as, *vma);
+
+    // Releasing a file mapping may write the file back, which blocks, so no lock is held here
+    KDelete(vma);
 
     return {};
 }
 
+void Vmm::UnmapArea_(AddressSpace &as, const VMemArea &vma)
+{
+    // Frames are freed only once no page table or TLB entry refers to them anymore, which takes
+    // collecting the frames of a batch of pages before unmapping it
+    static constexpr size_t kBatchPages = 64;
+    static constexpr size_t kBatchSize  = kBatchPages * hal::kPageSizeBytes;
+
+    auto &pmm = MemoryModule::Get().GetBitmapPmm();
+    PPtr<void> frames[kBatchPages];
+
+    const uptr end = PtrToUptr(vma.GetEnd());
+    for (uptr batch = PtrToUptr(vma.GetStart()); batch < end; batch += kBatchSize) {
+        const auto start  = UptrToPtr<void>(batch);
+        const size_t size = std::min<size_t>(kBatchSize, end - batch);
+
+        size_t count = 0;
+        {
+            // Page tables are shared with the neighbouring areas, which may fault meanwhile
+            std::lock_guard guard(as.area_list_lock_);
+
+            mmu_->VisitMappedPages(
+                as.PageTableRoot(), start, size,
+                [&](VPtr<void> vaddr, PPtr<void> frame) {
+                    if (vma.OwnsFrame(vaddr, frame)) {
+                        frames[count++] = frame;
+                    }
+                }
+            );
+            mmu_->UnmapRange(*ctx_, as.PageTableRoot(), start, size);
+        }
+        tlb_->InvalidateRange(start, size);
+
+        for (size_t i = 0; i < count; ++i) {
+            pmm.Free(reinterpret_cast<PPtr<Page>>(frames[i]));
+        }
+    }
+}
+
+expected<void, MemError> Vmm::UnmapUserArea(VPtr<AddrSp> as, VPtr<void> region_start)
+{
+    auto vma_res = as->FindArea(region_start);
+    RET_UNEXPECTED_IF_ERR(vma_res);
+
+    // Areas are removed whole, an address inside one does not name it
+    const VMemArea *vma = *vma_res;
+    RET_UNEXPECTED_IF(vma->GetStart() != region_start, MemError::InvalidArgument);
+    RET_UNEXPECTED_IF(vma->GetOrigin() != VMemAreaOrigin::kMmap, MemError::InvalidArgument);
+
+    return RmArea(as, region_start);
+}
+
 expected<void, MemError> Vmm::UpdateAreaFlags(
     VPtr<AddressSpace> as, VPtr<void> region_start, VirtualMemAreaFlags vmaf
 )
@@ -124,9 +182,30 @@ expected<void, MemError> Vmm::UpdateAreaFlags(
     return {};
 }
 
+expected<void, MemError> Vmm::ProtectArea(
+    VPtr<AddressSpace> as, VPtr<void> region_start, bool readable, bool writable,
+    bool executable
+)
+{
+    auto vma_res = as->FindArea(region_start);
+    RET_UNEXPECTED_IF_ERR(vma_res);
+    const VMemArea *vma = *vma_res;
+
+    RET_UNEXPECTED_IF(vma->GetStart() != region_start, MemError::InvalidArgument);
+    RET_UNEXPECTED_IF(vma->GetOrigin() != VMemAreaOrigin::kMmap, MemError::InvalidArgument);
+
+    VirtualMemAreaFlags flags = vma->GetFlags();
+    flags.readable            = readable;
+    flags.writable            = writable;
+    flags.executable          = executable;
+    RET_UNEXPECTED_IF(!vma->CanChangeFlags(flags), MemError::InvalidArgument);
+
+    return UpdateAreaFlags(as, region_start, flags);
+}
+
 expected<VPtr<void>, MemError> Vmm::AllocAnonymous(
     VPtr<AddressSpace> as, size_t size, VirtualMemAreaFlags flags, VPtr<void> range_start,
-    VPtr<void> range_end
+    VPtr<void> range_end, VMemAreaOrigin origin
 )
 {
     auto gap_res = as->FindGap(size, range_start, range_end);
@@ -136,6 +215,7 @@ expected<VPtr<void>, MemError> Vmm::AllocAnonymous(
     auto vma_res = KNew<AnonymousVMemArea>(gap.start, gap.size, flags);
     RET_UNEXPECTED_IF(!vma_res, MemError::OutOfMemory);
     auto *vma = *vma_res;
+    vma->SetOrigin(origin);
 
     UpdateAreaFlags(as, vma->GetStart(), flags);
 
@@ -192,16 +272,71 @@ expected<VPtr<void>, MemError> Vmm::AllocKernelHeap(size_t size)
 expected<VPtr<void>, MemError> Vmm::MapUserBackbuffer(
     VPtr<AddressSpace> as, PPtr<void> buffer, size_t size_bytes
 )
+{
+    VMemAreaFlags flags{.readable = true, .writable = true, .executable = true};
+    return MapUserShared(as, buffer, size_bytes, flags);
+}
+
+expected<VPtr<void>, MemError> Vmm::MapUserShared(
+    VPtr<AddressSpace> as, PPtr<void> buffer, size_t size_bytes, VirtualMemAreaFlags flags
+)
+{
+    return MapPhysical(
+        as, buffer, size_bytes, flags, UptrToPtr<void>(kUserSpaceStart),
+        UptrToPtr<void>(kUserSpaceEndExclusive)
+    );
+}
+
+expected<void, MemError> Vmm::SetDirectMapFlags(
+    PPtr<void> buffer, size_t size_bytes, VirtualMemAreaFlags flags
+)
+{
+    static constexpr u64 kDirectMapSize = hal::kDirectMemMapSizeGb * 1024ULL * 1024ULL * 1024ULL;
+
+    RET_UNEXPECTED_IF(!IsAligned(buffer, hal::kPageSizeBytes), MemError::InvalidArgument);
+    RET_UNEXPECTED_IF(PtrToUptr(buffer) + size_bytes > kDirectMapSize, MemError::InvalidArgument);
+
+    const hal::PageFlags pf{
+        .Present        = true,
+        .Writable       = flags.writable,
+        .UserAccessible = false,
+        .WriteThrough   = flags.write_through,
+        .CacheDisable   = flags.cache_disable,
+        .WriteCombining = flags.write_combining,
+        .Global         = true,
+        .NoExecute      = !flags.executable
+    };
+
+    const auto root  = kernel_as_.PageTableRoot();
+    const uptr start = PtrToUptr(PhysToVirt(buffer));
+    const uptr end   = start + AlignUp(size_bytes, hal::kPageSizeBytes);
+
+    for (uptr v = start; v < end; v += hal::kPageSizeBytes) {
+        const auto split_res = mmu_->SplitHugePages(*ctx_, root, UptrToPtr<void>(v));
+        RET_UNEXPECTED_IF_ERR(split_res);
+
+        const auto flags_res = mmu_->SetPageFlags(root, UptrToPtr<void>(v), pf);
+        RET_UNEXPECTED_IF_ERR(flags_res);
+    }
+
+    // Lines cached under the old memory type must not outlive it
+    tlb_->InvalidateRange(UptrToPtr<void>(start), end - start);
+    mmu_->FlushCacheLines(UptrToPtr<void>(start), end - start);
+
+    return {};
+}
+
+expected<VPtr<void>, MemError> Vmm::MapPhysical(
+    VPtr<AddressSpace> as, PPtr<void> buffer, size_t size_bytes, VirtualMemAreaFlags flags,
+    VPtr<void> range_start, VPtr<void> range_end
+)
 {
     R_ASSERT_TRUE(IsAligned(buffer, hal::kPageSizeBytes));
     size_t al_size = AlignUp(size_bytes, hal::kPageSizeBytes);
 
-    auto gap_res = as->FindGap(
-        al_size, UptrToPtr<void>(kUserSpaceStart), UptrToPtr<void>(kUserSpaceEndExclusive)
-    );
+    auto gap_res = as->FindGap(al_size, range_start, range_end);
     RET_UNEXPECTED_IF_ERR(gap_res);
 
-    VMemAreaFlags flags{.readable = true, .writable = true, .executable = true};
     auto vma_res = KNew<DirectMappingVMemArea>(gap_res->start, gap_res->size, flags, buffer);
     RET_UNEXPECTED_IF(!vma_res, MemError::OutOfMemory);
     auto *vma = *vma_res;
@@ -218,4 +353,54 @@ expected<VPtr<void>, MemError> Vmm::MapUserBackbuffer(
     return gap_res->start;
 }
 
+expected<void, MemError> Vmm::RetargetUserShared(
+    VPtr<AddressSpace> as, VPtr<void> region_start, PPtr<void> buffer, VirtualMemAreaFlags flags
+)
+{
+    RET_UNEXPECTED_IF(!IsAligned(buffer, hal::kPageSizeBytes), MemError::InvalidArgument);
+
+    auto hint_res = as->RetargetArea(region_start, buffer, flags);
+    RET_UNEXPECTED_IF_ERR(hint_res);
+    auto hint = *hint_res;
+
+    tlb_->InvalidateRange(hint.start, hint.size);
+
+    return {};
+}
+
+expected<VPtr<void>, MemError> Vmm::MapFile(
+    VPtr<AddressSpace> as, Fs::File &file, u64 file_offset, size_t size,
+    VirtualMemAreaFlags flags, bool shared, VMemAreaOrigin origin
+)
+{
+    RET_UNEXPECTED_IF(size == 0, MemError::InvalidArgument);
+    RET_UNEXPECTED_IF(!IsAligned(file_offset, hal::kPageSizeBytes), MemError::InvalidArgument);
+
+    const size_t al_size = AlignUp(size, hal::kPageSizeBytes);
+
+    auto gap_res = as->FindGap(
+        al_size, UptrToPtr<void>(kUserSpaceStart), UptrToPtr<void>(kUserSpaceEndExclusive)
+    );
+    RET_UNEXPECTED_IF_ERR(gap_res);
+
+    auto vma_res =
+        KNew<FileBackedVMemArea>(gap_res->start, gap_res->size, flags, file, file_offset, shared);
+    RET_UNEXPECTED_IF(!vma_res, MemError::OutOfMemory);
+    (*vma_res)->SetOrigin(origin);
+
+    // AddArea takes ownership of the VMA pointer
+    auto add_res = as->AddArea(*vma_res);
+    RET_UNEXPECTED_IF_ERR(add_res);
+
+    return gap_res->start;
+}
+
+expected<void, MemError> Vmm::SyncArea(VPtr<AddressSpace> as, VPtr<void> region_start)
+{
+    auto vma_res = as->FindArea(region_start);
+    RET_UNEXPECTED_IF_ERR(vma_res);
+
+    return (*vma_res)->Sync(*as);
+}
+
 }  // namespace Mem
@@ -57,13 +57,30 @@ class VirtualMemoryManager
         VPtr<AddressSpace> as, VPtr<void> region_start, VirtualMemAreaFlags vmaf
     );
 
+    /**
+     * @brief Remove an area the process mapped itself, given by its start address. Areas set up
+     * by the kernel and addresses inside an area are refused.
+     */
+    expected<void, MemError> UnmapUserArea(VPtr<AddressSpace> as, VPtr<void> region_start);
+
+    /**
+     * @brief Change the access permissions of a whole area mapped by the process, keeping its
+     * caching attributes. Fails for areas that do not allow the change (see
+     * VMemArea::CanChangeFlags).
+     */
+    expected<void, MemError> ProtectArea(
+        VPtr<AddressSpace> as, VPtr<void> region_start, bool readable, bool writable,
+        bool executable
+    );
+
     // ------------------------------
     // Allocation Helpers
     // ------------------------------
 
     expected<VPtr<void>, MemError> AllocAnonymous(
         VPtr<AddressSpace> as, size_t size, VirtualMemAreaFlags flags,
-        VPtr<void> range_start = nullptr, VPtr<void> range_end = nullptr
+        VPtr<void> range_start = nullptr, VPtr<void> range_end = nullptr,
+        VMemAreaOrigin origin = VMemAreaOrigin::kKernel
     );
 
     expected<VPtr<void>, MemError> AllocUserStack(VPtr<AddressSpace> as, size_t size);
@@ -75,7 +92,49 @@ class VirtualMemoryManager
         VPtr<AddressSpace> as, PPtr<void> buffer, size_t size_bytes
     );
 
+    /**
+     * @brief Map a physically contiguous kernel buffer into user space. The kernel keeps
+     * accessing it through the direct map, the frames stay owned by the caller.
+     */
+    expected<VPtr<void>, MemError> MapUserShared(
+        VPtr<AddressSpace> as, PPtr<void> buffer, size_t size_bytes, VirtualMemAreaFlags flags
+    );
+
+    /**
+     * @brief Change the attributes the direct map uses for a physical range, e.g. to give device
+     * memory the memory type of its other mappings. Huge pages covering the range are split, the
+     * other cores must not have touched the range yet, as their TLBs are not invalidated.
+     */
+    expected<void, MemError> SetDirectMapFlags(
+        PPtr<void> buffer, size_t size_bytes, VirtualMemAreaFlags flags
+    );
+
+    /**
+     * @brief Point a mapping created by MapUserShared() at another physical buffer of the same
+     * size. The contents are not copied, the new flags may change the caching attributes.
+     */
+    expected<void, MemError> RetargetUserShared(
+        VPtr<AddressSpace> as, VPtr<void> region_start, PPtr<void> buffer,
+        VirtualMemAreaFlags flags
+    );
+
+    expected<VPtr<void>, MemError> MapFile(
+        VPtr<AddressSpace> as, Fs::File &file, u64 file_offset, size_t size,
+        VirtualMemAreaFlags flags, bool shared, VMemAreaOrigin origin = VMemAreaOrigin::kKernel
+    );
+    expected<void, MemError> SyncArea(VPtr<AddressSpace> as, VPtr<void> region_start);
+
     private:
+    /**
+     * @brief Unmap an area already unlinked from the address space and free the frames it owns.
+     */
+    void UnmapArea_(AddressSpace &as, const VMemArea &vma);
+
+    expected<VPtr<void>, MemError> MapPhysical(
+        VPtr<AddressSpace> as, PPtr<void> buffer, size_t size_bytes, VirtualMemAreaFlags flags,
+        VPtr<void> range_start, VPtr<void> range_end
+    );
+
     // ------------------------------
     // Class fields
     // ------------------------------
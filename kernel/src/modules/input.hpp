@@ -31,23 +31,45 @@ class InputModule : public template_lib::StaticSingletonHelper
 
         char c = *ascii_opt;
 
+        auto *proc = GetFocusedProcess();
+        if (proc == nullptr) {
+            return;
+        }
+
+        byte b = static_cast<byte>(c);
+        (void)proc->stdin_pipe.Write(std::span<const byte>(&b, 1));
+    }
+
+    /**
+     * @brief Queue a key press or release for the process focused in the active session
+     */
+    void RouteEvent(const InputEvent &event)
+    {
+        auto *proc = GetFocusedProcess();
+        if (proc == nullptr) {
+            return;
+        }
+
+        proc->input_events.Push(event);
+    }
+
+    private:
+    Sched::Process *GetFocusedProcess()
+    {
         auto &wm              = ::VideoModule::Get().GetWindowManager();
         Sched::Pid target_pid = wm.GetActiveSessionFocusedPid();
 
         if (target_pid.id == 0) {
-            return;  // No focus
+            return nullptr;  // No focus
         }
 
         auto proc_res = ::SchedulingModule::Get().GetProcesses().GetProcess(target_pid);
         if (!proc_res) {
             DEBUG_WARN_GENERAL("InputModule: Failed to find process for PID %llu", target_pid.id);
-            return;
+            return nullptr;
         }
 
-        auto *proc = *proc_res;
-
-        byte b = static_cast<byte>(c);
-        (void)proc->stdin_pipe.Write(std::span<const byte>(&b, 1));
+        return *proc_res;
     }
 };
 
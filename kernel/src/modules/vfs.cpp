@@ -26,6 +26,14 @@ using RamdiskT = Fat16<IO>;
 static byte gRamdiskIoStorage[sizeof(io::InMemory)];
 static byte gRamdiskFsStorage[sizeof(RamdiskT<io::InMemory>)];
 
+// Paths that lost part of their string must never reach a filesystem
+static Result<> CheckPath(const Path &path)
+{
+    RET_UNEXPECTED_IF(path.GetError() == PathError::kNoMemory, VfsError::kNoMemory);
+    RET_UNEXPECTED_IF(path.IsEmpty() || !path.IsValid(), VfsError::kInvalidPath);
+    return {};
+}
+
 // ------------------------------
 // Construction
 // ------------------------------
@@ -67,7 +75,8 @@ Result<> internal::VfsModule::Mount(
     const Path &mount_path, MountOptions options, Filesystem &driver
 )
 {
-    RET_UNEXPECTED_IF(mount_path.IsEmpty() || !mount_path.IsAbsolute(), VfsError::kInvalidPath);
+    RET_UNEXPECTED_IF_ERR(CheckPath(mount_path));
+    RET_UNEXPECTED_IF(!mount_path.IsAbsolute(), VfsError::kInvalidPath);
 
     RET_UNEXPECTED_IF(GetMounts().Contains(mount_path.CString()), VfsError::kAlreadyMounted);
 
@@ -80,7 +89,8 @@ Result<> internal::VfsModule::Mount(
 
 Result<> internal::VfsModule::Unmount(const Path &mount_path)
 {
-    RET_UNEXPECTED_IF(mount_path.IsEmpty() || !mount_path.IsAbsolute(), VfsError::kInvalidPath);
+    RET_UNEXPECTED_IF_ERR(CheckPath(mount_path));
+    RET_UNEXPECTED_IF(!mount_path.IsAbsolute(), VfsError::kInvalidPath);
 
     RET_UNEXPECTED_IF(!GetMounts().Contains(mount_path.CString()), VfsError::kNotMounted);
 
@@ -93,7 +103,7 @@ Result<> internal::VfsModule::Unmount(const Path &mount_path)
 
 Result<MountPoint *> internal::VfsModule::FindMountPoint(const Path &path)
 {
-    RET_UNEXPECTED_IF(path.IsEmpty(), VfsError::kInvalidPath);
+    RET_UNEXPECTED_IF_ERR(CheckPath(path));
 
     auto match = GetMounts().GetLongestPrefixMatch(path.CString());
     RET_UNEXPECTED_IF(!match, VfsError::kMountPointNotFound);
@@ -104,11 +114,15 @@ Result<MountPoint *> internal::VfsModule::FindMountPoint(const Path &path)
 // Path Utilities
 // ------------------------------
 
-Path internal::VfsModule::GetRelativePath_(const Path &absolute_path, const Path &mount_path)
+Result<Path> internal::VfsModule::GetRelativePath_(
+    const Path &absolute_path, const Path &mount_path
+)
 {
     // If the mount point is root, the relative path is the same as absolute
     if (mount_path.IsRoot()) {
-        return absolute_path;
+        Path relative = absolute_path;
+        RET_UNEXPECTED_IF_ERR(CheckPath(relative));
+        return relative;
     }
 
     // Build relative path by skipping mount_path components
@@ -120,13 +134,10 @@ Path internal::VfsModule::GetRelativePath_(const Path &absolute_path, const Path
         return Path("/");
     }
 
-    // Build path from remaining components
-    Path result("/");
-    for (size_t i = mount_components; i < absolute_components; ++i) {
-        result /= absolute_path.GetComponent(i);
-    }
-
-    return result;
+    // Build path from remaining components, copying a long path may fail to allocate
+    Path relative = absolute_path.GetSubpath(mount_components);
+    RET_UNEXPECTED_IF_ERR(CheckPath(relative));
+    return relative;
 }
 
 // ------------------------------
@@ -142,8 +153,9 @@ Result<> internal::VfsModule::CreateFile(const Path &path)
 
     RET_UNEXPECTED_IF(mount->options.read_only, VfsError::kReadOnly);
 
-    Path relative_path = GetRelativePath_(path, mount->path);
-    return mount->fs.CreateFile(relative_path);
+    auto relative_path = GetRelativePath_(path, mount->path);
+    RET_UNEXPECTED_IF_ERR(relative_path);
+    return mount->fs.CreateFile(*relative_path);
 }
 
 Result<size_t> internal::VfsModule::ReadFile(
@@ -154,8 +166,9 @@ Result<size_t> internal::VfsModule::ReadFile(
     RET_UNEXPECTED_IF_ERR(mount_result);
 
     MountPoint *mount  = mount_result.value();
-    Path relative_path = GetRelativePath_(path, mount->path);
-    return mount->fs.ReadFile(relative_path, buffer, size, offset);
+    auto relative_path = GetRelativePath_(path, mount->path);
+    RET_UNEXPECTED_IF_ERR(relative_path);
+    return mount->fs.ReadFile(*relative_path, buffer, size, offset);
 }
 
 Result<size_t> internal::VfsModule::WriteFile(
@@ -169,8 +182,9 @@ Result<size_t> internal::VfsModule::WriteFile(
 
     RET_UNEXPECTED_IF(mount->options.read_only, VfsError::kReadOnly);
 
-    Path relative_path = GetRelativePath_(path, mount->path);
-    return mount->fs.WriteFile(relative_path, buffer, size, offset);
+    auto relative_path = GetRelativePath_(path, mount->path);
+    RET_UNEXPECTED_IF_ERR(relative_path);
+    return mount->fs.WriteFile(*relative_path, buffer, size, offset);
 }
 
 Result<> internal::VfsModule::DeleteFile(const Path &path)
@@ -182,8 +196,9 @@ Result<> internal::VfsModule::DeleteFile(const Path &path)
 
     RET_UNEXPECTED_IF(mount->options.read_only, VfsError::kReadOnly);
 
-    Path relative_path = GetRelativePath_(path, mount->path);
-    return mount->fs.DeleteFile(relative_path);
+    auto relative_path = GetRelativePath_(path, mount->path);
+    RET_UNEXPECTED_IF_ERR(relative_path);
+    return mount->fs.DeleteFile(*relative_path);
 }
 
 Result<bool> internal::VfsModule::FileExists(const Path &path)
@@ -192,8 +207,9 @@ Result<bool> internal::VfsModule::FileExists(const Path &path)
     RET_UNEXPECTED_IF_ERR(mount_result);
 
     MountPoint *mount  = mount_result.value();
-    Path relative_path = GetRelativePath_(path, mount->path);
-    return mount->fs.FileExists(relative_path);
+    auto relative_path = GetRelativePath_(path, mount->path);
+    RET_UNEXPECTED_IF_ERR(relative_path);
+    return mount->fs.FileExists(*relative_path);
 }
 
 Result<size_t> internal::VfsModule::GetFileSize(const Path &path)
@@ -202,8 +218,9 @@ Result<size_t> internal::VfsModule::GetFileSize(const Path &path)
     RET_UNEXPECTED_IF_ERR(mount_result);
 
     MountPoint *mount  = mount_result.value();
-    Path relative_path = GetRelativePath_(path, mount->path);
-    return mount->fs.GetFileSize(relative_path);
+    auto relative_path = GetRelativePath_(path, mount->path);
+    RET_UNEXPECTED_IF_ERR(relative_path);
+    return mount->fs.GetFileSize(*relative_path);
 }
 
 // ------------------------------
@@ -219,8 +236,9 @@ Result<> internal::VfsModule::CreateDirectory(const Path &path)
 
     RET_UNEXPECTED_IF(mount->options.read_only, VfsError::kReadOnly);
 
-    Path relative_path = GetRelativePath_(path, mount->path);
-    return mount->fs.CreateDirectory(relative_path);
+    auto relative_path = GetRelativePath_(path, mount->path);
+    RET_UNEXPECTED_IF_ERR(relative_path);
+    return mount->fs.CreateDirectory(*relative_path);
 }
 
 Result<> internal::VfsModule::RemoveDirectory(const Path &path)
@@ -232,8 +250,9 @@ Result<> internal::VfsModule::RemoveDirectory(const Path &path)
 
     RET_UNEXPECTED_IF(mount->options.read_only, VfsError::kReadOnly);
 
-    Path relative_path = GetRelativePath_(path, mount->path);
-    return mount->fs.RemoveDirectory(relative_path);
+    auto relative_path = GetRelativePath_(path, mount->path);
+    RET_UNEXPECTED_IF_ERR(relative_path);
+    return mount->fs.RemoveDirectory(*relative_path);
 }
 
 Result<bool> internal::VfsModule::DirectoryExists(const Path &path)
@@ -242,8 +261,9 @@ Result<bool> internal::VfsModule::DirectoryExists(const Path &path)
     RET_UNEXPECTED_IF_ERR(mount_result);
 
     MountPoint *mount  = mount_result.value();
-    Path relative_path = GetRelativePath_(path, mount->path);
-    return mount->fs.DirectoryExists(relative_path);
+    auto relative_path = GetRelativePath_(path, mount->path);
+    RET_UNEXPECTED_IF_ERR(relative_path);
+    return mount->fs.DirectoryExists(*relative_path);
 }
 
 // ------------------------------
@@ -256,8 +276,9 @@ Result<bool> internal::VfsModule::Exists(const Path &path)
     RET_UNEXPECTED_IF_ERR(mount_result);
 
     MountPoint *mount  = mount_result.value();
-    Path relative_path = GetRelativePath_(path, mount->path);
-    return mount->fs.Exists(relative_path);
+    auto relative_path = GetRelativePath_(path, mount->path);
+    RET_UNEXPECTED_IF_ERR(relative_path);
+    return mount->fs.Exists(*relative_path);
 }
 
 Result<> internal::VfsModule::Move(const Path &old_path, const Path &new_path)
@@ -279,8 +300,10 @@ Result<> internal::VfsModule::Move(const Path &old_path, const Path &new_path)
         return std::unexpected(VfsError::kReadOnly);
     }
 
-    Path old_relative = GetRelativePath_(old_path, old_mount->path);
-    Path new_relative = GetRelativePath_(new_path, new_mount->path);
+    auto old_relative = GetRelativePath_(old_path, old_mount->path);
+    RET_UNEXPECTED_IF_ERR(old_relative);
+    auto new_relative = GetRelativePath_(new_path, new_mount->path);
+    RET_UNEXPECTED_IF_ERR(new_relative);
 
-    return old_mount->fs.Move(old_relative, new_relative);
+    return old_mount->fs.Move(*old_relative, *new_relative);
 }
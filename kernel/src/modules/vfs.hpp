@@ -7,6 +7,7 @@
 
 #include "boot_args.hpp"
 #include "fs/file_descriptor.hpp"
+#include "fs/page_cache.hpp"
 #include "fs/vfs/types.hpp"
 #include "modules/helpers.hpp"
 #include "template_lib.hpp"
@@ -28,6 +29,7 @@ class VfsModule : template_lib::StaticSingletonHelper
 
     DEFINE_MODULE_FIELD(vfs, Mounts);
     DEFINE_MODULE_FIELD(Fs, FdManager);
+    DEFINE_MODULE_FIELD(Fs, PageCache);
 
     // ------------------------------
     // Mount Point Management
@@ -156,9 +158,12 @@ class VfsModule : template_lib::StaticSingletonHelper
             return;
         }
 
-        vfs::MountPoint *mount  = mount_result.value();
-        vfs::Path relative_path = GetRelativePath_(path, mount->path);
-        mount->fs.ListDirectory(relative_path, std::forward<Callback>(callback));
+        vfs::MountPoint *mount   = mount_result.value();
+        const auto relative_path = GetRelativePath_(path, mount->path);
+        if (!relative_path.has_value()) {
+            return;
+        }
+        mount->fs.ListDirectory(*relative_path, std::forward<Callback>(callback));
     }
 
     /**
@@ -196,9 +201,11 @@ class VfsModule : template_lib::StaticSingletonHelper
      *
      * @param absolute_path The full absolute path
      * @param mount_path The mount point path
-     * @return Path relative to the mount point
+     * @return Path relative to the mount point, or kNoMemory when a long path fails to copy
      */
-    static vfs::Path GetRelativePath_(const vfs::Path &absolute_path, const vfs::Path &mount_path);
+    static vfs::Result<vfs::Path> GetRelativePath_(
+        const vfs::Path &absolute_path, const vfs::Path &mount_path
+    );
 };
 
 }  // namespace internal
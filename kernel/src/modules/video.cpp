@@ -4,6 +4,7 @@
 
 #include "modules/video.hpp"
 #include "mem/types.hpp"
+#include "modules/memory.hpp"
 #include "trace_framework.hpp"
 
 #include <native_pixel.hpp>
@@ -22,6 +23,21 @@ internal::VideoModule::VideoModule(const BootArguments &args, Heap &hp) noexcept
 
     R_ASSERT_NOT_NULL(fb_pptr, "VideoModule: Framebuffer is null");
 
+    // The direct map covers VRAM as write-back, mixing that with the write-combining user
+    // mappings of the screen is undefined. The kernel draws through the direct map, so VRAM gets
+    // the same memory type there instead of a second alias.
+    const uptr fb_phys   = PtrToUptr(fb_pptr);
+    const uptr fb_page   = AlignDown(fb_phys, hal::kPageSizeBytes);
+    const size_t fb_size = static_cast<size_t>(fb_args.pitch) * fb_args.height;
+
+    VirtualMemAreaFlags vram_flags{
+        .readable = true, .writable = true, .executable = false, .write_combining = true
+    };
+    const auto vram_res = MemoryModule::Get().GetVmm().SetDirectMapFlags(
+        UptrToPtr<void>(fb_page), fb_size + (fb_phys - fb_page), vram_flags
+    );
+    R_ASSERT_TRUE(static_cast<bool>(vram_res), "VideoModule: Failed to map VRAM write-combining");
+
     auto s  = Surface(PhysToVirt(fb_pptr), fb_args.width, fb_args.height, fb_args.pitch);
     auto pf = PixelFormat{
         .red_pos         = fb_args.red_pos,
@@ -32,7 +48,7 @@ internal::VideoModule::VideoModule(const BootArguments &args, Heap &hp) noexcept
         .blue_mask_size  = fb_args.blue_mask_size,
     };
 
-    Framebuffer_.Init(s, pf);
+    Framebuffer_.Init(s, pf, fb_pptr);
     Graphics::Surface &screen = Framebuffer_.GetSurface();
     R_ASSERT_TRUE(screen.IsValid());
 
@@ -8,6 +8,7 @@
 #include <modules/memory.hpp>
 #include <modules/scheduling.hpp>
 #include <modules/vfs.hpp>
+#include <modules/video.hpp>
 #include <sys/loader.hpp>
 #include <syscalls/calls/thread.hpp>
 
@@ -47,6 +48,24 @@ void Sched::ProcessRipperMain()
     }
 }
 
+void Sched::PageCacheFlusherMain()
+{
+    TRACE_INFO_SCHEDULING("Created new PageCacheFlusher!");
+
+    while (true) {
+        VfsModule::Get().GetPageCache().FlusherWork();
+    }
+}
+
+void Sched::CompositorMain()
+{
+    TRACE_INFO_SCHEDULING("Created new Compositor!");
+
+    while (true) {
+        VideoModule::Get().GetWindowManager().CompositorWork();
+    }
+}
+
 void Sched::StdoutTracerMain(Pid pid)
 {
     TRACE_INFO_SCHEDULING("Created new StdoutTracer!");
@@ -57,21 +76,19 @@ void Sched::StdoutTracerMain(Pid pid)
     R_ASSERT_TRUE(static_cast<bool>(res), "Failed to find process for tracing...");
     auto *hello_process = res.value();
 
-    // Read from the stdout pipe and write to terminal
+    // Read from the stdout pipe and write to terminal, sleeping while it is empty
     byte buffer[256];
     while (true) {
-        auto result = hello_process->stdout_pipe.Read(std::span<byte>(buffer, sizeof(buffer)));
-
-        if (result.has_value()) {
-            size_t bytes_read = result.value();
-            if (bytes_read > 0) {
-                size_t safe_size =
-                    bytes_read < sizeof(buffer) - 1 ? bytes_read : sizeof(buffer) - 1;
-                buffer[safe_size] = '\0';
-                hal::TerminalWriteString(reinterpret_cast<const char *>(buffer));
-            }
+        auto result =
+            hello_process->stdout_pipe.ReadBlocking(std::span<byte>(buffer, sizeof(buffer) - 1));
+
+        if (!result) {
+            // The process closed its stdout, nothing more will arrive
+            SchedulingModule::Get().GetScheduler().Yield();
+            continue;
         }
 
-        SchedulingModule::Get().GetScheduler().Yield();
+        buffer[result.value()] = '\0';
+        hal::TerminalWriteString(reinterpret_cast<const char *>(buffer));
     }
 }
@@ -13,6 +13,8 @@ void TraceDumperMain();
 void ThreadRipperMain();
 void ProcessRipperMain();
 void FdHierarchyDumperMain();
+void PageCacheFlusherMain();
+void CompositorMain();
 void StdoutTracerMain(Pid pid);
 }  // namespace Sched
 
@@ -8,6 +8,7 @@
 #include <types.h>
 #include <defines.hpp>
 
+#include "drivers/input/event_queue.hpp"
 #include "fs/costants.hpp"
 #include "fs/vfs/path.hpp"
 #include "hal/tasks.hpp"
@@ -18,6 +19,7 @@
 namespace Mem
 {
 class AddressSpace;
+struct Page;
 }
 
 // Forward declarations
@@ -26,6 +28,11 @@ namespace Fs
 class FdTable;
 }
 
+namespace Syscall
+{
+class SyscallTraceRing;
+}
+
 namespace Sched
 {
 struct Thread;
@@ -73,10 +80,19 @@ struct Process : hal::Process {
     /* File descriptor table */
     Mem::VPtr<Fs::FdTable> fd_table;
 
+    /* Io ring shared with the process, created on demand */
+    Mem::PPtr<Mem::Page> io_ring{nullptr};
+
+    /* Syscall trace read by a tracer, created on demand */
+    Syscall::SyscallTraceRing *syscall_trace{nullptr};
+
     /* Standard I/O pipes */
     IO::Pipe<Fs::kStdioBufferSize> stdin_pipe;
     IO::Pipe<Fs::kStdioBufferSize> stdout_pipe;
     IO::Pipe<Fs::kStdioBufferSize> stderr_pipe;
+
+    /* Key events routed to the process while it has the input focus */
+    Drivers::Input::EventQueue input_events;
 };
 }  // namespace Sched
 
@@ -11,6 +11,7 @@
 #include "fs/file_descriptor.hpp"
 #include "modules/vfs.hpp"
 #include "modules/video.hpp"
+#include "syscalls/stats.hpp"
 
 // ------------------------------
 // statics
@@ -72,15 +73,19 @@ std::expected<Sched::Process *, Sched::Error> Sched::Processes::PrepareProcess()
     auto stdin_fd_result = fd_table->AllocateAt(std::move(*stdin_entry_result), Fs::kStdinFd);
     RET_UNEXPECTED_IF(!stdin_fd_result, Error::OutOfMemory);
 
+    // Nothing is guaranteed to drain stdout and stderr, writing to a full one fails instead of
+    // stalling the process
+    constexpr auto kOutputPipeMode = Fs::OpenMode::kReadWrite | Fs::OpenMode::kNonBlock;
+
     // Open stdout pipe in the global open file table
-    auto stdout_entry_result = open_file_table.OpenPipe(process->stdout_pipe);
+    auto stdout_entry_result = open_file_table.OpenPipe(process->stdout_pipe, kOutputPipeMode);
     RET_UNEXPECTED_IF(!stdout_entry_result, Error::OutOfMemory);
 
     auto stdout_fd_result = fd_table->AllocateAt(std::move(*stdout_entry_result), Fs::kStdoutFd);
     RET_UNEXPECTED_IF(!stdout_fd_result, Error::OutOfMemory);
 
     // Open stderr pipe in the global open file table
-    auto stderr_entry_result = open_file_table.OpenPipe(process->stderr_pipe);
+    auto stderr_entry_result = open_file_table.OpenPipe(process->stderr_pipe, kOutputPipeMode);
     RET_UNEXPECTED_IF(!stderr_entry_result, Error::OutOfMemory);
 
     auto stderr_fd_result = fd_table->AllocateAt(std::move(*stderr_entry_result), Fs::kStderrFd);
@@ -103,8 +108,16 @@ void Sched::Processes::CleanupProcess(Process *process)
     ASSERT_TRUE(process->wait_queue->IsEmpty());
     Mem::KDelete(process->wait_queue);
 
+    // Before the address space goes away, the compositor may still move the session's mapping
+    ::VideoModule::Get().GetWindowManager().ReleaseSession(process->pid);
+
     const auto result = MemoryModule::Get().GetVmm().DestroyUserAddrSpace(process->address_space);
     ASSERT_TRUE(static_cast<bool>(result));
 
-    ::VideoModule::Get().GetWindowManager().ReleaseSession(process->pid);
+    // The mapping went away with the address space, the frames are owned by the process
+    if (process->io_ring != nullptr) {
+        MemoryModule::Get().GetBuddyPmm().Free(process->io_ring);
+    }
+
+    Syscall::StopSyscallTrace(*process);
 }
@@ -55,6 +55,35 @@ void Scheduler::BlockOnWaitQueue(WaitQueue<Thread, kWaitQueueIntrusiveLevel> *wq
     hal::ContextSwitch(ScheduleAndUpdateThreads(true, ThreadState::kBlockedOnWaitQueue));
 }
 
+void Scheduler::BlockOnWaitQueueUntil(
+    WaitQueue<Thread, kWaitQueueIntrusiveLevel> *wq, const u64 systime_ns
+)
+{
+    ASSERT_EQ(hardware::GetCoreLocalTcb()->state, ThreadState::kRunning);
+    ASSERT_NOT_NULL(wq);
+
+    LocalCoreLock core_lock{};
+
+    // Deadlines inside the wake up window would be woken before we even switch away
+    const u64 time = TimingModule::Get().GetSystemTime().ReadLifeTimeNs();
+    if (systime_ns < time || systime_ns - time <= 4 * kMinDelta) {
+        return;
+    }
+
+    if constexpr (FeatureEnabled<FeatureFlag::kDebugTraces>) {
+        DebugTraceWaitQueue_(nullptr);
+    }
+
+    auto *thread = hardware::GetCoreLocalTcb();
+
+    thread->HookT::key = systime_ns;
+    sleep_queue_.Insert(thread);
+    wq->EnqueueLast(thread);
+
+    OnThreadYield_(thread);
+    hal::ContextSwitch(ScheduleAndUpdateThreads(true, ThreadState::kBlockedOnWaitQueue));
+}
+
 void Scheduler::ReleaseAndProcessAllBeforeProceeding(
     WaitQueue<Thread, kWaitQueueIntrusiveLevel> *wq
 )
@@ -68,6 +97,7 @@ void Scheduler::ReleaseAndProcessAllBeforeProceeding(
         /* Wake up all waiting processes before proceeding */
 
         auto thread = wq->Dequeue();
+        CancelWaitTimeout_(thread);
 
         if constexpr (FeatureEnabled<FeatureFlag::kDebugTraces>) {
             DebugTraceWaitQueue_(thread);
@@ -85,7 +115,9 @@ void Scheduler::ReleaseAll(WaitQueue<Thread, kWaitQueueIntrusiveLevel> *wq)
     LocalCoreLock core_lock{};
 
     while (!wq->IsEmpty()) {
-        auto thread   = wq->Dequeue();
+        auto thread = wq->Dequeue();
+        CancelWaitTimeout_(thread);
+
         thread->state = ThreadState::kReady;
         AddReadyThread(thread);
     }
@@ -107,6 +139,7 @@ void Scheduler::RemoveThread(Thread *thread)
     } else if (thread->state == ThreadState::kBlockedOnWaitQueue) {
         using wq = WaitQueue<Thread, kWaitQueueIntrusiveLevel>;
         wq::Remove(thread);
+        CancelWaitTimeout_(thread);
     }
 }
 
@@ -394,7 +427,13 @@ bool Scheduler::WakeUpTasks()
         should_preempt |= IsFirstHigherPriority_(thread, hardware::GetCoreLocalTcb());
 
         sleep_queue_.Delete(thread);
-        ASSERT_EQ(thread->state, ThreadState::kSleeping);
+        if (thread->state == ThreadState::kBlockedOnWaitQueue) {
+            // Timed wait expired before its queue was released
+            using wq = WaitQueue<Thread, kWaitQueueIntrusiveLevel>;
+            wq::Remove(thread);
+        } else {
+            ASSERT_EQ(thread->state, ThreadState::kSleeping);
+        }
 
         thread->state = ThreadState::kReady;
         AddReadyThread(thread);
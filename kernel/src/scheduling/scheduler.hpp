@@ -44,6 +44,10 @@ class Scheduler
 
     void BlockOnWaitQueue(WaitQueue<Thread, kWaitQueueIntrusiveLevel> *wq);
 
+    /// Block on the queue until it is released or the system time reaches systime_ns,
+    /// whichever comes first. The caller tells the two apart by re-checking its condition.
+    void BlockOnWaitQueueUntil(WaitQueue<Thread, kWaitQueueIntrusiveLevel> *wq, u64 systime_ns);
+
     void ReleaseAndProcessAllBeforeProceeding(WaitQueue<Thread, kWaitQueueIntrusiveLevel> *wq);
 
     void ReleaseAll(WaitQueue<Thread, kWaitQueueIntrusiveLevel> *wq);
@@ -99,6 +103,14 @@ class Scheduler
 
     void PrepareNextTimerInterruptBeforeSwitchUnguarded_(Thread *next_thread);
 
+    /// Drop the deadline of a thread leaving its wait queue, if it blocked with one
+    FORCE_INLINE_F void CancelWaitTimeout_(Thread *thread)
+    {
+        if (sleep_queue_.Contains(thread)) {
+            sleep_queue_.Delete(thread);
+        }
+    }
+
     NODISCARD FORCE_INLINE_F const Policy &GetPolicy_(const ThreadFlags flags) const
     {
         ASSERT_LT(static_cast<size_t>(flags.policy), static_cast<size_t>(SchedulingPolicy::kLast));
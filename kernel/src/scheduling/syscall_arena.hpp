@@ -0,0 +1,60 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025-2026 The AlkOS Authors
+// See the AUTHORS file for the full list of contributors.
+
+#ifndef KERNEL_SRC_SCHEDULING_SYSCALL_ARENA_HPP_
+#define KERNEL_SRC_SCHEDULING_SYSCALL_ARENA_HPP_
+
+#include <types.h>
+#include <bits_ext.hpp>
+#include <defines.hpp>
+
+namespace Sched
+{
+
+/**
+ * @brief Per-thread bump allocator holding syscall arguments copied in from user space.
+ *
+ * Allocations live until the thread leaves the kernel, the syscall exit path then releases
+ * everything at once. Nothing is freed individually, so there is no locking and no fragmentation.
+ */
+class SyscallArena
+{
+    public:
+    // Fits both paths of a two path syscall (e.g. move)
+    static constexpr size_t kSize = 2 * 1024;
+
+    SyscallArena() = default;
+    SyscallArena(byte *base, const size_t size) : base_(base), size_(size) {}
+
+    /**
+     * @return Pointer to size bytes, nullptr if the arena is exhausted
+     */
+    NODISCARD void *Allocate(const size_t size, const size_t alignment = alignof(u64))
+    {
+        const size_t offset = AlignUp(used_, alignment);
+        if (offset > size_ || size > size_ - offset) {
+            return nullptr;
+        }
+
+        used_ = offset + size;
+        return base_ + offset;
+    }
+
+    /// Everything allocated after the mark is released by Rewind(mark)
+    NODISCARD size_t Mark() const { return used_; }
+    void Rewind(const size_t mark) { used_ = mark; }
+
+    void Reset() { used_ = 0; }
+
+    NODISCARD byte *Base() const { return base_; }
+
+    private:
+    byte *base_{nullptr};
+    size_t size_{0};
+    size_t used_{0};
+};
+
+}  // namespace Sched
+
+#endif  // KERNEL_SRC_SCHEDULING_SYSCALL_ARENA_HPP_
@@ -44,6 +44,11 @@ void TaskMgr::InitializeMultitasking()
     const auto result2 =
         SpawnKernelProcess("kworker-process-ripper", {}, PrepareKThreadTask(ProcessRipperMain));
     R_ASSERT_TRUE(static_cast<bool>(result2), "Failed to spawn process ripper...");
+
+    const auto result3 = SpawnKernelProcess(
+        "kworker-page-cache-flusher", {}, PrepareKThreadTask(PageCacheFlusherMain)
+    );
+    R_ASSERT_TRUE(static_cast<bool>(result3), "Failed to spawn page cache flusher...");
 }
 
 std::expected<Pid, Error> TaskMgr::SpawnEmptyProcess(const char *name, const ProcessFlags flags)
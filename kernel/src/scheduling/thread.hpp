@@ -5,6 +5,7 @@
 #ifndef KERNEL_SRC_SCHEDULING_THREAD_HPP_
 #define KERNEL_SRC_SCHEDULING_THREAD_HPP_
 
+#include <alkos/syscall_stats.h>
 #include <types.h>
 #include <array.hpp>
 #include <data_structures/intrusive_linked_list.hpp>
@@ -14,6 +15,7 @@
 #include "hal/tasks.hpp"
 #include "policy.hpp"
 #include "process.hpp"
+#include "syscall_arena.hpp"
 #include "wait_queue.hpp"
 
 namespace Sched
@@ -106,6 +108,12 @@ struct Thread : data_structures::IntrusiveRbNode<Thread, u64, kSchedulingIntrusi
     /* Arch */
     hal::Thread arch_data;
 
+    /* Syscall arguments, kept after the fields mirrored by thread.nasm */
+    SyscallArena syscall_arena;
+
+    /* Syscall in progress, only maintained with the syscall_stats feature */
+    SyscallTraceRecord syscall_record;
+
     NODISCARD u64 CalculateCpuTime();
 };
 }  // namespace Sched
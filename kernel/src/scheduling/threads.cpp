@@ -4,6 +4,7 @@
 
 #include "threads.hpp"
 
+#include <autogen/feature_flags.h>
 #include <hal/debug_terminal.hpp>
 #include <hal/scheduling.hpp>
 #include <mem/virt/vmm.hpp>
@@ -16,6 +17,7 @@
 #include "modules/timing.hpp"
 #include "scheduling/local_lock.hpp"
 #include "sys/loader.hpp"
+#include "syscalls/stats.hpp"
 #include "template/scope_guard.hpp"
 
 namespace Sched
@@ -41,7 +43,21 @@ std::expected<Thread *, Error> Threads::PrepareThread()
         return std::unexpected(Error::OutOfMemory);
     }
     thread->wait_queue = wait_queue.value();
+    template_lib::ScopeGuard wait_queue_guard([&]() {
+        Mem::KDelete(thread->wait_queue);
+    });
+
+    // Allocate syscall argument arena
+    const auto arena = Mem::KMalloc(SyscallArena::kSize);
+    if (!arena) {
+        return std::unexpected(Error::OutOfMemory);
+    }
+    thread->syscall_arena = SyscallArena(static_cast<byte *>(arena.value()), SyscallArena::kSize);
+
+    // Stale in a reused slot, an exit without a recorded entry must be recognisable
+    thread->syscall_record = {};
 
+    wait_queue_guard.Dismiss();
     thread_guard.Dismiss();
     return thread;
 }
@@ -58,6 +74,10 @@ std::expected<void, Error> Threads::Free(const Tid tid)
     ASSERT_NOT_NULL(thread->wait_queue);
     ASSERT_TRUE(thread->wait_queue->IsEmpty());
     Mem::KDelete(thread->wait_queue);
+    if (thread->syscall_arena.Base() != nullptr) {
+        Mem::KFree(thread->syscall_arena.Base());
+        thread->syscall_arena = {};
+    }
     threads_.Free(id);
 
     TRACE_INFO_SCHEDULING("Fully freed thread with TID: %llu", tid);
@@ -165,19 +185,30 @@ void UpdateTcbOnInterruptExit(Thread *thread)
 
 }  // namespace Sched
 
-void cdecl_UpdateTcbOnSyscallEntry()
+void cdecl_UpdateTcbOnSyscallEntry(const u64 number, const u64 arg0, const u64 arg1, const u64 arg2)
 {
     const auto thread = hardware::GetCoreLocalTcb();
     const u64 t       = TimingModule::Get().GetSystemTime().ReadLifeTimeNs();
     thread->user_time_ns += t - thread->timestamp;
     thread->timestamp = t;
     thread->num_syscalls++;
+
+    if constexpr (FeatureEnabled<FeatureFlag::kSyscallStats>) {
+        Syscall::RecordSyscallEntry(*thread, number, arg0, arg1, arg2);
+    }
 }
 
-void cdecl_UpdateTcbOnSyscallExit()
+void cdecl_UpdateTcbOnSyscallExit(const i64 result)
 {
     const auto thread = hardware::GetCoreLocalTcb();
     const u64 t       = TimingModule::Get().GetSystemTime().ReadLifeTimeNs();
     thread->kernel_time_ns += t - thread->timestamp;
     thread->timestamp = t;
+
+    // Arguments copied in for this syscall are dead now
+    thread->syscall_arena.Reset();
+
+    if constexpr (FeatureEnabled<FeatureFlag::kSyscallStats>) {
+        Syscall::RecordSyscallExit(*thread, result);
+    }
 }
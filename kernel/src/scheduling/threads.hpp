@@ -114,7 +114,7 @@ NODISCARD FAST_CALL Task PrepareUserThreadTask(thread_func_t func, void *arg)
 
 }  // namespace Sched
 
-extern "C" void cdecl_UpdateTcbOnSyscallEntry();
-extern "C" void cdecl_UpdateTcbOnSyscallExit();
+extern "C" void cdecl_UpdateTcbOnSyscallEntry(u64 number, u64 arg0, u64 arg1, u64 arg2);
+extern "C" void cdecl_UpdateTcbOnSyscallExit(i64 result);
 
 #endif  // KERNEL_SRC_SCHEDULING_THREADS_HPP_
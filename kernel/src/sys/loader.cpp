@@ -5,6 +5,7 @@
 #include "sys/loader.hpp"
 
 #include <string.h>
+#include <algorithm.hpp>
 #include <bits_ext.hpp>
 #include <template/scope_guard.hpp>
 
@@ -25,6 +26,11 @@ using std::unexpected;
 
 namespace
 {
+// A loadable segment maps to at most a file-backed area, the eagerly filled data/bss boundary
+// page and a zero-filled .bss area
+constexpr size_t kAreasPerSegment = 3;
+constexpr size_t kMaxLoadAreas    = 16 * kAreasPerSegment;
+
 bool ValidateElfHeader(const Elf::Header &header)
 {
     if (memcmp(header.identifier, Elf::Header::kMagic, 4) != 0) {
@@ -47,7 +53,9 @@ bool ValidateElfHeader(const Elf::Header &header)
 expected<Mem::VPtr<void>, LoadError> ElfLoader::Load(const vfs::Path &path, AddressSpace &as)
 {
     TRACE_INFO_GENERAL("ElfLoader::Load()");
-    auto &vfs = VfsModule::Get();
+    auto &vfs        = VfsModule::Get();
+    auto &page_cache = vfs.GetPageCache();
+    auto &vmm        = MemoryModule::Get().GetVmm();
 
     // 1. Check if file exists
     TRACE_FREQ_INFO_GENERAL("Validating the file exists");
@@ -56,10 +64,23 @@ expected<Mem::VPtr<void>, LoadError> ElfLoader::Load(const vfs::Path &path, Addr
         return unexpected(LoadError::FileNotFound);
     }
 
+    // The path is resolved once here. All further reads, as well as the page faults of the
+    // mapped segments, go through the page cache. Processes running the same binary share the
+    // same File and so the same cached pages.
+    auto file_res = vfs.GetFdManager().GetFileTable().GetOrCreate(path);
+    if (!file_res) {
+        return unexpected(LoadError::IoError);
+    }
+    Fs::File &file = *file_res->Get();
+
+    const auto read_exact = [&](void *dest, const size_t size, const u64 offset) {
+        auto res = page_cache.Read(file, std::span(static_cast<byte *>(dest), size), offset);
+        return res.has_value() && res.value() == size;
+    };
+
     // 2. Read ELF Header
     Elf::Header header;
-    auto read_res = vfs.ReadFile(path, &header, sizeof(header), 0);
-    if (!read_res.has_value() || read_res.value() != sizeof(header)) {
+    if (!read_exact(&header, sizeof(header), 0)) {
         return unexpected(LoadError::IoError);
     }
 
@@ -82,39 +103,45 @@ expected<Mem::VPtr<void>, LoadError> ElfLoader::Load(const vfs::Path &path, Addr
         Mem::KFree(ph_raw);
     });
 
-    TRACE_FREQ_INFO_GENERAL("Validating the ELF header");
-    read_res = vfs.ReadFile(path, ph_raw, ph_size, header.phoff);
-    if (!read_res.has_value() || read_res.value() != ph_size) {
+    TRACE_FREQ_INFO_GENERAL("Reading the program headers");
+    if (!read_exact(ph_raw, ph_size, header.phoff)) {
         return unexpected(LoadError::IoError);
     }
 
     auto *ph_table = reinterpret_cast<Elf::ProgramHeader *>(ph_raw);
 
-    // Track loaded segments so we can roll back changes to the address space
+    // Track added areas so we can roll back changes to the address space
     // if loading fails halfway through.
-    u16 loaded_segments_count = 0;
+    VPtr<void> added_areas[kMaxLoadAreas];
+    size_t added_areas_count = 0;
     template_lib::ScopeGuard vma_cleanup_guard([&]() {
-        u16 segments_cleaned = 0;
-        for (u16 i = 0; i < header.phnum && segments_cleaned < loaded_segments_count; ++i) {
-            auto &ph = ph_table[i];
-            if (ph.type != Elf::ProgramHeader::kTypeLoad || ph.memsz == 0) {
-                continue;
-            }
-
-            u64 virt_start = AlignDown(ph.vaddr, hal::kPageSizeBytes);
-            if (auto res =
-                    MemoryModule::Get().GetVmm().RmArea(&as, Mem::UptrToPtr<void>(virt_start));
-                !res) {
+        for (size_t i = 0; i < added_areas_count; ++i) {
+            if (auto res = vmm.RmArea(&as, added_areas[i]); !res) {
                 TRACE_WARN_GENERAL(
-                    "Failed to clean up VMA for segment %d during error recovery", i
+                    "Failed to clean up VMA at 0x%p during error recovery", added_areas[i]
                 );
             }
-            segments_cleaned++;
         }
     });
 
+    const auto add_area = [&](VMemArea *vma) {
+        // AddArea takes ownership of the pointer
+        if (auto res = vmm.AddArea(&as, vma); !res) {
+            return false;
+        }
+        added_areas[added_areas_count++] = vma->GetStart();
+        return true;
+    };
+
+    const auto add_anonymous_area = [&](const u64 start, const u64 end,
+                                        const VirtualMemAreaFlags flags) {
+        auto vma_res =
+            Mem::KNew<Mem::AnonymousVMemArea>(Mem::UptrToPtr<void>(start), end - start, flags);
+        return vma_res && add_area(*vma_res);
+    };
+
     // 5. Load Segments
-    TRACE_FREQ_INFO_GENERAL("Validating the ELF header");
+    TRACE_FREQ_INFO_GENERAL("Mapping the segments");
     for (u16 i = 0; i < header.phnum; ++i) {
         auto &ph = ph_table[i];
         if (ph.type != Elf::ProgramHeader::kTypeLoad) {
@@ -123,10 +150,12 @@ expected<Mem::VPtr<void>, LoadError> ElfLoader::Load(const vfs::Path &path, Addr
         if (ph.memsz == 0) {
             continue;
         }
+        if (ph.filesz > ph.memsz || added_areas_count + kAreasPerSegment > kMaxLoadAreas) {
+            return unexpected(LoadError::InvalidElf);
+        }
 
         u64 virt_start = AlignDown(ph.vaddr, hal::kPageSizeBytes);
         u64 virt_end   = AlignUp(ph.vaddr + ph.memsz, hal::kPageSizeBytes);
-        u64 size       = virt_end - virt_start;
 
         TRACE_INFO_GENERAL("Loading segment %d: [0x%llX - 0x%llX]", i, virt_start, virt_end);
 
@@ -139,50 +168,81 @@ expected<Mem::VPtr<void>, LoadError> ElfLoader::Load(const vfs::Path &path, Addr
         VirtualMemAreaFlags loading_flags = original_flags;
         loading_flags.writable            = true;
 
-        // Add VMA to Address Space
-        auto vma_res = Mem::KNew<Mem::AnonymousVMemArea>(
-            Mem::UptrToPtr<void>(virt_start), size, loading_flags
-        );
+        // Pages eagerly filled by the loader are mapped writable for the copy and get their
+        // original permissions back afterwards
+        const auto load_eager = [&](const u64 start, const u64 end, const u64 copy_start,
+                                    const u64 copy_end) {
+            if (!add_anonymous_area(start, end, loading_flags)) {
+                return false;
+            }
 
-        if (!vma_res) {
-            TRACE_WARN_GENERAL("Failed to allocate VMA for segment %d", i);
-            return unexpected(LoadError::MemoryError);
-        }
+            memset(Mem::UptrToPtr<void>(start), 0, end - start);
+            if (copy_end > copy_start &&
+                !read_exact(
+                    Mem::UptrToPtr<void>(copy_start), copy_end - copy_start,
+                    ph.offset + (copy_start - ph.vaddr)
+                )) {
+                return false;
+            }
 
-        // AddArea takes ownership of the pointer
-        if (auto res = MemoryModule::Get().GetVmm().AddArea(&as, *vma_res); !res) {
-            TRACE_WARN_GENERAL("Failed to add VMA for segment %d", i);
-            return unexpected(LoadError::MemoryError);
+            if (loading_flags.writable == original_flags.writable) {
+                return true;
+            }
+            return vmm.UpdateAreaFlags(&as, Mem::UptrToPtr<void>(start), original_flags)
+                .has_value();
+        };
+
+        // Segments without file data are plain .bss, zero-filled on demand
+        if (ph.filesz == 0) {
+            if (!add_anonymous_area(virt_start, virt_end, original_flags)) {
+                TRACE_WARN_GENERAL("Failed to add the .bss VMA for segment %d", i);
+                return unexpected(LoadError::MemoryError);
+            }
+            continue;
         }
-        loaded_segments_count++;
 
-        VMemArea *vma = *vma_res;
+        const u64 file_end = ph.vaddr + ph.filesz;
 
-        // Copy file data into the mapped region
-        if (ph.filesz > 0) {
-            void *dest = reinterpret_cast<void *>(ph.vaddr);
-            read_res   = vfs.ReadFile(path, dest, ph.filesz, ph.offset);
-            if (!read_res.has_value() || read_res.value() != ph.filesz) {
-                return unexpected(LoadError::IoError);
+        // Segments whose file offset is not congruent with their address cannot be mapped from
+        // the cache and are copied in
+        const bool mappable = (ph.vaddr % hal::kPageSizeBytes) == (ph.offset % hal::kPageSizeBytes);
+        if (!mappable) {
+            if (!load_eager(virt_start, virt_end, ph.vaddr, file_end)) {
+                TRACE_WARN_GENERAL("Failed to load segment %d", i);
+                return unexpected(LoadError::MemoryError);
             }
+            continue;
         }
 
-        // Zero out BSS
-        if (ph.memsz > ph.filesz) {
-            void *bss_dest = reinterpret_cast<void *>(ph.vaddr + ph.filesz);
-            memset(bss_dest, 0, ph.memsz - ph.filesz);
-        }
-
-        // Restore flags
-        if (loading_flags.writable != original_flags.writable) {
-            if (auto res = MemoryModule::Get().GetVmm().UpdateAreaFlags(
-                    &as, vma->GetStart(), original_flags
-                );
-                !res) {
-                TRACE_WARN_GENERAL("Failed to restore flags for segment %d", i);
+        // Pages holding only file data fault in from the page cache. Private mappings share the
+        // cached frames between processes and copy them on the first write. Without .bss the
+        // whole last page can come from the file as well.
+        const u64 mapped_end = ph.memsz == ph.filesz ? AlignUp(file_end, hal::kPageSizeBytes)
+                                                     : AlignDown(file_end, hal::kPageSizeBytes);
+        if (mapped_end > virt_start) {
+            auto vma_res = Mem::KNew<Mem::FileBackedVMemArea>(
+                Mem::UptrToPtr<void>(virt_start), mapped_end - virt_start, original_flags, file,
+                AlignDown(ph.offset, hal::kPageSizeBytes), false
+            );
+            if (!vma_res || !add_area(*vma_res)) {
+                TRACE_WARN_GENERAL("Failed to map segment %d", i);
                 return unexpected(LoadError::MemoryError);
             }
         }
+
+        // Only the page shared by the end of the file data and the start of .bss is filled
+        // eagerly, the rest of .bss is zero-filled on demand
+        const u64 bss_start = AlignUp(file_end, hal::kPageSizeBytes);
+        if (bss_start > mapped_end &&
+            !load_eager(mapped_end, bss_start, std::max(mapped_end, ph.vaddr), file_end)) {
+            TRACE_WARN_GENERAL("Failed to load the data/bss boundary of segment %d", i);
+            return unexpected(LoadError::MemoryError);
+        }
+
+        if (virt_end > bss_start && !add_anonymous_area(bss_start, virt_end, original_flags)) {
+            TRACE_WARN_GENERAL("Failed to add the .bss VMA for segment %d", i);
+            return unexpected(LoadError::MemoryError);
+        }
     }
 
     vma_cleanup_guard.Dismiss();
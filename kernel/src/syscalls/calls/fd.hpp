@@ -6,10 +6,46 @@
 #define KERNEL_SRC_SYSCALLS_CALLS_FD_HPP_
 
 #include <defines.h>
+#include "constants.hpp"
+#include "mem/virt/user_access.hpp"
 #include "modules/vfs.hpp"
 
 namespace Syscall
 {
+namespace internal
+{
+/**
+ * @brief Check that a user supplied buffer lies in user space
+ */
+FORCE_INLINE_F bool IsUserBuffer(const u64 start, const u64 length)
+{
+    return Mem::IsUserRange(start, length);
+}
+
+/**
+ * @brief Copy a user supplied vector array into the kernel and check that every buffer it
+ * describes lies in user space. Only the copy is used afterwards, so the process cannot swap
+ * the vectors while the transfer blocks.
+ */
+FORCE_INLINE_F Fs::FdResult<std::span<const IoVec>> CopyUserIoVec(
+    std::span<const IoVec> iov, IoVec (&copy)[Fs::kMaxIoVecs]
+)
+{
+    RET_UNEXPECTED_IF(iov.size() > Fs::kMaxIoVecs, Fs::FdError::kInvalidArgument);
+    RET_UNEXPECTED_IF(
+        !Mem::CopyFromUser(copy, iov.data(), iov.size_bytes()), Fs::FdError::kInvalidArgument
+    );
+
+    for (size_t i = 0; i < iov.size(); ++i) {
+        RET_UNEXPECTED_IF(
+            !IsUserBuffer(reinterpret_cast<u64>(copy[i].base), copy[i].length),
+            Fs::FdError::kInvalidArgument
+        );
+    }
+    return std::span<const IoVec>(copy, iov.size());
+}
+}  // namespace internal
+
 // ------------------------------
 // File Descriptor Syscalls
 // ------------------------------
@@ -69,6 +105,103 @@ FORCE_INLINE_F Fs::FdResult<i64> SysSeek(fd_t fd, const i64 offset, const Fs::Fd
     return ::VfsModule::Get().GetFdManager().Seek(fd, offset, whence);
 }
 
+/**
+ * @brief Read from a file descriptor into several buffers
+ * @param fd File descriptor to read from
+ * @param iov Buffers to fill, in order
+ * @return Total number of bytes read on success, or error
+ */
+FORCE_INLINE_F Fs::FdResult<size_t> SysReadV(fd_t fd, std::span<const IoVec> iov)
+{
+    IoVec copy[Fs::kMaxIoVecs];
+    const auto vectors = internal::CopyUserIoVec(iov, copy);
+    RET_UNEXPECTED_IF_ERR(vectors);
+
+    return ::VfsModule::Get().GetFdManager().ReadV(fd, *vectors);
+}
+
+/**
+ * @brief Write several buffers to a file descriptor
+ * @param fd File descriptor to write to
+ * @param iov Buffers to write, in order
+ * @return Total number of bytes written on success, or error
+ */
+FORCE_INLINE_F Fs::FdResult<size_t> SysWriteV(fd_t fd, std::span<const IoVec> iov)
+{
+    IoVec copy[Fs::kMaxIoVecs];
+    const auto vectors = internal::CopyUserIoVec(iov, copy);
+    RET_UNEXPECTED_IF_ERR(vectors);
+
+    return ::VfsModule::Get().GetFdManager().WriteV(fd, *vectors);
+}
+
+/**
+ * @brief Read from a file at the given offset without moving the descriptor offset
+ * @param fd File descriptor to read from
+ * @param buffer Buffer to store read data
+ * @param offset Offset in the file
+ * @return Number of bytes read on success, or error
+ */
+FORCE_INLINE_F Fs::FdResult<size_t> SysPRead(fd_t fd, std::span<byte> buffer, const u64 offset)
+{
+    return ::VfsModule::Get().GetFdManager().PRead(fd, buffer, offset);
+}
+
+/**
+ * @brief Write to a file at the given offset without moving the descriptor offset
+ * @param fd File descriptor to write to
+ * @param buffer Buffer containing data to write
+ * @param offset Offset in the file
+ * @return Number of bytes written on success, or error
+ */
+FORCE_INLINE_F Fs::FdResult<size_t> SysPWrite(
+    fd_t fd, std::span<const byte> buffer, const u64 offset
+)
+{
+    return ::VfsModule::Get().GetFdManager().PWrite(fd, buffer, offset);
+}
+
+/**
+ * @brief Move data from one file descriptor to another without copying it through user space
+ * @param in_fd File or pipe to read from, a file is read at its offset
+ * @param out_fd File descriptor to write to
+ * @param count Maximal number of bytes to move
+ * @return Number of bytes moved on success, or error
+ */
+FORCE_INLINE_F Fs::FdResult<size_t> SysSplice(fd_t in_fd, fd_t out_fd, const size_t count)
+{
+    return ::VfsModule::Get().GetFdManager().Splice(in_fd, out_fd, count);
+}
+
+/**
+ * @brief Move file data at the given offset to another file descriptor without copying it
+ * through user space
+ * @param out_fd File descriptor to write to
+ * @param in_fd File to read from, its offset is left untouched
+ * @param offset Offset in the file, advanced past the data moved
+ * @param count Maximal number of bytes to move
+ * @return Number of bytes moved on success, or error
+ */
+FORCE_INLINE_F Fs::FdResult<size_t> SysSendFile(
+    fd_t out_fd, fd_t in_fd, u64 *offset, const size_t count
+)
+{
+    RET_UNEXPECTED_IF(offset == nullptr, Fs::FdError::kInvalidArgument);
+
+    // The offset is only ever accessed through copies. Storing it back unchanged first makes a
+    // read-only location fail before any data is moved.
+    u64 file_offset;
+    RET_UNEXPECTED_IF(!Mem::CopyFromUser(file_offset, offset), Fs::FdError::kInvalidArgument);
+    RET_UNEXPECTED_IF(!Mem::CopyToUser(offset, file_offset), Fs::FdError::kInvalidArgument);
+
+    const auto result =
+        ::VfsModule::Get().GetFdManager().SendFile(out_fd, in_fd, file_offset, count);
+    RET_UNEXPECTED_IF_ERR(result);
+
+    RET_UNEXPECTED_IF(!Mem::CopyToUser(offset, file_offset), Fs::FdError::kInvalidArgument);
+    return result;
+}
+
 /**
  * @brief Duplicate a file descriptor
  * @param fd File descriptor to duplicate
@@ -90,6 +223,57 @@ FORCE_INLINE_F Fs::FdResult<fd_t> SysDupTo(fd_t old_fd, fd_t new_fd)
     return ::VfsModule::Get().GetFdManager().Duplicate(old_fd, new_fd);
 }
 
+/**
+ * @brief Create an anonymous pipe
+ * @param fds Receives the read end in fds[0] and the write end in fds[1]
+ * @param flags Fs::OpenMode::kNonBlock to make both ends non-blocking, otherwise empty
+ * @return Success or error
+ */
+FORCE_INLINE_F Fs::FdResult<> SysPipe(fd_t *fds, const Fs::OpenMode flags)
+{
+    RET_UNEXPECTED_IF(fds == nullptr || !Mem::IsUserArray(fds, 2), Fs::FdError::kInvalidArgument);
+
+    auto &fd_manager = ::VfsModule::Get().GetFdManager();
+
+    fd_t pipe_fds[2];
+    const auto result = fd_manager.CreatePipe(pipe_fds, flags);
+    RET_UNEXPECTED_IF_ERR(result);
+
+    if (!Mem::CopyToUser(fds, pipe_fds, sizeof(pipe_fds))) {
+        // Nobody can reach the descriptors, do not leak them
+        [[maybe_unused]] const auto read_closed  = fd_manager.Close(pipe_fds[0]);
+        [[maybe_unused]] const auto write_closed = fd_manager.Close(pipe_fds[1]);
+        return std::unexpected(Fs::FdError::kInvalidArgument);
+    }
+    return {};
+}
+
+/**
+ * @brief Wait until at least one of the descriptors is ready
+ * @param fds Descriptors with requested events, revents of every entry is filled
+ * @param timeout_ns Maximal wait in nanoseconds, negative waits without limit, zero only checks
+ * @return Number of entries with non-zero revents on success, or error
+ */
+FORCE_INLINE_F Fs::FdResult<size_t> SysPoll(std::span<PollFd> fds, const i64 timeout_ns)
+{
+    RET_UNEXPECTED_IF(fds.size() > Fs::kMaxFdsPerProcess, Fs::FdError::kInvalidArgument);
+
+    // Poll blocks, so it works on a kernel copy written back once it returns
+    PollFd copy[Fs::kMaxFdsPerProcess];
+    RET_UNEXPECTED_IF(
+        !Mem::CopyFromUser(copy, fds.data(), fds.size_bytes()), Fs::FdError::kInvalidArgument
+    );
+
+    const auto result =
+        ::VfsModule::Get().GetFdManager().Poll(std::span(copy, fds.size()), timeout_ns);
+    RET_UNEXPECTED_IF_ERR(result);
+
+    RET_UNEXPECTED_IF(
+        !Mem::CopyToUser(fds.data(), copy, fds.size_bytes()), Fs::FdError::kInvalidArgument
+    );
+    return result;
+}
+
 }  // namespace Syscall
 
 #endif  // KERNEL_SRC_SYSCALLS_CALLS_FD_HPP_
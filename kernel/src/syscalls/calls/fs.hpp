@@ -6,6 +6,7 @@
 #define KERNEL_SRC_SYSCALLS_CALLS_FS_HPP_
 
 #include <defines.h>
+#include "mem/virt/user_access.hpp"
 #include "modules/vfs.hpp"
 
 namespace Syscall
@@ -34,14 +35,15 @@ FORCE_INLINE_F Fs::FdResult<void> SysReadDirectory(
     }
 
     size_t count = 0;
+    bool faulted = false;
 
-    // List directory and populate entries
+    // List directory and populate entries, each one is built in the kernel and copied out
     vfs.ListDirectory(path, [&](const char *name, bool is_dir) {
-        if (count >= entries.size()) {
+        if (faulted || count >= entries.size()) {
             return;  // No more space
         }
 
-        auto &entry = entries[count];
+        DirEntry entry{};
 
         // Copy name
         strncpy(entry.name, name, sizeof(entry.name) - 1);
@@ -50,11 +52,13 @@ FORCE_INLINE_F Fs::FdResult<void> SysReadDirectory(
         // Set type
         entry.type = is_dir ? kFileTypeDirectory : kFileTypeRegular;
 
+        faulted = !Mem::CopyToUser(&entries[count], entry);
         count++;
     });
 
+    RET_UNEXPECTED_IF(faulted, Fs::FdError::kInvalidArgument);
     if (num_entries != nullptr) {
-        *num_entries = count;
+        RET_UNEXPECTED_IF(!Mem::CopyToUser(num_entries, count), Fs::FdError::kInvalidArgument);
     }
 
     return {};
@@ -81,22 +85,24 @@ FORCE_INLINE_F Fs::FdResult<void> SysFileInfo(const vfs::Path &path, FileInfo *i
     }
 
     // Determine if it's a file or directory
+    FileInfo result{};
     auto is_dir_result = vfs.DirectoryExists(path);
     if (is_dir_result.has_value() && is_dir_result.value()) {
-        info->type = kFileTypeDirectory;
-        info->size = 0;
+        result.type = kFileTypeDirectory;
+        result.size = 0;
     } else {
-        info->type = kFileTypeRegular;
+        result.type = kFileTypeRegular;
 
         // Get file size
         auto size_result = vfs.GetFileSize(path);
         if (size_result.has_value()) {
-            info->size = size_result.value();
+            result.size = size_result.value();
         } else {
-            info->size = 0;
+            result.size = 0;
         }
     }
 
+    RET_UNEXPECTED_IF(!Mem::CopyToUser(info, result), Fs::FdError::kInvalidArgument);
     return {};
 }
 
@@ -6,8 +6,11 @@
 #define KERNEL_SRC_SYSCALLS_CALLS_INPUT_HPP_
 
 #include "alkos/sys/input.h"
+#include "mem/error.hpp"
+#include "mem/virt/user_access.hpp"
 #include "modules/hardware.hpp"
 
+#include <algorithm.hpp>
 #include <modules/scheduling.hpp>
 #include <modules/video.hpp>
 
@@ -30,6 +33,45 @@ FORCE_INLINE_F bool SysGetKeyState(VirtualKey vk)
     return ::HardwareModule::Get().GetPs2Keyboard().GetKeyState(vk);
 }
 
+/**
+ * @brief Syscall Handler: Read Input Events
+ *
+ * @param events Receives the oldest key events of the caller
+ * @param timeout_ns Maximal wait for the first event, negative waits without limit, 0 only checks
+ * @return Number of events written, 0 on timeout
+ */
+FORCE_INLINE_F std::expected<size_t, Mem::MemError> SysReadInputEvents(
+    std::span<InputEvent> events, const i64 timeout_ns
+)
+{
+    auto res = ::SchedulingModule::Get().GetProcesses().GetCurrentProcess();
+    R_ASSERT_TRUE(static_cast<bool>(res), "SysReadInputEvents: No current process found");
+    auto &queue = (*res)->input_events;
+
+    // Events pass through a kernel buffer, user memory may fault and is never touched with
+    // interrupts disabled
+    static constexpr size_t kChunk = 32;
+    InputEvent chunk[kChunk];
+
+    size_t done = 0;
+    while (done < events.size()) {
+        // Only the first chunk waits
+        const size_t count = queue.Read(
+            std::span(chunk, std::min(kChunk, events.size() - done)), done == 0 ? timeout_ns : 0
+        );
+        if (count == 0) {
+            break;
+        }
+
+        const auto copied =
+            Mem::CopyToUser(events.data() + done, chunk, count * sizeof(InputEvent));
+        RET_UNEXPECTED_IF_ERR(copied);
+        done += count;
+    }
+
+    return done;
+}
+
 }  // namespace Syscall
 
 #endif  // KERNEL_SRC_SYSCALLS_CALLS_INPUT_HPP_
@@ -0,0 +1,162 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025-2026 The AlkOS Authors
+// See the AUTHORS file for the full list of contributors.
+
+#ifndef KERNEL_SRC_SYSCALLS_CALLS_MEM_HPP_
+#define KERNEL_SRC_SYSCALLS_CALLS_MEM_HPP_
+
+#include <defines.h>
+#include "alkos/mem.h"
+#include "constants.hpp"
+#include "mem/error.hpp"
+#include "modules/memory.hpp"
+#include "modules/scheduling.hpp"
+#include "modules/vfs.hpp"
+
+namespace Syscall
+{
+// ------------------------------
+// Memory Syscalls
+// ------------------------------
+
+/**
+ * @brief Map a file into the address space of the calling process
+ * @param fd File descriptor of the file to map
+ * @param offset Page aligned offset in the file
+ * @param length Length of the mapping in bytes, rounded up to whole pages
+ * @param prot Access permissions of the mapping
+ * @param flags Shared or private mapping
+ * @return Address of the mapping on success, or error
+ */
+FORCE_INLINE_F std::expected<u64, Mem::MemError> SysMmap(
+    fd_t fd, const u64 offset, const size_t length, const MemProtFlags prot,
+    const MemMapFlags flags
+)
+{
+    RET_UNEXPECTED_IF(
+        length == 0 || length > kUserSpaceEndExclusive, Mem::MemError::InvalidArgument
+    );
+
+    auto *fd_table = ::VfsModule::Get().GetFdManager().GetCurrentProcessFdTable();
+    RET_UNEXPECTED_IF(fd_table == nullptr, Mem::MemError::NotFound);
+
+    auto *entry = fd_table->Get(fd);
+    RET_UNEXPECTED_IF(entry == nullptr || !entry->IsFile(), Mem::MemError::InvalidArgument);
+
+    const bool shared   = (flags & kMemMapShared) != 0;
+    const bool writable = (prot & kMemProtWrite) != 0;
+
+    // Shared writable mappings write back into the file, so they need write access to it
+    const auto mode = static_cast<Fs::OpenMode>(entry->flags);
+    RET_UNEXPECTED_IF(!Fs::HasMode(mode, Fs::OpenMode::kRead), Mem::MemError::InvalidArgument);
+    RET_UNEXPECTED_IF(
+        shared && writable && !Fs::HasMode(mode, Fs::OpenMode::kWrite),
+        Mem::MemError::InvalidArgument
+    );
+
+    const auto process = SchedulingModule::Get().GetProcesses().GetCurrentProcess();
+    RET_UNEXPECTED_IF(!process, Mem::MemError::NotFound);
+
+    const Mem::VirtualMemAreaFlags vma_flags{
+        .readable   = (prot & kMemProtRead) != 0,
+        .writable   = writable,
+        .executable = (prot & kMemProtExec) != 0,
+    };
+
+    auto res = ::MemoryModule::Get().GetVmm().MapFile(
+        process.value()->address_space, *entry->GetFile(), offset, length, vma_flags, shared,
+        Mem::VMemAreaOrigin::kMmap
+    );
+    RET_UNEXPECTED_IF_ERR(res);
+
+    return Mem::PtrToUptr(*res);
+}
+
+/**
+ * @brief Map zero-filled anonymous memory into the address space of the calling process.
+ * Pages are backed on first access and their frames are freed when the mapping is removed.
+ * @param length Length of the mapping in bytes, rounded up to whole pages
+ * @param prot Access permissions of the mapping, kMemProtNone maps inaccessible guard pages
+ * @return Address of the mapping on success, or error
+ */
+FORCE_INLINE_F std::expected<u64, Mem::MemError> SysMmapAnon(
+    const size_t length, const MemProtFlags prot
+)
+{
+    RET_UNEXPECTED_IF(
+        length == 0 || length > kUserSpaceEndExclusive, Mem::MemError::InvalidArgument
+    );
+
+    const auto process = SchedulingModule::Get().GetProcesses().GetCurrentProcess();
+    RET_UNEXPECTED_IF(!process, Mem::MemError::NotFound);
+
+    const Mem::VirtualMemAreaFlags vma_flags{
+        .readable   = (prot & kMemProtRead) != 0,
+        .writable   = (prot & kMemProtWrite) != 0,
+        .executable = (prot & kMemProtExec) != 0,
+    };
+
+    auto res = ::MemoryModule::Get().GetVmm().AllocAnonymous(
+        process.value()->address_space, AlignUp(length, hal::kPageSizeBytes), vma_flags,
+        Mem::UptrToPtr<void>(kUserSpaceStart), Mem::UptrToPtr<void>(kUserSpaceEndExclusive),
+        Mem::VMemAreaOrigin::kMmap
+    );
+    RET_UNEXPECTED_IF_ERR(res);
+
+    return Mem::PtrToUptr(*res);
+}
+
+/**
+ * @brief Remove the mapping starting at the given address, frames of anonymous mappings are
+ * returned to the system. Only mappings created by mmap can be removed.
+ * @param addr Start of the mapping
+ * @return Success or error
+ */
+FORCE_INLINE_F std::expected<void, Mem::MemError> SysMunmap(void *addr)
+{
+    RET_UNEXPECTED_IF(IsKernelSpace(addr), Mem::MemError::InvalidArgument);
+
+    const auto process = SchedulingModule::Get().GetProcesses().GetCurrentProcess();
+    RET_UNEXPECTED_IF(!process, Mem::MemError::NotFound);
+
+    return ::MemoryModule::Get().GetVmm().UnmapUserArea(process.value()->address_space, addr);
+}
+
+/**
+ * @brief Change the access permissions of the mapping starting at the given address. Only
+ * mappings created by mmap can be changed.
+ * @param addr Start of the mapping
+ * @param prot New access permissions. Shared file mappings created read-only stay read-only
+ * @return Success or error
+ */
+FORCE_INLINE_F std::expected<void, Mem::MemError> SysMprotect(void *addr, const MemProtFlags prot)
+{
+    RET_UNEXPECTED_IF(IsKernelSpace(addr), Mem::MemError::InvalidArgument);
+
+    const auto process = SchedulingModule::Get().GetProcesses().GetCurrentProcess();
+    RET_UNEXPECTED_IF(!process, Mem::MemError::NotFound);
+
+    return ::MemoryModule::Get().GetVmm().ProtectArea(
+        process.value()->address_space, addr, (prot & kMemProtRead) != 0,
+        (prot & kMemProtWrite) != 0, (prot & kMemProtExec) != 0
+    );
+}
+
+/**
+ * @brief Write modified pages of a shared file mapping back to the file
+ * @param addr Address inside the mapping
+ * @return Success or error
+ */
+FORCE_INLINE_F std::expected<void, Mem::MemError> SysMsync(void *addr)
+{
+    RET_UNEXPECTED_IF(IsKernelSpace(addr), Mem::MemError::InvalidArgument);
+
+    const auto process = SchedulingModule::Get().GetProcesses().GetCurrentProcess();
+    RET_UNEXPECTED_IF(!process, Mem::MemError::NotFound);
+
+    return ::MemoryModule::Get().GetVmm().SyncArea(process.value()->address_space, addr);
+}
+
+}  // namespace Syscall
+
+#endif  // KERNEL_SRC_SYSCALLS_CALLS_MEM_HPP_
@@ -0,0 +1,75 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025-2026 The AlkOS Authors
+// See the AUTHORS file for the full list of contributors.
+
+#ifndef KERNEL_SRC_SYSCALLS_CALLS_RING_HPP_
+#define KERNEL_SRC_SYSCALLS_CALLS_RING_HPP_
+
+#include <string.h>
+#include <defines.h>
+#include <template/scope_guard.hpp>
+
+#include "mem/error.hpp"
+#include "modules/memory.hpp"
+#include "modules/scheduling.hpp"
+#include "syscalls/ring.hpp"
+
+namespace Syscall
+{
+// ------------------------------
+// Io Ring Syscalls
+// ------------------------------
+
+/**
+ * @brief Create the io ring of the calling process and map it into its address space. The
+ * kernel reaches the ring through the direct map, so it needs no access to the process pages.
+ * @return Address of the ring on success, or error. A process has at most one ring
+ */
+FORCE_INLINE_F std::expected<u64, Mem::MemError> SysRingSetup()
+{
+    const auto process = SchedulingModule::Get().GetProcesses().GetCurrentProcess();
+    RET_UNEXPECTED_IF(!process, Mem::MemError::NotFound);
+
+    Sched::Process *proc = *process;
+    RET_UNEXPECTED_IF(proc->io_ring != nullptr, Mem::MemError::InvalidArgument);
+
+    auto &pmm        = ::MemoryModule::Get().GetBuddyPmm();
+    const auto frame = pmm.Alloc({.order = Mem::BuddyPmm::SizeToPageOrder(kIoRingBytes)});
+    RET_UNEXPECTED_IF_ERR(frame);
+
+    template_lib::ScopeGuard frame_guard([&]() {
+        pmm.Free(*frame);
+    });
+
+    memset(Mem::PhysToVirt(*frame), 0, kIoRingBytes);
+
+    const Mem::VirtualMemAreaFlags flags{.readable = true, .writable = true};
+    auto res = ::MemoryModule::Get().GetVmm().MapUserShared(
+        proc->address_space, *frame, kIoRingBytes, flags
+    );
+    RET_UNEXPECTED_IF_ERR(res);
+
+    frame_guard.Dismiss();
+    proc->io_ring = *frame;
+
+    return Mem::PtrToUptr(*res);
+}
+
+/**
+ * @brief Process queued submissions of the io ring of the calling process
+ * @param count Maximal number of submissions to process
+ * @return Number of submissions processed on success, or error
+ */
+FORCE_INLINE_F std::expected<size_t, Mem::MemError> SysRingEnter(const u32 count)
+{
+    const auto process = SchedulingModule::Get().GetProcesses().GetCurrentProcess();
+    RET_UNEXPECTED_IF(!process, Mem::MemError::NotFound);
+    RET_UNEXPECTED_IF(process.value()->io_ring == nullptr, Mem::MemError::NotFound);
+
+    auto *ring = reinterpret_cast<IoRing *>(Mem::PhysToVirt(process.value()->io_ring));
+    return ProcessRing(*ring, count);
+}
+
+}  // namespace Syscall
+
+#endif  // KERNEL_SRC_SYSCALLS_CALLS_RING_HPP_
@@ -0,0 +1,103 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025-2026 The AlkOS Authors
+// See the AUTHORS file for the full list of contributors.
+
+#ifndef KERNEL_SRC_SYSCALLS_CALLS_STATS_HPP_
+#define KERNEL_SRC_SYSCALLS_CALLS_STATS_HPP_
+
+#include <alkos/syscall_stats.h>
+#include <autogen/feature_flags.h>
+#include <algorithm.hpp>
+#include <defines.h>
+
+#include "mem/error.hpp"
+#include "mem/virt/user_access.hpp"
+#include "modules/scheduling.hpp"
+#include "syscalls/stats.hpp"
+
+namespace Syscall
+{
+// ------------------------------
+// Tracing Syscalls
+// ------------------------------
+
+namespace internal
+{
+
+NODISCARD FORCE_INLINE_F std::expected<Sched::Process *, Mem::MemError> GetTracedProcess(
+    const u64 pid
+)
+{
+    RET_UNEXPECTED_IF(
+        !FeatureEnabled<FeatureFlag::kSyscallStats>, Mem::MemError::InvalidArgument
+    );
+
+    const Sched::Pid target = *reinterpret_cast<const Sched::Pid *>(&pid);
+    const auto process      = SchedulingModule::Get().GetProcesses().GetProcess(target);
+
+    // The slot may already hold a newer process with the same id
+    RET_UNEXPECTED_IF(!process || process.value()->pid != target, Mem::MemError::NotFound);
+    return process.value();
+}
+
+}  // namespace internal
+
+/**
+ * @brief Read the syscall statistics summed over all cores, indexed by syscall number
+ * @return Number of entries written, 0 when the kernel is built without syscall statistics
+ */
+FORCE_INLINE_F std::expected<size_t, Mem::MemError> SysGetSyscallStats(
+    std::span<SyscallStats> stats
+)
+{
+    if constexpr (!FeatureEnabled<FeatureFlag::kSyscallStats>) {
+        return 0;
+    }
+
+    const size_t count = std::min(stats.size(), static_cast<size_t>(kSysMax));
+    for (size_t number = 0; number < count; ++number) {
+        const auto copied = Mem::CopyToUser(stats.data() + number, SumSyscallStats(number));
+        RET_UNEXPECTED_IF_ERR(copied);
+    }
+
+    return count;
+}
+
+/**
+ * @brief Start or stop recording the syscalls of a process
+ */
+FORCE_INLINE_F std::expected<void, Mem::MemError> SysTraceSyscalls(const u64 pid, const bool enable)
+{
+    const auto process = internal::GetTracedProcess(pid);
+    RET_UNEXPECTED_IF_ERR(process);
+
+    if (!enable) {
+        StopSyscallTrace(*process.value());
+        return {};
+    }
+
+    return StartSyscallTrace(*process.value());
+}
+
+/**
+ * @brief Move the oldest trace records of a process to the buffer
+ * @return Number of records written, 0 if the process is not traced or nothing is pending
+ */
+FORCE_INLINE_F std::expected<size_t, Mem::MemError> SysReadSyscallTrace(
+    const u64 pid, std::span<SyscallTraceRecord> records
+)
+{
+    const auto process = internal::GetTracedProcess(pid);
+    RET_UNEXPECTED_IF_ERR(process);
+
+    return ReadSyscallTrace(*process.value(), records);
+}
+
+/**
+ * @brief Do nothing. Goes through the full dispatch path, so it measures the syscall overhead.
+ */
+FORCE_INLINE_F void SysNop() {}
+
+}  // namespace Syscall
+
+#endif  // KERNEL_SRC_SYSCALLS_CALLS_STATS_HPP_
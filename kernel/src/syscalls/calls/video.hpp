@@ -7,7 +7,9 @@
 
 #include <alkos/video.h>
 #include <defines.h>
+#include <span.hpp>
 #include "hardware/core_local.hpp"
+#include "mem/virt/user_access.hpp"
 #include "modules/video.hpp"
 #include "trace_framework.hpp"
 
@@ -56,15 +58,72 @@ FORCE_INLINE_F void SysCreateGraphicSession(GuiBufferInfo *user_info)
 }
 
 /**
- * @brief Copies the current process's backbuffer to the physical screen
+ * @brief Hands the changed areas of the current process's backbuffer to the compositor
+ * @param rects Damage rectangles, no rectangles or more than kGuiMaxDamageRects damage the whole
+ * backbuffer
+ * @return Whether the session can be seen, see GuiSessionVisibility
  */
-FORCE_INLINE_F void SysBlit()
+FORCE_INLINE_F std::expected<GuiSessionVisibility, Mem::MemError> SysBlit(
+    std::span<const GuiRect> rects
+)
 {
     auto &wm = VideoModule::Get().GetWindowManager();
     auto pid = hardware::GetRunningPid();
 
-    DEBUG_FREQ_INFO_GENERAL("SysBlit called by PID: %llu", pid);
-    wm.Blit(pid);
+    DEBUG_FREQ_INFO_GENERAL("SysBlit called by PID: %llu, rects: %zu", pid, rects.size());
+    if (rects.empty() || rects.size() > kGuiMaxDamageRects) {
+        return wm.Blit(pid);
+    }
+
+    GuiRect kernel_rects[kGuiMaxDamageRects];
+    const auto copied = Mem::CopyFromUser(kernel_rects, rects.data(), rects.size_bytes());
+    RET_UNEXPECTED_IF_ERR(copied);
+
+    return wm.Blit(pid, std::span<const GuiRect>(kernel_rects, rects.size()));
+}
+
+/**
+ * @brief Chooses where the current process's session buffer lives, see GuiSessionMode
+ */
+FORCE_INLINE_F std::expected<void, Mem::MemError> SysSetGraphicSessionMode(GuiSessionMode mode)
+{
+    auto &wm = VideoModule::Get().GetWindowManager();
+    return wm.SetSessionMode(hardware::GetRunningPid(), mode);
+}
+
+/**
+ * @brief Moves the current process's session to the given area of the screen
+ * @param user_frame Clipped to the screen and written back
+ */
+FORCE_INLINE_F std::expected<void, Mem::MemError> SysSetGraphicSessionFrame(GuiRect *user_frame)
+{
+    GuiRect frame;
+    const auto copied_in = Mem::CopyFromUser(frame, user_frame);
+    RET_UNEXPECTED_IF_ERR(copied_in);
+
+    auto &wm         = VideoModule::Get().GetWindowManager();
+    const auto moved = wm.SetSessionFrame(hardware::GetRunningPid(), frame);
+    RET_UNEXPECTED_IF_ERR(moved);
+
+    return Mem::CopyToUser(user_frame, frame);
+}
+
+/**
+ * @brief Blocks until the next present slot of the current process's session
+ * @param user_stats Filled with the frame statistics of the session, may be null
+ */
+FORCE_INLINE_F std::expected<void, Mem::MemError> SysWaitFrame(GuiFrameStats *user_stats)
+{
+    auto &wm = VideoModule::Get().GetWindowManager();
+
+    GuiFrameStats stats;
+    const auto waited = wm.WaitFrame(hardware::GetRunningPid(), stats);
+    RET_UNEXPECTED_IF_ERR(waited);
+
+    if (user_stats == nullptr) {
+        return {};
+    }
+    return Mem::CopyToUser(user_stats, stats);
 }
 
 }  // namespace Syscall
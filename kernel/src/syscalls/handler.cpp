@@ -0,0 +1,28 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025-2026 The AlkOS Authors
+// See the AUTHORS file for the full list of contributors.
+
+#include "syscalls/handler.hpp"
+
+#include "hardware/core_local.hpp"
+#include "scheduling/thread.hpp"
+
+namespace Syscall::internal
+{
+
+// Two path syscalls copy in both strings before the call
+static_assert(2 * kMaxStringArgSize <= Sched::SyscallArena::kSize);
+
+const char *CopyInString(const char *user_str)
+{
+    auto &arena = hardware::GetCoreLocalTcb()->syscall_arena;
+    auto *dst   = static_cast<char *>(arena.Allocate(kMaxStringArgSize, alignof(char)));
+    if (dst == nullptr) {
+        return nullptr;
+    }
+
+    const auto length = Mem::CopyStringFromUser(dst, user_str, kMaxStringArgSize);
+    return length ? dst : nullptr;
+}
+
+}  // namespace Syscall::internal
@@ -5,12 +5,14 @@
 #ifndef KERNEL_SRC_SYSCALLS_HANDLER_HPP_
 #define KERNEL_SRC_SYSCALLS_HANDLER_HPP_
 
+#include <alkos/syscall.h>
 #include <expected.hpp>
 #include <span.hpp>
 #include <type_traits.hpp>
 #include <utility.hpp>
 
 #include "hal/types.hpp"
+#include "mem/virt/user_access.hpp"
 
 namespace Syscall
 {
@@ -68,6 +70,38 @@ concept ConstructibleFromCString = requires(const char *str) {
     { T(str) };
 };
 
+// Arguments built from a user C string, the string is copied into kernel memory first
+template <typename T>
+constexpr bool is_user_string_v =
+    std::is_class_v<std::remove_cvref_t<T>> && !is_span_v<std::remove_cvref_t<T>> &&
+    ConstructibleFromCString<std::remove_cvref_t<T>>;
+
+// References to types built from a C string (e.g. const vfs::Path &) are passed a temporary
+// constructed for the duration of the call
+template <typename T>
+struct converted_arg {
+    using type = T;
+};
+
+template <typename T>
+    requires std::is_reference_v<T> && is_user_string_v<T>
+struct converted_arg<T> {
+    using type = std::remove_cvref_t<T>;
+};
+
+template <typename T>
+using converted_arg_t = converted_arg<T>::type;
+
+// Longest string accepted as a syscall argument, including the terminator
+static constexpr size_t kMaxStringArgSize = 1024;
+
+/**
+ * @brief Copy a user string argument into the syscall arena of the running thread
+ * @return The kernel copy, valid until the syscall returns, or nullptr if the string is not
+ * readable or does not fit into kMaxStringArgSize
+ */
+const char *CopyInString(const char *user_str);
+
 }  // namespace internal
 
 template <typename T>
@@ -131,8 +165,34 @@ class SyscallWrapper
         return args.*(members[Idx]);
     }
 
+    // Returned for arguments failing validation, before the target function is called
+    static constexpr hal::reg_t kBadArgument = static_cast<hal::reg_t>(kSyscallBadArgument);
+
+    // Validate user memory described by the argument and copy in strings, kernel_str receives the
+    // copy. Run for every argument before any of them is converted. Span data itself is only
+    // range-checked, handlers access it through the user copy routines.
     template <typename T, size_t RegIdx>
-    FAST_CALL T ConvertArg(const SyscallArgs &args)
+    FAST_CALL bool PrepareArg(const SyscallArgs &args, const char *&kernel_str)
+    {
+        if constexpr (internal::is_span_v<T>) {
+            using ElemType = internal::span_element_type_t<T>;
+
+            auto *ptr = reinterpret_cast<ElemType *>(GetRawArg<RegIdx>(args));
+            return Mem::IsUserArray(ptr, GetRawArg<RegIdx + 1>(args));
+        } else if constexpr (internal::is_user_string_v<T>) {
+            kernel_str = internal::CopyInString(
+                reinterpret_cast<const char *>(GetRawArg<RegIdx>(args))
+            );
+            return kernel_str != nullptr;
+        } else {
+            return true;
+        }
+    }
+
+    template <typename T, size_t RegIdx>
+    FAST_CALL internal::converted_arg_t<T> ConvertArg(
+        const SyscallArgs &args, const char *kernel_str
+    )
     {
         if constexpr (internal::is_span_v<T>) {
             // Span needs two consecutive registers: pointer and size
@@ -147,19 +207,16 @@ class SyscallWrapper
         } else if constexpr (std::is_reference_v<T>) {
             using BaseType = std::remove_reference_t<T>;
 
-            if constexpr (internal::ConstructibleFromCString<BaseType>) {
-                // TODO: Fix for multithreading scenarios
-                // Special case: reference to type constructible from const char*
-                auto str                 = reinterpret_cast<const char *>(GetRawArg<RegIdx>(args));
-                static BaseType temp_obj = BaseType(str);
-                return temp_obj;
+            if constexpr (internal::is_user_string_v<BaseType>) {
+                // Special case: reference to type constructible from const char*, the returned
+                // temporary lives until the target function returns
+                return BaseType(kernel_str);
             } else {
                 return *reinterpret_cast<BaseType *>(GetRawArg<RegIdx>(args));
             }
-        } else if constexpr (internal::ConstructibleFromCString<T>) {
+        } else if constexpr (internal::is_user_string_v<T>) {
             // Direct construction from const char* (e.g., vfs::Path from const char*)
-            auto str = reinterpret_cast<const char *>(GetRawArg<RegIdx>(args));
-            return T(str);
+            return T(kernel_str);
         } else {
             return static_cast<T>(GetRawArg<RegIdx>(args));
         }
@@ -173,8 +230,16 @@ class SyscallWrapper
     struct Dispatch<Ret, std::index_sequence<Is...>, Args...> {
         FAST_CALL hal::reg_t operator()(const SyscallArgs &args)
         {
+            // One extra slot, so that syscalls without arguments do not declare an empty array
+            const char *strings[sizeof...(Args) + 1]{};
+            if (!(PrepareArg<Args, CalcRegOffset<Is, Args...>()>(args, strings[Is]) && ...)) {
+                return kBadArgument;
+            }
+
             if constexpr (internal::is_expected_v<Ret>) {
-                auto result = TargetFunc(ConvertArg<Args, CalcRegOffset<Is, Args...>()>(args)...);
+                auto result = TargetFunc(
+                    ConvertArg<Args, CalcRegOffset<Is, Args...>()>(args, strings[Is])...
+                );
                 if (result.has_value()) {
                     if constexpr (std::is_void_v<typename Ret::value_type>) {
                         return 0;
@@ -185,10 +250,12 @@ class SyscallWrapper
                     return static_cast<hal::reg_t>(-static_cast<long>(result.error()));
                 }
             } else if constexpr (std::is_void_v<Ret>) {
-                TargetFunc(ConvertArg<Args, CalcRegOffset<Is, Args...>()>(args)...);
+                TargetFunc(ConvertArg<Args, CalcRegOffset<Is, Args...>()>(args, strings[Is])...);
                 return 0;
             } else {
-                auto result = TargetFunc(ConvertArg<Args, CalcRegOffset<Is, Args...>()>(args)...);
+                auto result = TargetFunc(
+                    ConvertArg<Args, CalcRegOffset<Is, Args...>()>(args, strings[Is])...
+                );
 
                 if constexpr (std::is_pointer_v<Ret>)
                     return reinterpret_cast<hal::reg_t>(result);
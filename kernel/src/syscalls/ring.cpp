@@ -0,0 +1,140 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025-2026 The AlkOS Authors
+// See the AUTHORS file for the full list of contributors.
+
+#include "syscalls/ring.hpp"
+
+#include <atomic.hpp>
+#include <template/scope_guard.hpp>
+
+#include "hardware/core_local.hpp"
+#include "syscalls/calls/fd.hpp"
+#include "syscalls/calls/thread.hpp"
+#include "syscalls/calls/video.hpp"
+#include "syscalls/handler.hpp"
+
+namespace Syscall
+{
+
+namespace
+{
+
+constexpr i64 kInvalidSubmission = -static_cast<i64>(Fs::FdError::kInvalidArgument);
+
+/// Completion result of a syscall, encoded the same way as the syscall return value
+template <typename T, typename E>
+i64 ToCompletionResult(const std::expected<T, E> &result)
+{
+    if (!result) {
+        return -static_cast<i64>(result.error());
+    }
+
+    if constexpr (std::is_void_v<T>) {
+        return 0;
+    } else {
+        return static_cast<i64>(*result);
+    }
+}
+
+i64 Execute(const RingSubmission &submission)
+{
+    switch (submission.op) {
+        case kRingOpNop:
+            return 0;
+        case kRingOpRead: {
+            if (!internal::IsUserBuffer(submission.addr, submission.length)) {
+                return kInvalidSubmission;
+            }
+
+            const std::span buffer(Mem::UptrToPtr<byte>(submission.addr), submission.length);
+            if (submission.offset == kRingOffsetCurrent) {
+                return ToCompletionResult(SysRead(submission.fd, buffer));
+            }
+            return ToCompletionResult(SysPRead(submission.fd, buffer, submission.offset));
+        }
+        case kRingOpWrite: {
+            if (!internal::IsUserBuffer(submission.addr, submission.length)) {
+                return kInvalidSubmission;
+            }
+
+            const std::span buffer(
+                Mem::UptrToPtr<const byte>(submission.addr), submission.length
+            );
+            if (submission.offset == kRingOffsetCurrent) {
+                return ToCompletionResult(SysWrite(submission.fd, buffer));
+            }
+            return ToCompletionResult(SysPWrite(submission.fd, buffer, submission.offset));
+        }
+        case kRingOpOpen: {
+            // The copy is released once the submission completes, so a batch of opens fits
+            auto &arena     = hardware::GetCoreLocalTcb()->syscall_arena;
+            const auto mark = arena.Mark();
+            template_lib::ScopeGuard arena_guard([&]() {
+                arena.Rewind(mark);
+            });
+
+            const char *path = internal::CopyInString(Mem::UptrToPtr<const char>(submission.addr));
+            if (path == nullptr) {
+                return kInvalidSubmission;
+            }
+
+            return ToCompletionResult(
+                SysOpen(vfs::Path(path), static_cast<Fs::OpenMode>(submission.length))
+            );
+        }
+        case kRingOpClose:
+            return ToCompletionResult(SysClose(submission.fd));
+        case kRingOpBlit: {
+            const auto *rects = Mem::UptrToPtr<const GuiRect>(submission.addr);
+            if (!Mem::IsUserArray(rects, submission.length)) {
+                return kInvalidSubmission;
+            }
+
+            SysBlit(std::span(rects, submission.length));
+            return 0;
+        }
+        case kRingOpSleep:
+            SysNanoSleep(submission.length);
+            return 0;
+        default:
+            return kInvalidSubmission;
+    }
+}
+
+}  // namespace
+
+std::expected<size_t, Mem::MemError> ProcessRing(IoRing &ring, const u32 count)
+{
+    std::atomic_ref<u32> sq_head_ref(ring.sq_head);
+    std::atomic_ref<u32> sq_tail_ref(ring.sq_tail);
+    std::atomic_ref<u32> cq_head_ref(ring.cq_head);
+    std::atomic_ref<u32> cq_tail_ref(ring.cq_tail);
+
+    // Every index is read once, so the process cannot change the bounds checked here
+    const u32 sq_tail = sq_tail_ref.load(std::memory_order_acquire);
+    u32 sq_head       = sq_head_ref.load(std::memory_order_relaxed);
+    u32 cq_tail       = cq_tail_ref.load(std::memory_order_relaxed);
+    RET_UNEXPECTED_IF(sq_tail - sq_head > kRingSqEntries, Mem::MemError::InvalidArgument);
+
+    size_t done = 0;
+    while (done < count && sq_head != sq_tail) {
+        if (cq_tail - cq_head_ref.load(std::memory_order_acquire) >= kRingCqEntries) {
+            // The rest waits for the process to reap completions
+            break;
+        }
+
+        const RingSubmission submission = ring.sq[sq_head & (kRingSqEntries - 1)];
+        sq_head_ref.store(++sq_head, std::memory_order_release);
+
+        RingCompletion &completion = ring.cq[cq_tail & (kRingCqEntries - 1)];
+        completion.user_data       = submission.user_data;
+        completion.result          = Execute(submission);
+        cq_tail_ref.store(++cq_tail, std::memory_order_release);
+
+        ++done;
+    }
+
+    return done;
+}
+
+}  // namespace Syscall
@@ -0,0 +1,39 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025-2026 The AlkOS Authors
+// See the AUTHORS file for the full list of contributors.
+
+#ifndef KERNEL_SRC_SYSCALLS_RING_HPP_
+#define KERNEL_SRC_SYSCALLS_RING_HPP_
+
+#include <alkos/ring.h>
+#include <types.h>
+#include <bits_ext.hpp>
+#include <expected.hpp>
+
+#include "hal/constants.hpp"
+#include "mem/error.hpp"
+
+namespace Syscall
+{
+
+static_assert((kRingSqEntries & (kRingSqEntries - 1)) == 0, "Entries must be a power of 2");
+static_assert((kRingCqEntries & (kRingCqEntries - 1)) == 0, "Entries must be a power of 2");
+
+/// Size of the physically contiguous buffer holding an IoRing, mapped into the process
+inline constexpr size_t kIoRingBytes = AlignUp(sizeof(IoRing), hal::kPageSizeBytes);
+
+/**
+ * @brief Process up to count queued submissions of the ring, posting a completion for each.
+ *
+ * Operations run synchronously in the context of the calling thread, in submission order.
+ * Processing stops early once the completion queue is full. The ring lives in memory the
+ * process can modify at any time, so indices are checked and every submission is copied out
+ * before it is used. Threads sharing one ring must serialize their calls.
+ *
+ * @return Number of submissions processed
+ */
+std::expected<size_t, Mem::MemError> ProcessRing(IoRing &ring, u32 count);
+
+}  // namespace Syscall
+
+#endif  // KERNEL_SRC_SYSCALLS_RING_HPP_
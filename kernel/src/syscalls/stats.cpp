@@ -0,0 +1,211 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025-2026 The AlkOS Authors
+// See the AUTHORS file for the full list of contributors.
+
+#include "syscalls/stats.hpp"
+
+#include <algorithm.hpp>
+#include <bit.hpp>
+
+#include "hal/spinlock.hpp"
+#include "hal/timers.hpp"
+#include "hardware/core_local.hpp"
+#include "mem/heap.hpp"
+#include "mem/virt/user_access.hpp"
+#include "modules/hardware.hpp"
+#include "modules/scheduling.hpp"
+#include "scheduling/local_lock.hpp"
+
+namespace Syscall
+{
+
+namespace
+{
+
+// Guards the trace rings of all processes, the rings are touched once per traced syscall only
+hal::Spinlock g_trace_lock{};
+
+size_t LatencyBucket(const u64 cycles)
+{
+    if (cycles == 0) {
+        return 0;
+    }
+
+    const auto bucket = static_cast<size_t>(std::bit_width(cycles) - 1);
+    return std::min(bucket, static_cast<size_t>(kSyscallLatencyBuckets - 1));
+}
+
+void PushTraceRecord(const Sched::Pid owner, const SyscallTraceRecord &record)
+{
+    const auto process = SchedulingModule::Get().GetProcesses().GetProcess(owner);
+    if (!process) {
+        return;
+    }
+
+    g_trace_lock.Lock();
+    if (process.value()->syscall_trace != nullptr) {
+        process.value()->syscall_trace->Push(record);
+    }
+    g_trace_lock.Unlock();
+}
+
+}  // namespace
+
+void RecordSyscallEntry(
+    Sched::Thread &thread, const u64 number, const u64 arg0, const u64 arg1, const u64 arg2
+)
+{
+    SyscallTraceRecord &record = thread.syscall_record;
+    record.number              = static_cast<u32>(number);
+    record.tid                 = thread.tid.id;
+    record.args[0]             = arg0;
+    record.args[1]             = arg1;
+    record.args[2]             = arg2;
+    record.start_cycles        = hal::ReadCycleCounter();
+}
+
+void RecordSyscallExit(Sched::Thread &thread, const i64 result)
+{
+    SyscallTraceRecord &record = thread.syscall_record;
+    if (record.start_cycles == 0) {
+        // Rejected before dispatch, no entry was recorded
+        return;
+    }
+
+    record.cycles       = hal::ReadCycleCounter() - record.start_cycles;
+    record.result       = result;
+    record.start_cycles = 0;
+
+    {
+        // Counters are per core, keep the thread on this core while updating them
+        LocalCoreLock core_lock{};
+
+        hardware::CoreLocal *core_local = hardware::GetCoreLocalSelf();
+        if (core_local->syscall_stats == nullptr) {
+            const auto core_stats = Mem::KNew<CoreSyscallStats>();
+            if (!core_stats) {
+                return;
+            }
+            core_local->syscall_stats = core_stats.value();
+        }
+
+        SyscallStats &stats = core_local->syscall_stats->calls[record.number];
+        stats.count++;
+        stats.total_cycles += record.cycles;
+        stats.max_cycles = std::max(stats.max_cycles, record.cycles);
+        stats.histogram[LatencyBucket(record.cycles)]++;
+
+        PushTraceRecord(thread.owner, record);
+    }
+}
+
+std::expected<void, Mem::MemError> StartSyscallTrace(Sched::Process &process)
+{
+    const auto ring = Mem::KNew<SyscallTraceRing>();
+    RET_UNEXPECTED_IF_ERR(ring);
+
+    LocalCoreLock core_lock{};
+    g_trace_lock.Lock();
+    const bool traced = process.syscall_trace != nullptr;
+    if (!traced) {
+        process.syscall_trace = ring.value();
+    }
+    g_trace_lock.Unlock();
+
+    if (traced) {
+        Mem::KDelete(ring.value());
+    }
+    return {};
+}
+
+void StopSyscallTrace(Sched::Process &process)
+{
+    SyscallTraceRing *ring;
+    {
+        LocalCoreLock core_lock{};
+        g_trace_lock.Lock();
+        ring                  = process.syscall_trace;
+        process.syscall_trace = nullptr;
+        g_trace_lock.Unlock();
+    }
+
+    if (ring != nullptr) {
+        Mem::KDelete(ring);
+    }
+}
+
+std::expected<size_t, Mem::MemError> ReadSyscallTrace(
+    Sched::Process &process, std::span<SyscallTraceRecord> user_records
+)
+{
+    // Records pass through a kernel buffer, user memory may fault and is never touched under
+    // the lock
+    static constexpr size_t kChunk = 16;
+    SyscallTraceRecord chunk[kChunk];
+
+    size_t done = 0;
+    while (done < user_records.size()) {
+        SyscallTraceRing *ring = nullptr;
+        u64 consumed           = 0;
+        size_t count           = 0;
+        {
+            LocalCoreLock core_lock{};
+            g_trace_lock.Lock();
+            ring = process.syscall_trace;
+            if (ring != nullptr) {
+                count = ring->Peek(
+                    std::span(chunk, std::min(kChunk, user_records.size() - done)), consumed
+                );
+            }
+            g_trace_lock.Unlock();
+        }
+
+        if (count == 0) {
+            break;
+        }
+
+        const auto copied =
+            Mem::CopyToUser(user_records.data() + done, chunk, count * sizeof(SyscallTraceRecord));
+        RET_UNEXPECTED_IF_ERR(copied);
+        done += count;
+
+        {
+            // A trace stopped meanwhile dropped the records anyway
+            LocalCoreLock core_lock{};
+            g_trace_lock.Lock();
+            if (process.syscall_trace == ring) {
+                ring->Consume(consumed, count);
+            }
+            g_trace_lock.Unlock();
+        }
+    }
+
+    return done;
+}
+
+SyscallStats SumSyscallStats(const u64 number)
+{
+    SyscallStats sum{};
+
+    auto &cores = HardwareModule::Get().GetCoresController();
+    for (size_t lid = 0; lid < cores.GetCoreCount(); ++lid) {
+        const CoreSyscallStats *core_stats =
+            cores.GetCoreLocalByLid(static_cast<u16>(lid)).syscall_stats;
+        if (core_stats == nullptr) {
+            continue;
+        }
+
+        // Other cores keep counting, the sum is a snapshot that may be slightly torn
+        const SyscallStats &stats = core_stats->calls[number];
+        sum.count += stats.count;
+        sum.total_cycles += stats.total_cycles;
+        sum.max_cycles = std::max(sum.max_cycles, stats.max_cycles);
+        for (size_t i = 0; i < kSyscallLatencyBuckets; ++i) {
+            sum.histogram[i] += stats.histogram[i];
+        }
+    }
+
+    return sum;
+}
+
+}  // namespace Syscall
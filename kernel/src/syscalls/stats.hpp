@@ -0,0 +1,108 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025-2026 The AlkOS Authors
+// See the AUTHORS file for the full list of contributors.
+
+#ifndef KERNEL_SRC_SYSCALLS_STATS_HPP_
+#define KERNEL_SRC_SYSCALLS_STATS_HPP_
+
+#include <alkos/syscall.h>
+#include <alkos/syscall_stats.h>
+#include <array.hpp>
+#include <data_structures/cyclic_buffer.hpp>
+#include <expected.hpp>
+#include <span.hpp>
+
+#include "mem/error.hpp"
+
+namespace Sched
+{
+struct Process;
+struct Thread;
+}
+
+namespace Syscall
+{
+
+/**
+ * @brief Counters of a single core, indexed by syscall number. Only the owning core writes them,
+ * they are allocated by the first syscall it accounts.
+ */
+struct CoreSyscallStats {
+    std::array<SyscallStats, kSysMax> calls{};
+};
+
+/**
+ * @brief Completed syscalls of a traced process. Once full, new records are dropped until the
+ * tracer catches up. Access is serialised by the trace functions below.
+ *
+ * Records are copied out with Peek() and only consumed by Consume() once the tracer received
+ * them. Consume() is keyed by the count of records consumed before the Peek(), so of tracers
+ * reading concurrently only one consumes the records they both received.
+ */
+class SyscallTraceRing
+{
+    public:
+    static constexpr size_t kCapacity = 256;
+
+    void Push(const SyscallTraceRecord &record)
+    {
+        records_.Write(std::span<const SyscallTraceRecord>(&record, 1));
+    }
+
+    /// @param consumed Receives the number of records consumed so far, passed to Consume()
+    NODISCARD size_t Peek(std::span<SyscallTraceRecord> out, u64 &consumed)
+    {
+        consumed = consumed_;
+        return records_.Peek(out);
+    }
+
+    void Consume(const u64 consumed, const size_t count)
+    {
+        if (consumed == consumed_) {
+            consumed_ += records_.Discard(count);
+        }
+    }
+
+    private:
+    data_structures::CyclicBuffer<SyscallTraceRecord, kCapacity> records_{};
+    u64 consumed_{0};
+};
+
+/**
+ * @brief Start timing a syscall of the given thread, called on kernel entry
+ */
+void RecordSyscallEntry(Sched::Thread &thread, u64 number, u64 arg0, u64 arg1, u64 arg2);
+
+/**
+ * @brief Account the syscall started by RecordSyscallEntry() to the current core and to the
+ * trace of the owning process, called on kernel exit
+ */
+void RecordSyscallExit(Sched::Thread &thread, i64 result);
+
+/**
+ * @brief Start recording the syscalls of a process, does nothing if it is already traced
+ */
+NODISCARD std::expected<void, Mem::MemError> StartSyscallTrace(Sched::Process &process);
+
+/**
+ * @brief Stop recording the syscalls of a process and drop its unread records
+ */
+void StopSyscallTrace(Sched::Process &process);
+
+/**
+ * @brief Move the oldest records of a traced process to a user buffer. Records are only removed
+ * from the trace once copied, a faulting buffer leaves them for the next read
+ * @return Number of records copied
+ */
+NODISCARD std::expected<size_t, Mem::MemError> ReadSyscallTrace(
+    Sched::Process &process, std::span<SyscallTraceRecord> user_records
+);
+
+/**
+ * @brief Sum the counters of a syscall number over all cores
+ */
+NODISCARD SyscallStats SumSyscallStats(u64 number);
+
+}  // namespace Syscall
+
+#endif  // KERNEL_SRC_SYSCALLS_STATS_HPP_
@@ -35,6 +35,14 @@ constinit auto g_syscall_dispatch_table = SyscallDispatchTable<kSysMax>::Create<
     table.RegisterHandler<kSysSeek, SysSeek>();
     table.RegisterHandler<kSysDup, SysDup>();
     table.RegisterHandler<kSysDupTo, SysDupTo>();
+    table.RegisterHandler<kSysReadV, SysReadV>();
+    table.RegisterHandler<kSysWriteV, SysWriteV>();
+    table.RegisterHandler<kSysPRead, SysPRead>();
+    table.RegisterHandler<kSysPWrite, SysPWrite>();
+    table.RegisterHandler<kSysPipe, SysPipe>();
+    table.RegisterHandler<kSysPoll, SysPoll>();
+    table.RegisterHandler<kSysSplice, SysSplice>();
+    table.RegisterHandler<kSysSendFile, SysSendFile>();
 
     // File System syscalls
     table.RegisterHandler<kSysReadDirectory, SysReadDirectory>();
@@ -60,13 +68,34 @@ constinit auto g_syscall_dispatch_table = SyscallDispatchTable<kSysMax>::Create<
     // Video
     table.RegisterHandler<kSysCreateGraphicSession, SysCreateGraphicSession>();
     table.RegisterHandler<kSysBlit, SysBlit>();
+    table.RegisterHandler<kSysSetGraphicSessionMode, SysSetGraphicSessionMode>();
+    table.RegisterHandler<kSysSetGraphicSessionFrame, SysSetGraphicSessionFrame>();
+    table.RegisterHandler<kSysWaitFrame, SysWaitFrame>();
 
     // Input
     table.RegisterHandler<kSysGetKeyState, SysGetKeyState>();
+    table.RegisterHandler<kSysReadInputEvents, SysReadInputEvents>();
 
     // Power Management
     table.RegisterHandler<kSysPower, SysPower>();
 
+    // Memory
+    table.RegisterHandler<kSysMmap, SysMmap>();
+    table.RegisterHandler<kSysMunmap, SysMunmap>();
+    table.RegisterHandler<kSysMsync, SysMsync>();
+    table.RegisterHandler<kSysMmapAnon, SysMmapAnon>();
+    table.RegisterHandler<kSysMprotect, SysMprotect>();
+
+    // Io Ring
+    table.RegisterHandler<kSysRingSetup, SysRingSetup>();
+    table.RegisterHandler<kSysRingEnter, SysRingEnter>();
+
+    // Tracing
+    table.RegisterHandler<kSysGetSyscallStats, SysGetSyscallStats>();
+    table.RegisterHandler<kSysTraceSyscalls, SysTraceSyscalls>();
+    table.RegisterHandler<kSysReadSyscallTrace, SysReadSyscallTrace>();
+    table.RegisterHandler<kSysNop, SysNop>();
+
     return table;
 }>();
 
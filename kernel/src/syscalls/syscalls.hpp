@@ -9,9 +9,12 @@
 #include "calls/fs.hpp"
 #include "calls/input.hpp"
 #include "calls/io.hpp"
+#include "calls/mem.hpp"
 #include "calls/panic.hpp"
 #include "calls/power.hpp"
 #include "calls/proc.hpp"
+#include "calls/ring.hpp"
+#include "calls/stats.hpp"
 #include "calls/thread.hpp"
 #include "calls/time.hpp"
 #include "calls/video.hpp"
@@ -3,6 +3,7 @@
 // See the AUTHORS file for the full list of contributors.
 
 #include <algorithm.hpp>
+#include <string.h>
 
 #include "hardware/core_local.hpp"
 #include "modules/hardware.hpp"
@@ -12,6 +13,7 @@
 #include <array.hpp>
 #include <hal/debug_terminal.hpp>
 #include <hal/terminal.hpp>
+#include <hal/timers.hpp>
 
 using namespace trace;
 
@@ -19,6 +21,15 @@ using namespace trace;
 // Trace framework implementation
 // ------------------------------------
 
+static u32 GetLogicalCoreId(const u32 hw_core_id)
+{
+    if (::HardwareModule::IsInited() &&
+        ::HardwareModule::Get().GetCoresController().AreCoresKnown()) {
+        return ::HardwareModule::Get().GetCoresController().MapHwToLogical(hw_core_id);
+    }
+    return hw_core_id;
+}
+
 static struct TraceFramework {
     // ------------------------------
     // Constants
@@ -75,6 +86,28 @@ static struct TraceFramework {
                                 [FeatureValue<FeatureFlag::kSingleTraceMaxSize>];
     };
 
+    /* Binary trace record, followed by the argument slots, see internal::EncodeTraceArg() */
+    struct BinaryTraceHeader {
+        u32 magic;
+        u16 size; /* Whole record */
+        u8 module;
+        u8 type;
+        u32 hw_core_id; /* Mapped to the logical one on dump */
+        u32 reserved;
+        u64 cycles;
+        u64 pid;
+        const char *format; /* Lives in .rodata, so it doubles as the format ID */
+    };
+
+    static constexpr u32 kBinaryTraceMagic = 0x54524143; /* "TRAC" */
+    static constexpr size_t kMaxFormatSpecSize = 16;
+
+    static_assert(
+        !FeatureEnabled<FeatureFlag::kBinaryTraces> ||
+            FeatureValue<FeatureFlag::kSingleTraceMaxSize> >= sizeof(BinaryTraceHeader),
+        "Single trace workspace cannot hold a binary trace record"
+    );
+
     struct StageCallbacks {
         char *(TraceFramework::*get_workspace_cb)();
         void (TraceFramework::*commit_to_log_cb)(size_t);
@@ -197,28 +230,45 @@ static struct TraceFramework {
     // Single core interrupts env implementation
     // -------------------------------------------------
 
+    template <bool kIsDebug>
+    FAST_CALL void WriteOut(const char *src, const size_t size)
+    {
+        if constexpr (kIsDebug) {
+            hal::DebugTerminalWrite(src, size);
+        } else {
+            hal::TerminalWrite(src, size);
+        }
+    }
+
     template <bool kIsDebug>
     FAST_CALL void HardenSingleCore(const char *src, const size_t size)
     {
         const char *start = src;
         const char *end   = src + size;
 
+        /* Messages are separated by their terminators, everything between goes out as one block */
         while (start != end) {
-            if (*start != '\0') {
-                if constexpr (kIsDebug) {
-                    hal::DebugTerminalPutChar(*start);
-                } else {
-                    hal::TerminalPutChar(*start);
-                }
+            const char *run_end = start;
+            while (run_end != end && *run_end != '\0') {
+                ++run_end;
+            }
+
+            if (run_end != start) {
+                WriteOut<kIsDebug>(start, static_cast<size_t>(run_end - start));
             }
 
-            ++start;
+            start = run_end == end ? end : run_end + 1;
         }
     }
 
     template <bool kIsDebug>
-    FAST_CALL void DumpBufferSingleCore(SmallTraceCyclicBuffer &buffer)
+    FORCE_INLINE_F void DumpBufferSingleCore(SmallTraceCyclicBuffer &buffer)
     {
+        if constexpr (FeatureEnabled<FeatureFlag::kBinaryTraces>) {
+            DumpBinaryBufferSingleCore<kIsDebug>(buffer);
+            return;
+        }
+
         // 1. Save exact amount of bytes to write at entry level (IMPORTANT: to not write infinite)
         const i32 bytes_left = hal::AtomicLoad(&buffer.bytes_left);
         i32 bytes_to_write   = static_cast<i32>(SmallTraceCyclicBuffer::kSize) - bytes_left;
@@ -256,6 +306,254 @@ static struct TraceFramework {
         }
     }
 
+    FAST_CALL void CopyFromRing(
+        const SmallTraceCyclicBuffer &buffer, const i32 offset, void *dst, const size_t size
+    )
+    {
+        const size_t space = SmallTraceCyclicBuffer::kSize - static_cast<size_t>(offset);
+        const size_t first = std::min(size, space);
+        memcpy(dst, buffer.buffer + offset, first);
+        memcpy(static_cast<char *>(dst) + first, buffer.buffer, size - first);
+    }
+
+    FAST_CALL void CopyToRing(
+        SmallTraceCyclicBuffer &buffer, const i32 offset, const void *src, const size_t size
+    )
+    {
+        const size_t space = SmallTraceCyclicBuffer::kSize - static_cast<size_t>(offset);
+        const size_t first = std::min(size, space);
+        memcpy(buffer.buffer + offset, src, first);
+        memcpy(buffer.buffer, static_cast<const char *>(src) + first, size - first);
+    }
+
+    template <bool kIsDebug>
+    FORCE_INLINE_F void DumpBinaryBufferSingleCore(SmallTraceCyclicBuffer &buffer)
+    {
+        // 1. Save exact amount of bytes to read at entry level (IMPORTANT: to not read infinite)
+        const i32 bytes_left = hal::AtomicLoad(&buffer.bytes_left);
+        i32 bytes_to_read    = static_cast<i32>(SmallTraceCyclicBuffer::kSize) - bytes_left;
+
+        while (bytes_to_read >= static_cast<i32>(sizeof(BinaryTraceHeader))) {
+            const i32 tail = buffer.tail.value;
+
+            // 1. Validate the record
+            BinaryTraceHeader header;
+            CopyFromRing(buffer, tail, &header, sizeof(header));
+            if (header.magic != kBinaryTraceMagic || header.size < sizeof(BinaryTraceHeader) ||
+                header.size > bytes_to_read ||
+                header.size > FeatureValue<FeatureFlag::kSingleTraceMaxSize>) {
+                /* Space is reserved but the record is still being written, next dump gets it */
+                return;
+            }
+
+            // 2. Format and write out
+            CopyFromRing(buffer, tail, binary_dump_record, header.size);
+            const size_t text_size =
+                FormatBinaryTrace(binary_dump_record, binary_dump_text, sizeof(binary_dump_text));
+            WriteOut<kIsDebug>(binary_dump_text, text_size);
+
+            // 3. A stale header must not pass for a new record once the space is reused
+            const BinaryTraceHeader consumed{};
+            CopyToRing(buffer, tail, &consumed, sizeof(consumed));
+
+            // 4. Push the tail and release space
+            hal::AtomicStore(
+                &buffer.tail, (tail + header.size) % static_cast<i32>(SmallTraceCyclicBuffer::kSize)
+            );
+            hal::AtomicAdd(&buffer.bytes_left, static_cast<i32>(header.size));
+
+            bytes_to_read -= header.size;
+        }
+    }
+
+    /**
+     * @brief Format a binary record the way Write() formats text traces at the call site
+     * @return Number of characters written to dst, the line ends with a new line
+     */
+    static size_t FormatBinaryTrace(const char *record, char *dst, const size_t dst_size)
+    {
+        BinaryTraceHeader header;
+        memcpy(&header, record, sizeof(header));
+
+        const char *arg      = record + sizeof(header);
+        const char *args_end = record + header.size;
+
+        const char *module_name = header.module < static_cast<u8>(TraceModule::kLast)
+                                      ? kTraceModuleNames[header.module]
+                                      : "UnknownModule";
+
+        size_t pos = ClampWritten(
+            snprintf(
+                dst, dst_size,
+                "[%s] "
+                "[MOD:%s] "      // Module name
+                "[TSC:%llu] "    // Cycle counter
+                "[CORE:%u] "     // Core ID
+                "[PROC:%llu] ",  // Process ID
+                header.type == static_cast<u8>(TraceType::kKernelLog) ? "LOG" : "DEBUG",
+                module_name, header.cycles, GetLogicalCoreId(header.hw_core_id), header.pid
+            ),
+            dst_size
+        );
+
+        const char *format = header.format;
+        while (*format != '\0' && pos + 1 < dst_size) {
+            if (*format != '%') {
+                dst[pos++] = *format++;
+                continue;
+            }
+
+            if (format[1] == '%') {
+                dst[pos++] = '%';
+                format += 2;
+                continue;
+            }
+
+            // Every conversion is applied on its own to the stored argument
+            char spec[kMaxFormatSpecSize];
+            size_t spec_size = 0;
+            spec[spec_size++] = *format++;
+            while (*format != '\0' && strchr("-+ #0123456789.*hljztL", *format) != nullptr &&
+                   spec_size < kMaxFormatSpecSize - 2) {
+                if (*format != '*') {
+                    spec[spec_size++] = *format++;
+                    continue;
+                }
+
+                // Width or precision passed as an argument took its own int slot, inline it
+                ++format;
+                const int value = ReadBinaryStarArg(arg, args_end);
+                if (value < 0 && spec[spec_size - 1] == '.') {
+                    /* A negative precision is taken as if it was omitted */
+                    --spec_size;
+                    continue;
+                }
+
+                const size_t spec_space = kMaxFormatSpecSize - 1 - spec_size;
+                spec_size += ClampWritten(
+                    snprintf(spec + spec_size, spec_space, "%d", value), spec_space
+                );
+            }
+
+            if (*format == '\0') {
+                break;
+            }
+
+            spec[spec_size++] = *format++;
+            spec[spec_size]   = '\0';
+
+            pos += FormatBinaryArg(dst + pos, dst_size - pos, spec, spec_size, arg, args_end);
+        }
+
+        /* Ensure to write eol */
+        if (pos == 0 || dst[pos - 1] != '\n') {
+            if (pos + 1 >= dst_size) {
+                pos = dst_size - 2;
+            }
+            dst[pos++] = '\n';
+        }
+        dst[pos] = '\0';
+
+        return pos;
+    }
+
+    /// Width or precision stored for a "*", a missing one reads as 0
+    static int ReadBinaryStarArg(const char *&arg, const char *args_end)
+    {
+        if (static_cast<size_t>(args_end - arg) < internal::kBinaryTraceSlotSize) {
+            return 0;
+        }
+
+        u64 slot;
+        memcpy(&slot, arg, sizeof(slot));
+        arg += internal::kBinaryTraceSlotSize;
+        return static_cast<int>(slot);
+    }
+
+    static size_t FormatBinaryArg(
+        char *dst, const size_t dst_size, const char *spec, const size_t spec_size,
+        const char *&arg, const char *args_end
+    )
+    {
+        static constexpr size_t kSlot = internal::kBinaryTraceSlotSize;
+
+        const char conversion = spec[spec_size - 1];
+        if (strchr("diouxXcpsfFeEgGaA", conversion) == nullptr) {
+            /* Unknown conversion (%n included) is printed as is */
+            return ClampWritten(snprintf(dst, dst_size, "%s", spec), dst_size);
+        }
+
+        if (static_cast<size_t>(args_end - arg) < kSlot) {
+            return ClampWritten(snprintf(dst, dst_size, "<?>"), dst_size);
+        }
+
+        u64 slot;
+        memcpy(&slot, arg, sizeof(slot));
+        arg += kSlot;
+
+        bool is_wide = false;
+        for (const char *modifier = spec; *modifier != '\0'; ++modifier) {
+            is_wide |= strchr("ljzt", *modifier) != nullptr;
+        }
+        int written = 0;
+
+        switch (conversion) {
+            case 's': {
+                char str[internal::kBinaryTraceMaxString + 1];
+                const size_t length = std::min(
+                    std::min(static_cast<size_t>(slot), static_cast<size_t>(args_end - arg)),
+                    sizeof(str) - 1
+                );
+                memcpy(str, arg, length);
+                str[length] = '\0';
+
+                const size_t stored = (slot + kSlot - 1) & ~(kSlot - 1);
+                arg += std::min(stored, static_cast<size_t>(args_end - arg));
+
+                written = snprintf(dst, dst_size, spec, str);
+                break;
+            }
+            case 'd':
+            case 'i':
+                written = is_wide ? snprintf(dst, dst_size, spec, static_cast<long long>(slot))
+                                  : snprintf(dst, dst_size, spec, static_cast<int>(slot));
+                break;
+            case 'o':
+            case 'u':
+            case 'x':
+            case 'X':
+                written = is_wide
+                              ? snprintf(dst, dst_size, spec, static_cast<unsigned long long>(slot))
+                              : snprintf(dst, dst_size, spec, static_cast<unsigned>(slot));
+                break;
+            case 'c':
+                written = snprintf(dst, dst_size, spec, static_cast<int>(slot));
+                break;
+            case 'p':
+                written = snprintf(dst, dst_size, spec, reinterpret_cast<void *>(slot));
+                break;
+            default: {
+                double value;
+                memcpy(&value, &slot, sizeof(value));
+                written = strchr(spec, 'L') != nullptr
+                              ? snprintf(dst, dst_size, spec, static_cast<long double>(value))
+                              : snprintf(dst, dst_size, spec, value);
+                break;
+            }
+        }
+
+        return ClampWritten(written, dst_size);
+    }
+
+    /// Characters snprintf actually stored
+    FAST_CALL size_t ClampWritten(const int written, const size_t dst_size)
+    {
+        if (written < 0 || dst_size == 0) {
+            return 0;
+        }
+        return std::min(static_cast<size_t>(written), dst_size - 1);
+    }
+
     FORCE_INLINE_F void CommitToLogPtrSingleCoreInterrupts(
         SmallTraceCyclicBuffer &buffer, const size_t trace_size
     )
@@ -363,6 +661,10 @@ static struct TraceFramework {
     SmallTraceCyclicBuffer trace_log{};
     SmallTraceCyclicBuffer trace_debug_log{};
 
+    /* Binary records are linearized and formatted here on dump */
+    char binary_dump_record[FeatureValue<FeatureFlag::kSingleTraceMaxSize>]{};
+    char binary_dump_text[FeatureValue<FeatureFlag::kSingleTraceMaxSize>]{};
+
     // ------------------------------
     // Multi core env fields
     // ------------------------------
@@ -403,11 +705,7 @@ int WriteTraceData(char *dst, TraceModule module, const TraceType type)
         system_time = ::TimingModule::Get().GetSystemTime().ReadLifeTimeNs();
     }
 
-    u32 core_id = hal::GetCurrentCoreId();
-    if (::HardwareModule::IsInited() &&
-        ::HardwareModule::Get().GetCoresController().AreCoresKnown()) {
-        core_id = ::HardwareModule::Get().GetCoresController().MapHwToLogical(core_id);
-    }
+    const u32 core_id = GetLogicalCoreId(hal::GetCurrentCoreId());
 
     Sched::Pid pid{};
     if (hardware::GetCoreLocalTcb() != nullptr) {
@@ -425,6 +723,39 @@ int WriteTraceData(char *dst, TraceModule module, const TraceType type)
     );
 }
 
+size_t WriteBinaryTraceHeader(
+    char *dst, const TraceModule module, const TraceType type, const char *format
+)
+{
+    ASSERT_NOT_NULL(dst);
+    ASSERT_NEQ(type, TraceType::kShell);
+    ASSERT_NEQ(type, TraceType::kLast);
+
+    Sched::Pid pid{};
+    if (hardware::GetCoreLocalTcb() != nullptr) {
+        pid = hardware::GetRunningPid();
+    }
+    static_assert(sizeof(pid) == sizeof(u64));
+
+    TraceFramework::BinaryTraceHeader header{};
+    header.magic      = TraceFramework::kBinaryTraceMagic;
+    header.module     = static_cast<u8>(module);
+    header.type       = static_cast<u8>(type);
+    header.hw_core_id = hal::GetCurrentCoreId();
+    header.cycles     = hal::ReadCycleCounter();
+    header.format     = format;
+    memcpy(&header.pid, &pid, sizeof(pid));
+
+    memcpy(dst, &header, sizeof(header));
+    return sizeof(header);
+}
+
+void SealBinaryTrace(char *record, const size_t size)
+{
+    const u16 record_size = static_cast<u16>(size);
+    memcpy(record + offsetof(TraceFramework::BinaryTraceHeader, size), &record_size, sizeof(u16));
+}
+
 }  // namespace internal
 
 namespace trace
@@ -8,6 +8,8 @@
 #include <assert.h>
 #include <autogen/feature_flags.h>
 #include <stdio.h>
+#include <string.h>
+#include <type_traits.hpp>
 
 namespace internal
 {
@@ -15,6 +17,55 @@ char *GetWorkspace();
 void CommitToLog(size_t trace_size);
 void CommitToDebugLog(size_t trace_size);
 int WriteTraceData(char *dst, trace::TraceModule module, trace::TraceType type);
+
+/* Binary traces */
+size_t WriteBinaryTraceHeader(
+    char *dst, trace::TraceModule module, trace::TraceType type, const char *format
+);
+void SealBinaryTrace(char *record, size_t size);
+
+/* Every argument of a binary record takes a slot, strings are copied after their length slot */
+inline constexpr size_t kBinaryTraceSlotSize  = sizeof(u64);
+inline constexpr size_t kBinaryTraceMaxString = 128;
+
+template <class T>
+FORCE_INLINE_F size_t EncodeTraceArg(char *dst, const size_t space, const T &arg)
+{
+    if (space < kBinaryTraceSlotSize) {
+        /* Dropped, printed as a missing argument */
+        return 0;
+    }
+
+    u64 slot = 0;
+    if constexpr (std::is_same_v<T, const char *> || std::is_same_v<T, char *>) {
+        /* The string may not outlive the call, so it is stored in place */
+        const char *str           = arg != nullptr ? arg : "(null)";
+        const size_t string_space = (space - kBinaryTraceSlotSize) & ~(kBinaryTraceSlotSize - 1);
+        const size_t length       = strnlen(
+            str, string_space < kBinaryTraceMaxString ? string_space : kBinaryTraceMaxString
+        );
+
+        slot = length;
+        memcpy(dst, &slot, sizeof(slot));
+        memcpy(dst + kBinaryTraceSlotSize, str, length);
+        return kBinaryTraceSlotSize +
+               ((length + kBinaryTraceSlotSize - 1) & ~(kBinaryTraceSlotSize - 1));
+    } else if constexpr (std::is_floating_point_v<T>) {
+        const double value = arg;
+        memcpy(&slot, &value, sizeof(value));
+    } else if constexpr (std::is_integral_v<T> || std::is_enum_v<T>) {
+        slot = static_cast<u64>(arg);
+    } else if constexpr (std::is_pointer_v<T>) {
+        slot = reinterpret_cast<u64>(arg);
+    } else {
+        /* Small structs are printed by their raw bytes, like varargs would */
+        static_assert(sizeof(T) <= sizeof(u64), "Trace argument does not fit a slot");
+        memcpy(&slot, &arg, sizeof(T));
+    }
+
+    memcpy(dst, &slot, sizeof(slot));
+    return kBinaryTraceSlotSize;
+}
 }  // namespace internal
 
 namespace trace
@@ -35,6 +86,22 @@ PREVENT_INLINE static void Write(const char *format, Args... args)
 
     char *workspace = internal::GetWorkspace();
 
+    if constexpr (FeatureEnabled<FeatureFlag::kBinaryTraces>) {
+        /* Raw arguments only, the message is formatted when the buffers are dumped */
+        size_t size = internal::WriteBinaryTraceHeader(workspace, module, type, format);
+        ((size += internal::EncodeTraceArg(workspace + size, kWorkspaceSize - size, args)), ...);
+        internal::SealBinaryTrace(workspace, size);
+
+        if constexpr (type == TraceType::kKernelLog) {
+            internal::CommitToLog(size);
+        }
+
+        if constexpr (type == TraceType::kDebugOnly) {
+            internal::CommitToDebugLog(size);
+        }
+        return;
+    }
+
     /* Write kernel trace info */
     const int trace_info = internal::WriteTraceData(workspace, module, type);
     ASSERT_GE(trace_info, 0);
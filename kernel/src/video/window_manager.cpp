@@ -5,11 +5,17 @@
 #include "video/window_manager.hpp"
 
 #include <string.h>
+#include <algorithm.hpp>
+#include <mutex.hpp>
+#include <pixel_ops.hpp>
 #include <template/scope_guard.hpp>
 
 #include "hardware/core_local.hpp"
 #include "modules/memory.hpp"
 #include "modules/scheduling.hpp"
+#include "modules/timing.hpp"
+#include "scheduling/local_lock.hpp"
+#include "scheduling/thread.hpp"
 #include "trace_framework.hpp"
 
 namespace Video
@@ -17,9 +23,33 @@ namespace Video
 
 using namespace Mem;
 
+namespace
+{
+
+// Flags of the mapping created by Vmm::MapUserBackbuffer()
+constexpr VMemAreaFlags kBackbufferFlags{.readable = true, .writable = true, .executable = true};
+
+// Stores to VRAM are only ever streamed, so they are combined instead of cached
+constexpr VMemAreaFlags kScreenFlags{
+    .readable = true, .writable = true, .executable = false, .write_combining = true
+};
+
+}  // namespace
+
 void WindowManager::Init(Framebuffer &fb)
 {
     framebuffer_ = &fb;
+
+    using WaitQueueT = Sched::WaitQueue<Sched::Thread, Sched::kWaitQueueIntrusiveLevel>;
+
+    const auto wq = Mem::KNew<WaitQueueT>();
+    R_ASSERT_TRUE(wq.has_value(), "Failed to allocate compositor wait queue");
+    compositor_wq_ = wq.value();
+
+    const auto frame_wq = Mem::KNew<WaitQueueT>();
+    R_ASSERT_TRUE(frame_wq.has_value(), "Failed to allocate frame wait queue");
+    frame_wq_ = frame_wq.value();
+
     DEBUG_INFO_GENERAL("WindowManager Initialized.");
 }
 
@@ -50,11 +80,14 @@ std::expected<void *, Mem::MemError> WindowManager::CreateSession()
     RET_UNEXPECTED_IF_ERR(virt_res);
     VPtr<void> virt = *virt_res;
 
+    LocalCoreLock core_lock{};
+    std::lock_guard lock(lock_);
+
     // Store Session Metadata
-    GraphicSessionNode *node = RegisterGraphicsSession(pid, buffer);
+    GraphicSessionNode *node = RegisterGraphicsSession(pid, buffer, virt, proc->address_space);
 
     // Switch focus to new app immediately
-    SwitchSession(node);
+    Raise(node);
     DEBUG_INFO_GENERAL(
         "CreateSession: Switched to session (PID %llu). Active node is now %p", pid, active_session_
     );
@@ -69,6 +102,9 @@ void WindowManager::SwitchSession(GraphicSessionNode *node)
         return;
     }
 
+    LocalCoreLock core_lock{};
+    std::lock_guard lock(lock_);
+
     if (active_session_ == node) {
         return;
     }
@@ -77,62 +113,142 @@ void WindowManager::SwitchSession(GraphicSessionNode *node)
         "Switching Session: Old %p -> New %p (PID %llu)", active_session_, node,
         node->data.owner_pid
     );
-    active_session_ = node;
-    RefreshScreen();
+    Raise(node);
 }
 
 void WindowManager::SwitchToNextSession()
 {
+    LocalCoreLock core_lock{};
+    std::lock_guard lock(lock_);
+
     if (sessions_.Empty()) {
         return;
     }
 
     // If no active session, switch to the first one
     if (!active_session_) {
-        SwitchSession(sessions_.GetHead());
+        Raise(sessions_.GetHead());
         return;
     }
 
     // Use active_session_ node pointer directly for fast navigation
     if (active_session_->next) {
-        SwitchSession(active_session_->next);
-    } else {
+        Raise(active_session_->next);
+    } else if (active_session_ != sessions_.GetHead()) {
         // Wrap around to the first session
-        SwitchSession(sessions_.GetHead());
+        Raise(sessions_.GetHead());
     }
 }
 
 void WindowManager::ReleaseSession(Sched::Pid pid)
 {
-    for (auto it = sessions_.begin(); it != sessions_.end(); ++it) {
-        auto &session = *it;
-        if (session.owner_pid == pid) {
-            DEBUG_INFO_GENERAL("Releasing Session owned by PID %llu", pid);
-
-            auto *node = it.GetNode();
-
-            // If active, switch to next session
-            if (active_session_ == node) {
-                SwitchToNextSession();
-                // If we switched to ourselves (only session), clear active
-                if (active_session_ == node) {
-                    active_session_ = nullptr;
-                }
-            }
+    LocalCoreLock core_lock{};
+    std::lock_guard lock(lock_);
 
-            // Free backing store
-            auto &pmm = ::MemoryModule::Get().GetBuddyPmm();
-            pmm.Free(session.buffer_info.phys_buffer);
+    auto *node = FindSession(pid);
+    if (!node) {
+        return;
+    }
 
-            // Remove session from list
-            sessions_.Remove(node);
-            return;
-        }
+    DEBUG_INFO_GENERAL("Releasing Session owned by PID %llu", pid);
+    GraphicSession &session = node->data;
+
+    // The owner is exiting and its address space is destroyed right after, so its mapping is not
+    // moved. Taking the session off the list under the lock keeps the compositor from moving it.
+    session.mode = kGuiSessionBackbuffer;
+    if (direct_session_ == node) {
+        direct_session_ = nullptr;
+    }
+
+    // Whatever the session covered has to be composed again
+    QueueDamage(session.frame);
+
+    // Free backing store
+    auto &pmm = ::MemoryModule::Get().GetBuddyPmm();
+    pmm.Free(session.buffer_info.phys_buffer);
+
+    // Remove session from list
+    const bool was_active = active_session_ == node;
+    sessions_.Remove(node);
+
+    if (!was_active) {
+        UpdateLayout();
+        return;
+    }
+
+    // The session right below takes over
+    active_session_ = nullptr;
+    GraphicSessionNode *stack[kMaxSessions];
+    if (GetStack(stack) > 0) {
+        Raise(stack[0]);
+    } else {
+        UpdateLayout();
+    }
+}
+
+std::expected<void, Mem::MemError> WindowManager::SetSessionMode(
+    Sched::Pid pid, GuiSessionMode mode
+)
+{
+    RET_UNEXPECTED_IF(
+        mode != kGuiSessionBackbuffer && mode != kGuiSessionDirect, MemError::InvalidArgument
+    );
+
+    LocalCoreLock core_lock{};
+    std::lock_guard lock(lock_);
+
+    auto *node = FindSession(pid);
+    RET_UNEXPECTED_IF(!node, MemError::NotFound);
+
+    GraphicSession &session = node->data;
+    if (session.mode == mode) {
+        return {};
     }
+
+    // Sessions not on top of the whole screen stay on their backbuffer, the mapping moves once
+    // they are. The compositor moves it, like on layout changes.
+    session.mode     = mode;
+    mapping_pending_ = true;
+    SchedulingModule::Get().GetScheduler().ReleaseAll(compositor_wq_);
+    return {};
+}
+
+std::expected<void, Mem::MemError> WindowManager::SetSessionFrame(Sched::Pid pid, GuiRect &frame)
+{
+    ASSERT_NOT_NULL(framebuffer_);
+    const auto &screen = framebuffer_->GetSurface();
+    const u32 width    = screen.GetWidth();
+    const u32 height   = screen.GetHeight();
+
+    RET_UNEXPECTED_IF(frame.x >= width || frame.y >= height, MemError::InvalidArgument);
+    frame.width  = std::min(frame.width, width - frame.x);
+    frame.height = std::min(frame.height, height - frame.y);
+    RET_UNEXPECTED_IF(frame.width == 0 || frame.height == 0, MemError::InvalidArgument);
+
+    LocalCoreLock core_lock{};
+    std::lock_guard lock(lock_);
+
+    auto *node = FindSession(pid);
+    RET_UNEXPECTED_IF(!node, MemError::NotFound);
+
+    GraphicSession &session = node->data;
+    QueueDamage(session.frame);
+
+    session.frame = {
+        static_cast<i32>(frame.x), static_cast<i32>(frame.y), static_cast<i32>(frame.width),
+        static_cast<i32>(frame.height)
+    };
+    QueueDamage(session.frame);
+
+    UpdateLayout();
+    return {};
 }
 
 void WindowManager::SetFocus(Sched::Pid pid)
 {
+    LocalCoreLock core_lock{};
+    std::lock_guard lock(lock_);
+
     auto caller = hardware::GetRunningPid();
     for (auto &session : sessions_) {
         if (session.owner_pid == caller || session.focused_pid == caller) {
@@ -145,6 +261,9 @@ void WindowManager::SetFocus(Sched::Pid pid)
 
 Sched::Pid WindowManager::GetActiveSessionFocusedPid()
 {
+    LocalCoreLock core_lock{};
+    std::lock_guard lock(lock_);
+
     if (!active_session_) {
         return {0, 0};
     }
@@ -153,6 +272,9 @@ Sched::Pid WindowManager::GetActiveSessionFocusedPid()
 
 void WindowManager::ReleaseFocus(Sched::Pid pid)
 {
+    LocalCoreLock core_lock{};
+    std::lock_guard lock(lock_);
+
     for (auto &session : sessions_) {
         if (session.focused_pid == pid) {
             session.focused_pid = session.owner_pid;
@@ -164,32 +286,140 @@ void WindowManager::ReleaseFocus(Sched::Pid pid)
     }
 }
 
-void WindowManager::RefreshScreen()
+std::expected<GuiSessionVisibility, Mem::MemError> WindowManager::Blit(
+    Sched::Pid pid, std::span<const GuiRect> rects
+)
 {
-    if (!active_session_) {
-        return;
+    LocalCoreLock core_lock{};
+    std::lock_guard lock(lock_);
+
+    // Find if this PID owns a session
+    auto *node = FindSession(pid);
+    RET_UNEXPECTED_IF(!node, MemError::NotFound);
+
+    GraphicSession &session = node->data;
+    if (session.is_hidden) {
+        // The data is safely sitting in the backbuffer (RAM), ready to be composed once the
+        // session is uncovered
+        return kGuiSessionHidden;
+    }
+
+    // The previous frame did not make it to a present, this one replaces it
+    if (session.frame_pending) {
+        ++session.stats.dropped;
     }
+    session.frame_pending = true;
+    session.submit_ns     = TimingModule::Get().GetSystemTime().ReadLifeTimeNs();
 
-    // Restore User App
-    BlitSession(active_session_->data);
+    if (direct_session_ == node) {
+        // The owner draws straight to the screen
+        return kGuiSessionVisible;
+    }
+
+    const Graphics::Rect &frame = session.frame;
+    if (rects.empty()) {
+        QueueDamage(frame);
+        return kGuiSessionVisible;
+    }
+
+    const u32 width  = static_cast<u32>(frame.w);
+    const u32 height = static_cast<u32>(frame.h);
+    const Graphics::Rect bounds{0, 0, frame.w, frame.h};
+
+    for (const GuiRect &rect : rects) {
+        // Clamped before clipping, so the coordinate sums cannot overflow
+        const Graphics::Rect clamped{
+            static_cast<i32>(std::min(rect.x, width)), static_cast<i32>(std::min(rect.y, height)),
+            static_cast<i32>(std::min(rect.width, width)),
+            static_cast<i32>(std::min(rect.height, height))
+        };
+        const Graphics::Rect area = Graphics::Intersect(bounds, clamped);
+        QueueDamage({area.x + frame.x, area.y + frame.y, area.w, area.h});
+    }
+
+    return kGuiSessionVisible;
 }
 
-void WindowManager::Blit(Sched::Pid pid)
+std::expected<void, Mem::MemError> WindowManager::WaitFrame(Sched::Pid pid, GuiFrameStats &stats)
 {
-    // Find if this PID owns a session
+    auto &scheduler = SchedulingModule::Get().GetScheduler();
+
+    LocalCoreLock core_lock{};
+
+    u64 target_present;
+    {
+        std::lock_guard lock(lock_);
+
+        auto *node = FindSession(pid);
+        RET_UNEXPECTED_IF(!node, MemError::NotFound);
+
+        // Sessions out of sight do not need every refresh
+        u64 interval = 1;
+        if (node->data.is_hidden) {
+            interval = kHiddenFrameInterval;
+        } else if (node != active_session_) {
+            interval = kBackgroundFrameInterval;
+        }
+
+        target_present = present_count_ + interval;
+        ++frame_waiters_;
+        scheduler.ReleaseAll(compositor_wq_);
+    }
+
+    // A present missed between the check and the block is made up by the next one, the tick
+    // keeps running while there are frame waiters
+    while (present_count_ < target_present) {
+        scheduler.BlockOnWaitQueue(frame_wq_);
+    }
+
+    std::lock_guard lock(lock_);
+    --frame_waiters_;
+
     auto *node = FindSession(pid);
+    RET_UNEXPECTED_IF(!node, MemError::NotFound);
 
-    if (!node) {
-        return;
+    stats = node->data.stats;
+    return {};
+}
+
+void WindowManager::CompositorWork()
+{
+    auto &scheduler   = SchedulingModule::Get().GetScheduler();
+    auto &system_time = TimingModule::Get().GetSystemTime();
+
+    {
+        LocalCoreLock core_lock{};
+        if (pending_damage_.IsEmpty() && frame_waiters_ == 0 && !mapping_pending_) {
+            scheduler.BlockOnWaitQueue(compositor_wq_);
+        }
     }
 
-    if (active_session_ != node) {
-        // If not active, the data is safely sitting in the session.phys_buffer (RAM),
-        // ready to be restored when the user switches back.
-        return;
+    {
+        LocalCoreLock core_lock{};
+        std::lock_guard lock(lock_);
+
+        // The screen is damaged by the switch, it is presented below
+        if (mapping_pending_) {
+            mapping_pending_ = false;
+
+            // On failure the session is already back on its backbuffer
+            [[maybe_unused]] const auto map_res = UpdateDirectMapping();
+        }
     }
 
-    BlitSession(node->data);
+    // Present on the refresh tick, blits landing until then join the same frame
+    const u64 now = system_time.ReadLifeTimeNs();
+    scheduler.NanoSleepUntil((now / kRefreshPeriodNs + 1) * kRefreshPeriodNs);
+
+    LocalCoreLock core_lock{};
+    std::lock_guard lock(lock_);
+
+    Compose(pending_damage_);
+    pending_damage_.Clear();
+
+    UpdateFrameStats(system_time.ReadLifeTimeNs());
+    ++present_count_;
+    scheduler.ReleaseAll(frame_wq_);
 }
 
 std::expected<BufferInfo, Mem::MemError> WindowManager::AllocUserBuffer()
@@ -206,13 +436,18 @@ std::expected<BufferInfo, Mem::MemError> WindowManager::AllocUserBuffer()
     return BufferInfo{.phys_buffer = *phys_res, .size_bytes = buffer_size};
 }
 
-GraphicSessionNode *WindowManager::RegisterGraphicsSession(Sched::Pid pid, BufferInfo buffer)
+GraphicSessionNode *WindowManager::RegisterGraphicsSession(
+    Sched::Pid pid, BufferInfo buffer, VPtr<void> user_buffer, VPtr<AddressSpace> address_space
+)
 {
     GraphicSession session;
-    session.owner_pid   = pid;
-    session.focused_pid = pid;
-    session.buffer_info = buffer;
-    session.is_active   = false;
+    session.owner_pid     = pid;
+    session.focused_pid   = pid;
+    session.buffer_info   = buffer;
+    session.is_active     = false;
+    session.frame         = GetScreenRect();
+    session.user_buffer   = user_buffer;
+    session.address_space = address_space;
 
     auto *node = sessions_.PushBack(session);
     ASSERT_NOT_NULL(node);
@@ -221,6 +456,232 @@ GraphicSessionNode *WindowManager::RegisterGraphicsSession(Sched::Pid pid, Buffe
     return node;
 }
 
+Graphics::Rect WindowManager::GetScreenRect() const
+{
+    ASSERT_NOT_NULL(framebuffer_);
+    const auto &screen = framebuffer_->GetSurface();
+    return {0, 0, static_cast<i32>(screen.GetWidth()), static_cast<i32>(screen.GetHeight())};
+}
+
+void WindowManager::Raise(GraphicSessionNode *node)
+{
+    node->data.z    = ++last_z_;
+    active_session_ = node;
+
+    // Nothing covers the session anymore
+    QueueDamage(node->data.frame);
+    UpdateLayout();
+}
+
+void WindowManager::UpdateLayout()
+{
+    GraphicSessionNode *stack[kMaxSessions];
+    const size_t count = GetStack(stack);
+
+    for (size_t i = 0; i < count; ++i) {
+        GraphicSession &session = stack[i]->data;
+
+        const bool hidden = IsCovered(session.frame, stack, i);
+        if (hidden != session.is_hidden) {
+            DEBUG_INFO_GENERAL(
+                "WindowManager: Session of PID %llu is %s", session.owner_pid,
+                hidden ? "hidden" : "shown"
+            );
+            session.is_hidden = hidden;
+        }
+    }
+
+    // Moving the mapping copies a whole frame and edits the page tables of the owner, the
+    // compositor does it, as the layout also changes from the keyboard interrupt
+    mapping_pending_ = true;
+    SchedulingModule::Get().GetScheduler().ReleaseAll(compositor_wq_);
+}
+
+std::expected<void, Mem::MemError> WindowManager::UpdateDirectMapping()
+{
+    // Only the session on top of the whole screen may draw straight to it
+    GraphicSessionNode *target = nullptr;
+    if (active_session_ && active_session_->data.mode == kGuiSessionDirect &&
+        Graphics::Contains(active_session_->data.frame, GetScreenRect())) {
+        target = active_session_;
+    }
+
+    if (direct_session_ == target) {
+        return {};
+    }
+
+    if (direct_session_) {
+        MapToBackbuffer(direct_session_->data);
+        direct_session_ = nullptr;
+
+        // The compositor did not touch the screen in the meantime
+        QueueDamage(GetScreenRect());
+    }
+
+    if (!target) {
+        return {};
+    }
+
+    // The screen may lag behind the backbuffer until the owner blits
+    BlitSession(target->data);
+
+    const auto map_res = MapToScreen(target->data);
+    if (!map_res) {
+        // Keep the owner on its backbuffer, its blits reach the screen as usual
+        target->data.mode = kGuiSessionBackbuffer;
+        return std::unexpected(map_res.error());
+    }
+
+    direct_session_ = target;
+    return {};
+}
+
+size_t WindowManager::GetStack(GraphicSessionNode *(&stack)[kMaxSessions])
+{
+    // Insertion sort, top-most first
+    size_t count = 0;
+    for (auto it = sessions_.begin(); it != sessions_.end(); ++it) {
+        size_t pos = count++;
+        while (pos > 0 && stack[pos - 1]->data.z < it->z) {
+            stack[pos] = stack[pos - 1];
+            --pos;
+        }
+        stack[pos] = it.GetNode();
+    }
+    return count;
+}
+
+bool WindowManager::IsCovered(
+    const Graphics::Rect &frame, GraphicSessionNode *const *above, const size_t count
+)
+{
+    // Parts of the frame left uncovered, too many of them are treated as visible
+    static constexpr size_t kMaxPieces = 32;
+    Graphics::Rect pieces[kMaxPieces];
+    Graphics::Rect next[kMaxPieces];
+
+    pieces[0]          = frame;
+    size_t piece_count = 1;
+
+    for (size_t i = 0; i < count && piece_count > 0; ++i) {
+        size_t next_count = 0;
+        for (size_t p = 0; p < piece_count; ++p) {
+            Graphics::Rect parts[4];
+            const size_t part_count = Graphics::Subtract(pieces[p], above[i]->data.frame, parts);
+            if (next_count + part_count > kMaxPieces) {
+                return false;
+            }
+
+            for (size_t k = 0; k < part_count; ++k) {
+                next[next_count++] = parts[k];
+            }
+        }
+
+        for (size_t p = 0; p < next_count; ++p) {
+            pieces[p] = next[p];
+        }
+        piece_count = next_count;
+    }
+
+    return piece_count == 0;
+}
+
+void WindowManager::QueueDamage(const Graphics::Rect &rect)
+{
+    if (Graphics::IsEmpty(rect)) {
+        return;
+    }
+
+    pending_damage_.Add(rect);
+    SchedulingModule::Get().GetScheduler().ReleaseAll(compositor_wq_);
+}
+
+void WindowManager::Compose(const Graphics::DamageList &damage)
+{
+    if (direct_session_) {
+        // The owner draws straight to the screen
+        return;
+    }
+
+    GraphicSessionNode *stack[kMaxSessions];
+    const size_t count = GetStack(stack);
+
+    for (const Graphics::Rect &rect : damage.GetRects()) {
+        // Nothing below the top-most session covering the whole area can be seen
+        size_t bottom = 0;
+        while (bottom < count && !Graphics::Contains(stack[bottom]->data.frame, rect)) {
+            ++bottom;
+        }
+
+        if (bottom == count) {
+            ComposeBackground(rect);
+        } else {
+            ++bottom;
+        }
+
+        for (size_t i = bottom; i-- > 0;) {
+            if (!stack[i]->data.is_hidden) {
+                ComposeSession(stack[i]->data, rect);
+            }
+        }
+    }
+}
+
+void WindowManager::ComposeSession(const GraphicSession &session, const Graphics::Rect &rect)
+{
+    const Graphics::Rect &frame = session.frame;
+    const Graphics::Rect area   = Graphics::Intersect(rect, frame);
+    if (Graphics::IsEmpty(area)) {
+        return;
+    }
+
+    // The backbuffer shares the pitch of VRAM, its top left part is shown in the frame
+    auto &screen = framebuffer_->GetSurface();
+    const Graphics::Surface backbuffer(
+        reinterpret_cast<Graphics::NativePixel *>(Mem::PhysToVirt(session.buffer_info.phys_buffer)),
+        static_cast<u32>(frame.w), static_cast<u32>(frame.h), screen.GetPitch()
+    );
+
+    Graphics::CopyRect(
+        screen, {area.x, area.y}, backbuffer,
+        {area.x - frame.x, area.y - frame.y, area.w, area.h}
+    );
+}
+
+void WindowManager::ComposeBackground(const Graphics::Rect &rect)
+{
+    auto &screen = framebuffer_->GetSurface();
+    for (i32 y = rect.y; y < rect.y + rect.h; ++y) {
+        Graphics::FillPixels(
+            screen.GetScanline(static_cast<u32>(y))
+                .subspan(static_cast<size_t>(rect.x), static_cast<size_t>(rect.w)),
+            Graphics::NativePixel(0)
+        );
+    }
+}
+
+void WindowManager::UpdateFrameStats(const u64 present_ns)
+{
+    for (auto &session : sessions_) {
+        if (!session.frame_pending) {
+            continue;
+        }
+        session.frame_pending = false;
+
+        // Covered between the blit and the present
+        if (session.is_hidden) {
+            ++session.stats.dropped;
+            continue;
+        }
+
+        const u64 latency = present_ns - session.submit_ns;
+        ++session.stats.presented;
+        session.stats.last_latency_ns = latency;
+        session.stats.max_latency_ns  = std::max(session.stats.max_latency_ns, latency);
+        session.stats.present_time_ns = present_ns;
+    }
+}
+
 void WindowManager::BlitSession(const GraphicSession &session)
 {
     ASSERT_NOT_NULL(framebuffer_);
@@ -231,6 +692,38 @@ void WindowManager::BlitSession(const GraphicSession &session)
     memcpy(vram_dst, backbuffer_src, session.buffer_info.size_bytes);
 }
 
+std::expected<void, Mem::MemError> WindowManager::MapToScreen(GraphicSession &session)
+{
+    ASSERT_NOT_NULL(framebuffer_);
+
+    return ::MemoryModule::Get().GetVmm().RetargetUserShared(
+        session.address_space, session.user_buffer, framebuffer_->GetPhysAddress(), kScreenFlags
+    );
+}
+
+void WindowManager::MapToBackbuffer(GraphicSession &session)
+{
+    ASSERT_NOT_NULL(framebuffer_);
+
+    // Stores of the owner landing between the copy and the remap are lost, they are redrawn with
+    // its next frame
+    const VPtr<void> vram_src = framebuffer_->GetSurface().GetRawBuffer();
+    VPtr<void> backbuffer_dst = Mem::PhysToVirt(session.buffer_info.phys_buffer);
+    memcpy(backbuffer_dst, vram_src, session.buffer_info.size_bytes);
+
+    // Fails only if the owner unmapped the buffer, then there is nothing to move
+    const auto map_res = ::MemoryModule::Get().GetVmm().RetargetUserShared(
+        session.address_space, session.user_buffer, session.buffer_info.phys_buffer,
+        kBackbufferFlags
+    );
+    if (!map_res) {
+        DEBUG_WARN_GENERAL(
+            "WindowManager: Failed to move the buffer of PID %llu off the screen",
+            session.owner_pid
+        );
+    }
+}
+
 GraphicSessionNode *WindowManager::FindSession(Sched::Pid pid)
 {
     for (auto it = sessions_.begin(); it != sessions_.end(); ++it) {
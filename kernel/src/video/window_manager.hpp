@@ -5,15 +5,30 @@
 #ifndef KERNEL_SRC_VIDEO_WINDOW_MANAGER_HPP_
 #define KERNEL_SRC_VIDEO_WINDOW_MANAGER_HPP_
 
+#include <alkos/video.h>
 #include <types.h>
+#include <damage.hpp>
 #include <data_structures/linked_list.hpp>
 #include <expected.hpp>
+#include <geometry.hpp>
+#include <span.hpp>
 
 #include "drivers/video/framebuffer.hpp"
 #include "mem/error.hpp"
 #include "mem/page.hpp"
 #include "mem/types.hpp"
+#include "mem/virt/addr_space.hpp"
 #include "scheduling/process.hpp"
+#include "scheduling/wait_queue.hpp"
+#include "sync/spinlock.hpp"
+
+namespace Sched
+{
+struct Thread;
+}  // namespace Sched
+
+// Forward declaration for test access (test class is in global namespace)
+class WindowManagerTest;
 
 namespace Video
 {
@@ -33,14 +48,48 @@ struct GraphicSession {
     Sched::Pid focused_pid;
     bool is_active = false;
 
+    /// Area of the screen showing the session, the top left part of the buffer of the same size
+    /// is shown there
+    Graphics::Rect frame{};
+    /// Stacking order, higher is closer to the viewer
+    u64 z = 0;
+    /// Fully covered by the sessions above, its blits do not reach the screen
+    bool is_hidden = false;
+
+    /// A blit waits for the next present
+    bool frame_pending = false;
+    /// System lifetime of the last blit
+    u64 submit_ns = 0;
+    GuiFrameStats stats{};
+
     /// The backing store (Physical RAM)
     /// Kernel accesses this via Mem::PhysToVirt to copy to VRAM
     BufferInfo buffer_info;
+
+    /// Where the owner sees the buffer. In direct mode the mapping is moved between VRAM
+    /// (while active and covering the whole screen) and the backing store
+    Mem::VPtr<void> user_buffer;
+    Mem::VPtr<Mem::AddressSpace> address_space;
+    GuiSessionMode mode = kGuiSessionBackbuffer;
 };
 
+/**
+ * @brief Stacks the graphic sessions on the screen. Every session owns a frame on the screen
+ * and a place in the z-order, the most recently switched to one is on top and gets the input.
+ * Blits only record damage, a kernel worker composes the damaged areas from the backbuffers of
+ * the sessions bottom to top once per refresh tick. Sessions fully covered by the ones above
+ * are skipped.
+ */
 class WindowManager
 {
     public:
+    /// Period of the display refresh tick, everything blitted within it is presented together
+    static constexpr u64 kRefreshPeriodNs = 1'000'000'000 / 60;
+    /// Refreshes a session below the top one waits for in WaitFrame()
+    static constexpr u64 kBackgroundFrameInterval = 4;
+    /// Refreshes a hidden session waits for in WaitFrame()
+    static constexpr u64 kHiddenFrameInterval = 30;
+
     WindowManager() = default;
 
     void Init(Framebuffer &fb);
@@ -48,11 +97,24 @@ class WindowManager
     /// Called by Syscall: Allocates a buffer, maps it to user, registers session
     std::expected<void *, Mem::MemError> CreateSession();
 
-    /// Called by Syscall: If the caller is the active session, copy buffer to VRAM
-    void Blit(Sched::Pid pid);
+    /// Called by Syscall: Records the damaged areas of the caller's buffer for the compositor.
+    /// Rectangles must be in kernel memory, none damages the whole frame
+    std::expected<GuiSessionVisibility, Mem::MemError> Blit(
+        Sched::Pid pid, std::span<const GuiRect> rects = {}
+    );
+
+    /// Called by Syscall: Changes where the buffer of the caller's session lives. The compositor
+    /// moves the mapping, a session it fails to map to the screen stays on its backbuffer
+    std::expected<void, Mem::MemError> SetSessionMode(Sched::Pid pid, GuiSessionMode mode);
 
-    /// Switches screen to a specific session
+    /// Called by Syscall: Moves the caller's session, the frame is clipped to the screen and
+    /// updated to the area actually used
+    std::expected<void, Mem::MemError> SetSessionFrame(Sched::Pid pid, GuiRect &frame);
+
+    /// Raises a specific session to the top of the screen
     void SwitchSession(GraphicSessionNode *node);
+    /// Called from the keyboard interrupt, only the z-order changes there and the compositor
+    /// moves the direct mapping afterwards
     void SwitchToNextSession();
     void ReleaseSession(Sched::Pid pid);
 
@@ -60,18 +122,67 @@ class WindowManager
     void ReleaseFocus(Sched::Pid pid);
     Sched::Pid GetActiveSessionFocusedPid();
 
+    /// Called by Syscall: Blocks until the next present slot of the caller's session and
+    /// reports its frame statistics
+    std::expected<void, Mem::MemError> WaitFrame(Sched::Pid pid, GuiFrameStats &stats);
+
+    /// Body of the compositor worker, waits for damage, frame waiters or a layout change, moves
+    /// the direct mapping and presents on the next refresh tick
+    void CompositorWork();
+
     private:
+    static constexpr size_t kMaxSessions = 12;
+
     std::expected<BufferInfo, Mem::MemError> AllocUserBuffer();
-    GraphicSessionNode *RegisterGraphicsSession(Sched::Pid pid, BufferInfo buffer);
-    void BlitSession(const GraphicSession &session);
+    GraphicSessionNode *RegisterGraphicsSession(
+        Sched::Pid pid, BufferInfo buffer, Mem::VPtr<void> user_buffer,
+        Mem::VPtr<Mem::AddressSpace> address_space
+    );
     GraphicSessionNode *FindSession(Sched::Pid pid);
-    void RefreshScreen();
+    NODISCARD Graphics::Rect GetScreenRect() const;
+
+    // The methods below expect lock_ to be held
+
+    void Raise(GraphicSessionNode *node);
+    void UpdateLayout();
+    std::expected<void, Mem::MemError> UpdateDirectMapping();
+    size_t GetStack(GraphicSessionNode *(&stack)[kMaxSessions]);
+    static bool IsCovered(
+        const Graphics::Rect &frame, GraphicSessionNode *const *above, size_t count
+    );
+
+    void QueueDamage(const Graphics::Rect &rect);
+    void Compose(const Graphics::DamageList &damage);
+    void ComposeSession(const GraphicSession &session, const Graphics::Rect &rect);
+    void ComposeBackground(const Graphics::Rect &rect);
+    void UpdateFrameStats(u64 present_ns);
+
+    void BlitSession(const GraphicSession &session);
+    std::expected<void, Mem::MemError> MapToScreen(GraphicSession &session);
+    void MapToBackbuffer(GraphicSession &session);
 
-    static constexpr size_t kMaxSessions = 12;
     data_structures::StaticDoubleLinkedList<GraphicSession, kMaxSessions> sessions_;
 
     GraphicSessionNode *active_session_{nullptr};
+    /// Session in direct mode whose buffer is mapped to VRAM
+    GraphicSessionNode *direct_session_{nullptr};
     Framebuffer *framebuffer_{nullptr};
+    u64 last_z_{0};
+
+    /// Screen areas waiting for the compositor
+    Graphics::DamageList pending_damage_;
+    /// The layout changed, the compositor moves the direct mapping to the new top session
+    bool mapping_pending_{false};
+    Sched::WaitQueue<Sched::Thread, 3> *compositor_wq_{nullptr};
+
+    /// Threads in WaitFrame(), the refresh tick keeps running while there are any
+    size_t frame_waiters_{0};
+    u64 present_count_{0};
+    Sched::WaitQueue<Sched::Thread, 3> *frame_wq_{nullptr};
+    Spinlock lock_;
+
+    /// Friends
+    friend ::WindowManagerTest;
 };
 
 }  // namespace Video
@@ -208,6 +208,31 @@ TEST_F(AtomicCyclicBufferTest, WriteMove_GivenFullBuffer_DoesNotMoveSourceData)
     EXPECT_TRUE(extra[0].IsValid());  // Should NOT be moved
 }
 
+TEST_F(AtomicCyclicBufferTest, WriteMove_GivenWrappedIndexScenario_PreservesOrder)
+{
+    AtomicCyclicBuffer<MoveTracker, 4> move_buf;
+
+    // Advance indices so that the next write wraps [gap, gap, gap, 3]
+    std::array<MoveTracker, 4> filler;
+    for (int i = 0; i < 4; ++i) filler[i] = MoveTracker(i);
+    move_buf.Write(std::span<MoveTracker>(filler));
+
+    std::array<MoveTracker, 3> garbage;
+    move_buf.Read(std::span<MoveTracker>(garbage));
+
+    std::array<MoveTracker, 3> inputs;
+    for (int i = 0; i < 3; ++i) inputs[i] = MoveTracker(10 + i);
+    EXPECT_EQ(3_size, move_buf.Write(std::span<MoveTracker>(inputs)));
+
+    std::array<MoveTracker, 4> outputs;
+    EXPECT_EQ(4_size, move_buf.Read(std::span<MoveTracker>(outputs)));
+
+    EXPECT_EQ(3, outputs[0].id);
+    EXPECT_EQ(10, outputs[1].id);
+    EXPECT_EQ(11, outputs[2].id);
+    EXPECT_EQ(12, outputs[3].id);
+}
+
 // --------------------------------------------------------------------------------
 // Read Tests
 // --------------------------------------------------------------------------------
@@ -246,6 +271,37 @@ TEST_F(AtomicCyclicBufferTest, Read_GivenRequestLargerThanCount_ReadsAvailableOn
     EXPECT_EQ(3, out[2]);
 }
 
+TEST_F(AtomicCyclicBufferTest, Peek_GivenWrappedData_ReturnsRunUpToBufferEnd)
+{
+    std::array<int, kSize> data;
+    for (size_t i = 0; i < kSize; ++i) data[i] = i;
+    buffer_int.Write(std::span<const int>(data));
+
+    std::array<int, 12> garbage;
+    buffer_int.Read(std::span<int>(garbage));
+
+    std::array<int, 2> new_data = {100, 101};
+    buffer_int.Write(std::span<const int>(new_data));
+
+    // Readable [12...15, 100, 101], the first run ends at the end of the storage
+    auto run = buffer_int.Peek();
+    EXPECT_EQ(4_size, run.size());
+    EXPECT_EQ(12, run[0]);
+    EXPECT_EQ(15, run[3]);
+    EXPECT_EQ(6_size, buffer_int.Count());
+
+    buffer_int.Consume(run.size());
+
+    run = buffer_int.Peek();
+    EXPECT_EQ(2_size, run.size());
+    EXPECT_EQ(100, run[0]);
+    EXPECT_EQ(101, run[1]);
+
+    buffer_int.Consume(run.size());
+    EXPECT_TRUE(buffer_int.IsEmpty());
+    EXPECT_TRUE(buffer_int.Peek().empty());
+}
+
 // --------------------------------------------------------------------------------
 // State Transition & Edge Cases
 // --------------------------------------------------------------------------------
@@ -0,0 +1,96 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025-2026 The AlkOS Authors
+// See the AUTHORS file for the full list of contributors.
+
+#include <damage.hpp>
+#include <test_module/test.hpp>
+
+using namespace Graphics;
+
+class DamageListTest : public TestGroupBase
+{
+    protected:
+    static void ExpectRect(const Rect &rect, i32 x, i32 y, i32 w, i32 h)
+    {
+        EXPECT_EQ(x, rect.x);
+        EXPECT_EQ(y, rect.y);
+        EXPECT_EQ(w, rect.w);
+        EXPECT_EQ(h, rect.h);
+    }
+};
+
+TEST_F(DamageListTest, EmptyRectIsIgnored)
+{
+    DamageList damage;
+    damage.Add({10, 10, 0, 5});
+    damage.Add({10, 10, 5, -1});
+
+    EXPECT_TRUE(damage.IsEmpty());
+}
+
+TEST_F(DamageListTest, DisjointRectsAreKept)
+{
+    DamageList damage;
+    damage.Add({0, 0, 8, 8});
+    damage.Add({8, 0, 8, 8});
+
+    R_ASSERT_EQ(2_size, damage.GetRects().size());
+    ExpectRect(damage.GetRects()[0], 0, 0, 8, 8);
+    ExpectRect(damage.GetRects()[1], 8, 0, 8, 8);
+}
+
+TEST_F(DamageListTest, ContainedRectIsDropped)
+{
+    DamageList damage;
+    damage.Add({0, 0, 16, 16});
+    damage.Add({4, 4, 1, 1});
+
+    R_ASSERT_EQ(1_size, damage.GetRects().size());
+    ExpectRect(damage.GetRects()[0], 0, 0, 16, 16);
+}
+
+TEST_F(DamageListTest, OverlappingRectsAreMerged)
+{
+    DamageList damage;
+    damage.Add({0, 0, 10, 10});
+    damage.Add({5, 5, 10, 10});
+
+    R_ASSERT_EQ(1_size, damage.GetRects().size());
+    ExpectRect(damage.GetRects()[0], 0, 0, 15, 15);
+}
+
+TEST_F(DamageListTest, MergeCascadesOverGrownUnion)
+{
+    DamageList damage;
+    damage.Add({0, 0, 4, 4});
+    damage.Add({10, 0, 4, 4});
+
+    // Overlaps only the first one, the union then reaches the second
+    damage.Add({2, 0, 9, 2});
+
+    R_ASSERT_EQ(1_size, damage.GetRects().size());
+    ExpectRect(damage.GetRects()[0], 0, 0, 14, 4);
+}
+
+TEST_F(DamageListTest, FullListCollapsesIntoBoundingBox)
+{
+    DamageList damage;
+    for (size_t i = 0; i < DamageList::kCapacity; ++i) {
+        damage.Add({static_cast<i32>(i * 2), 0, 1, 1});
+    }
+    R_ASSERT_EQ(DamageList::kCapacity, damage.GetRects().size());
+
+    damage.Add({0, 10, 1, 1});
+
+    R_ASSERT_EQ(1_size, damage.GetRects().size());
+    ExpectRect(damage.GetRects()[0], 0, 0, static_cast<i32>(DamageList::kCapacity * 2 - 1), 11);
+}
+
+TEST_F(DamageListTest, ClearEmptiesList)
+{
+    DamageList damage;
+    damage.Add({0, 0, 1, 1});
+    damage.Clear();
+
+    EXPECT_TRUE(damage.IsEmpty());
+}
@@ -0,0 +1,59 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025-2026 The AlkOS Authors
+// See the AUTHORS file for the full list of contributors.
+
+#include <geometry.hpp>
+#include <test_module/test.hpp>
+
+using namespace Graphics;
+
+class GeometryTest : public TestGroupBase
+{
+    protected:
+    static void ExpectRect(const Rect &rect, i32 x, i32 y, i32 w, i32 h)
+    {
+        EXPECT_EQ(x, rect.x);
+        EXPECT_EQ(y, rect.y);
+        EXPECT_EQ(w, rect.w);
+        EXPECT_EQ(h, rect.h);
+    }
+};
+
+TEST_F(GeometryTest, SubtractDisjointKeepsRect)
+{
+    Rect out[4];
+    const size_t count = Subtract({0, 0, 8, 8}, {8, 0, 8, 8}, out);
+
+    R_ASSERT_EQ(1_size, count);
+    ExpectRect(out[0], 0, 0, 8, 8);
+}
+
+TEST_F(GeometryTest, SubtractCoveringRectLeavesNothing)
+{
+    Rect out[4];
+
+    EXPECT_EQ(0_size, Subtract({2, 2, 4, 4}, {0, 0, 8, 8}, out));
+    EXPECT_EQ(0_size, Subtract({2, 2, 0, 4}, {20, 20, 8, 8}, out));
+}
+
+TEST_F(GeometryTest, SubtractHoleLeavesFourBands)
+{
+    Rect out[4];
+    const size_t count = Subtract({0, 0, 10, 10}, {2, 3, 4, 5}, out);
+
+    R_ASSERT_EQ(4_size, count);
+    ExpectRect(out[0], 0, 0, 10, 3);
+    ExpectRect(out[1], 0, 8, 10, 2);
+    ExpectRect(out[2], 0, 3, 2, 5);
+    ExpectRect(out[3], 6, 3, 4, 5);
+}
+
+TEST_F(GeometryTest, SubtractCornerLeavesTwoPieces)
+{
+    Rect out[4];
+    const size_t count = Subtract({0, 0, 10, 10}, {5, 5, 10, 10}, out);
+
+    R_ASSERT_EQ(2_size, count);
+    ExpectRect(out[0], 0, 0, 10, 5);
+    ExpectRect(out[1], 0, 5, 5, 5);
+}
@@ -0,0 +1,99 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025-2026 The AlkOS Authors
+// See the AUTHORS file for the full list of contributors.
+
+#include <fonts/drdos8x8.hpp>
+#include <glyph_atlas.hpp>
+#include <test_module/test.hpp>
+
+using namespace Graphics;
+
+class GlyphAtlasTest : public TestGroupBase
+{
+    protected:
+    static constexpr PixelFormat kFormat{16, 8, 8, 8, 0, 8};
+    static constexpr u8 kScale = 2;
+    static constexpr size_t kStoragePixels =
+        GlyphAtlas::kMaxGlyphs * 8 * 8 * static_cast<size_t>(kScale * kScale);
+
+    static constexpr u32 kFg = 0x00FF0000;
+    static constexpr u32 kBg = 0x000000FF;
+
+    /// Compare the tile with the font bitmap, every bit has to cover a scale x scale block
+    void ExpectTileMatchesFont(GlyphAtlas &atlas, char c, u32 fg, u32 bg)
+    {
+        const Rect tile   = atlas.GetTile(c);
+        const Glyph glyph = font_.GetGlyph(c);
+
+        for (u32 y = 0; y < static_cast<u32>(tile.h); ++y) {
+            const auto row = atlas.GetSurface().GetScanline(static_cast<u32>(tile.y) + y);
+            for (u32 x = 0; x < static_cast<u32>(tile.w); ++x) {
+                const u32 col  = x / kScale;
+                const bool set = (glyph.buffer[(y / kScale) * glyph.stride + (col >> 3)] &
+                                  (1 << (7 - (col & 7)))) != 0;
+                EXPECT_EQ(set ? fg : bg, row[x].value);
+            }
+        }
+    }
+
+    Psf2Font font_{drdos8x8_psfu};
+
+    // Too big for the test stack
+    static NativePixel storage_[kStoragePixels];
+};
+
+NativePixel GlyphAtlasTest::storage_[kStoragePixels];
+
+TEST_F(GlyphAtlasTest, RequiredPixelsCoverEveryGlyph)
+{
+    EXPECT_EQ(kStoragePixels, GlyphAtlas::GetRequiredPixels(font_, kScale));
+}
+
+TEST_F(GlyphAtlasTest, EmptyStorageIsInvalid)
+{
+    GlyphAtlas atlas(font_, kFormat, kScale, {});
+
+    EXPECT_FALSE(atlas.IsValid());
+}
+
+TEST_F(GlyphAtlasTest, TileIsScaledGlyph)
+{
+    GlyphAtlas atlas(font_, kFormat, kScale, storage_);
+    atlas.SetColors(Color::Red(), Color::Blue());
+
+    const Rect tile = atlas.GetTile('A');
+    EXPECT_EQ(0, tile.x);
+    EXPECT_EQ(static_cast<i32>('A' * 8 * kScale), tile.y);
+    EXPECT_EQ(static_cast<i32>(8 * kScale), tile.w);
+    EXPECT_EQ(static_cast<i32>(8 * kScale), tile.h);
+
+    ExpectTileMatchesFont(atlas, 'A', kFg, kBg);
+}
+
+TEST_F(GlyphAtlasTest, SetColorsRasterizesAgain)
+{
+    GlyphAtlas atlas(font_, kFormat, kScale, storage_);
+    atlas.SetColors(Color::Red(), Color::Blue());
+    ExpectTileMatchesFont(atlas, 'x', kFg, kBg);
+
+    atlas.SetColors(Color::Blue(), Color::Red());
+    ExpectTileMatchesFont(atlas, 'x', kBg, kFg);
+}
+
+TEST_F(GlyphAtlasTest, SetColorsKeepsTilesOfOtherGlyphs)
+{
+    GlyphAtlas atlas(font_, kFormat, kScale, storage_);
+    atlas.SetColors(Color::Red(), Color::Blue());
+    const Rect tile = atlas.GetTile('x');
+
+    // Drawing another glyph in other colors must not rasterize 'x' again, the marker survives
+    atlas.SetColors(Color::Blue(), Color::Red());
+    ExpectTileMatchesFont(atlas, 'y', kBg, kFg);
+
+    // The atlas is a single column of tiles, the first pixel of 'x' is its tile.y row start
+    storage_[static_cast<size_t>(tile.y) * static_cast<size_t>(tile.w)] = {0x00123456};
+
+    atlas.SetColors(Color::Red(), Color::Blue());
+    EXPECT_EQ(tile.y, atlas.GetTile('x').y);
+    EXPECT_EQ(0x00123456_u32, atlas.GetSurface().GetScanline(static_cast<u32>(tile.y))[0].value);
+}
@@ -0,0 +1,79 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025-2026 The AlkOS Authors
+// See the AUTHORS file for the full list of contributors.
+
+#include <test_module/test.hpp>
+
+#include <drivers/input/event_queue.hpp>
+
+using namespace Drivers::Input;
+
+class InputEventQueueTest : public TestGroupBase
+{
+    protected:
+    static InputEvent MakeEvent(const VirtualKey key, const bool pressed)
+    {
+        return {.time_ns = 0, .key = key, .pressed = pressed, .modifiers = {}};
+    }
+
+    /// The queue only starts collecting events after the first read
+    void StartReading() { EXPECT_EQ(0_size, queue_.Read({}, 0)); }
+
+    EventQueue queue_{};
+};
+
+TEST_F(InputEventQueueTest, EventsBeforeFirstReadAreDropped)
+{
+    queue_.Push(MakeEvent(VK_A, true));
+
+    InputEvent events[4];
+    EXPECT_EQ(0_size, queue_.Read(events, 0));
+    EXPECT_FALSE(queue_.HasEvents());
+}
+
+TEST_F(InputEventQueueTest, ReadDrainsInOrder)
+{
+    StartReading();
+
+    queue_.Push(MakeEvent(VK_A, true));
+    queue_.Push(MakeEvent(VK_B, true));
+    queue_.Push(MakeEvent(VK_A, false));
+    EXPECT_TRUE(queue_.HasEvents());
+
+    InputEvent events[4];
+    R_ASSERT_EQ(3_size, queue_.Read(events, 0));
+    EXPECT_EQ(VK_A, events[0].key);
+    EXPECT_TRUE(events[0].pressed);
+    EXPECT_EQ(VK_B, events[1].key);
+    EXPECT_EQ(VK_A, events[2].key);
+    EXPECT_FALSE(events[2].pressed);
+    EXPECT_FALSE(queue_.HasEvents());
+}
+
+TEST_F(InputEventQueueTest, PartialReadsKeepTheRest)
+{
+    StartReading();
+
+    queue_.Push(MakeEvent(VK_Key1, true));
+    queue_.Push(MakeEvent(VK_Key2, true));
+
+    InputEvent event;
+    R_ASSERT_EQ(1_size, queue_.Read({&event, 1}, 0));
+    EXPECT_EQ(VK_Key1, event.key);
+    R_ASSERT_EQ(1_size, queue_.Read({&event, 1}, 0));
+    EXPECT_EQ(VK_Key2, event.key);
+}
+
+TEST_F(InputEventQueueTest, FullQueueDropsNewEvents)
+{
+    StartReading();
+
+    for (size_t i = 0; i < EventQueue::kCapacity; ++i) {
+        queue_.Push(MakeEvent(VK_Space, true));
+    }
+    queue_.Push(MakeEvent(VK_Enter, true));
+
+    InputEvent events[EventQueue::kCapacity + 1];
+    R_ASSERT_EQ(EventQueue::kCapacity, queue_.Read(events, 0));
+    EXPECT_EQ(VK_Space, events[EventQueue::kCapacity - 1].key);
+}
@@ -0,0 +1,102 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025-2026 The AlkOS Authors
+// See the AUTHORS file for the full list of contributors.
+
+#include <test_module/test.hpp>
+
+#include <string.h>
+#include <syscalls/ring.hpp>
+
+using namespace Syscall;
+
+class IoRingTest : public TestGroupBase
+{
+    protected:
+    void Setup_() override { memset(&ring_, 0, sizeof(ring_)); }
+
+    void Submit(const u32 op, const u64 user_data)
+    {
+        ring_.sq[ring_.sq_tail & (kRingSqEntries - 1)] = {.op = op, .user_data = user_data};
+        ++ring_.sq_tail;
+    }
+
+    // Too big for the test stack
+    static IoRing ring_;
+};
+
+IoRing IoRingTest::ring_;
+
+TEST_F(IoRingTest, ProcessRing_GivenNops_CompletesThemInOrder)
+{
+    for (u64 i = 0; i < 3; ++i) {
+        Submit(kRingOpNop, 100 + i);
+    }
+
+    const auto done = ProcessRing(ring_, kRingSqEntries);
+    R_ASSERT_TRUE(done.has_value());
+    EXPECT_EQ(3_size, *done);
+    EXPECT_EQ(3_u32, ring_.sq_head);
+    EXPECT_EQ(3_u32, ring_.cq_tail);
+
+    for (u32 i = 0; i < 3; ++i) {
+        EXPECT_EQ(100 + static_cast<u64>(i), ring_.cq[i].user_data);
+        EXPECT_EQ(0_i64, ring_.cq[i].result);
+    }
+}
+
+TEST_F(IoRingTest, ProcessRing_GivenCount_LeavesTheRestQueued)
+{
+    for (u64 i = 0; i < 3; ++i) {
+        Submit(kRingOpNop, i);
+    }
+
+    const auto done = ProcessRing(ring_, 2);
+    R_ASSERT_TRUE(done.has_value());
+    EXPECT_EQ(2_size, *done);
+    EXPECT_EQ(2_u32, ring_.sq_head);
+
+    const auto rest = ProcessRing(ring_, kRingSqEntries);
+    R_ASSERT_TRUE(rest.has_value());
+    EXPECT_EQ(1_size, *rest);
+    EXPECT_EQ(2_u64, ring_.cq[2].user_data);
+}
+
+TEST_F(IoRingTest, ProcessRing_GivenUnknownOp_FailsOnlyThatSubmission)
+{
+    Submit(0xFFFF, 1);
+    Submit(kRingOpNop, 2);
+
+    const auto done = ProcessRing(ring_, kRingSqEntries);
+    R_ASSERT_TRUE(done.has_value());
+    EXPECT_EQ(2_size, *done);
+    EXPECT_TRUE(ring_.cq[0].result < 0);
+    EXPECT_EQ(0_i64, ring_.cq[1].result);
+}
+
+TEST_F(IoRingTest, ProcessRing_GivenFullCompletionQueue_Stops)
+{
+    ring_.cq_tail = kRingCqEntries;
+    Submit(kRingOpNop, 1);
+
+    const auto blocked = ProcessRing(ring_, kRingSqEntries);
+    R_ASSERT_TRUE(blocked.has_value());
+    EXPECT_EQ(0_size, *blocked);
+    EXPECT_EQ(0_u32, ring_.sq_head);
+
+    // Reaping a single completion makes room for the submission
+    ring_.cq_head = 1;
+    const auto done = ProcessRing(ring_, kRingSqEntries);
+    R_ASSERT_TRUE(done.has_value());
+    EXPECT_EQ(1_size, *done);
+}
+
+TEST_F(IoRingTest, ProcessRing_GivenCorruptedIndices_Refuses)
+{
+    ring_.sq_head = 0;
+    ring_.sq_tail = kRingSqEntries + 1;
+
+    const auto done = ProcessRing(ring_, kRingSqEntries);
+    R_ASSERT_FALSE(done.has_value());
+    EXPECT_EQ(Mem::MemError::InvalidArgument, done.error());
+    EXPECT_EQ(0_u32, ring_.cq_tail);
+}
@@ -126,3 +126,138 @@ TEST_F(MemTest, MemcpyTest)
     );
     R_ASSERT_ZERO(memcmp(big_mem_chunk, expected, kMemChunkSize));
 }
+
+// ------------------------------
+// Size tier tests
+// ------------------------------
+
+class MemTierTest : public TestGroupBase
+{
+    protected:
+    /* Covers the small, block loop and rep string tiers */
+    static constexpr size_t kBufferSize = 4096;
+    static constexpr size_t kMaxOffset  = 8;
+    static constexpr size_t kSizes[]    = {0,  1,  3,   7,   8,   9,   16,   17,   31,   32,
+                                           33, 64, 65, 255, 256, 257, 2047, 2048, 2049, 3000};
+
+    static byte buffer_[kBufferSize];
+    static byte expected_[kBufferSize];
+
+    void FillPattern()
+    {
+        for (size_t i = 0; i < kBufferSize; ++i) {
+            buffer_[i]   = static_cast<byte>(i * 7 + 3);
+            expected_[i] = buffer_[i];
+        }
+    }
+
+    static void ReferenceMove(byte *dest, const byte *src, const size_t n)
+    {
+        if (dest > src) {
+            for (size_t i = n; i > 0; --i) {
+                dest[i - 1] = src[i - 1];
+            }
+        } else {
+            for (size_t i = 0; i < n; ++i) {
+                dest[i] = src[i];
+            }
+        }
+    }
+
+    bool BuffersMatch() const
+    {
+        for (size_t i = 0; i < kBufferSize; ++i) {
+            if (buffer_[i] != expected_[i]) {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+byte MemTierTest::buffer_[kBufferSize];
+byte MemTierTest::expected_[kBufferSize];
+
+TEST_F(MemTierTest, MemcpyAllTiersAndAlignments)
+{
+    for (const size_t n : kSizes) {
+        for (size_t offset = 0; offset < kMaxOffset; ++offset) {
+            if (2 * (n + offset) > kBufferSize) {
+                continue;
+            }
+
+            FillPattern();
+            byte *dest      = buffer_ + offset;
+            const byte *src = buffer_ + kBufferSize - n - offset;
+
+            ReferenceMove(expected_ + offset, expected_ + kBufferSize - n - offset, n);
+            R_ASSERT_EQ(dest, static_cast<byte *>(memcpy(dest, src, n)));
+            R_ASSERT_TRUE(BuffersMatch());
+        }
+    }
+}
+
+TEST_F(MemTierTest, MemmoveOverlapAllTiers)
+{
+    static constexpr size_t kShifts[] = {1, 3, 8, 31, 33, 100};
+
+    for (const size_t n : kSizes) {
+        for (const size_t shift : kShifts) {
+            if (n + shift + kMaxOffset > kBufferSize) {
+                continue;
+            }
+
+            /* Forward overlap, dest below src */
+            FillPattern();
+            ReferenceMove(expected_ + 1, expected_ + 1 + shift, n);
+            memmove(buffer_ + 1, buffer_ + 1 + shift, n);
+            R_ASSERT_TRUE(BuffersMatch());
+
+            /* Backward overlap, dest above src */
+            FillPattern();
+            ReferenceMove(expected_ + 3 + shift, expected_ + 3, n);
+            memmove(buffer_ + 3 + shift, buffer_ + 3, n);
+            R_ASSERT_TRUE(BuffersMatch());
+        }
+    }
+}
+
+TEST_F(MemTierTest, MemsetAllTiersAndAlignments)
+{
+    for (const size_t n : kSizes) {
+        for (size_t offset = 0; offset < kMaxOffset; ++offset) {
+            if (n + offset > kBufferSize) {
+                continue;
+            }
+
+            FillPattern();
+            for (size_t i = 0; i < n; ++i) {
+                expected_[offset + i] = 0xA5;
+            }
+            R_ASSERT_EQ(buffer_ + offset, static_cast<byte *>(memset(buffer_ + offset, 0xA5, n)));
+            R_ASSERT_TRUE(BuffersMatch());
+        }
+    }
+}
+
+TEST_F(MemTierTest, MemcmpFindsFirstDifference)
+{
+    for (const size_t n : kSizes) {
+        if (n == 0 || 2 * n > kBufferSize) {
+            continue;
+        }
+
+        FillPattern();
+        memcpy(buffer_ + n, buffer_, n);
+        R_ASSERT_ZERO(memcmp(buffer_, buffer_ + n, n));
+
+        /* Only the first difference decides, later ones point the other way */
+        const size_t first = n / 2;
+        buffer_[n + first] = static_cast<byte>(buffer_[first] + 1);
+        if (first + 1 < n) {
+            buffer_[n + first + 1] = static_cast<byte>(buffer_[first + 1] - 1);
+        }
+        R_ASSERT_LT(memcmp(buffer_, buffer_ + n, n), 0);
+        R_ASSERT_GT(memcmp(buffer_ + n, buffer_, n), 0);
+    }
+}
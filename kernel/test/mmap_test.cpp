@@ -0,0 +1,285 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025-2026 The AlkOS Authors
+// See the AUTHORS file for the full list of contributors.
+
+#include <test_module/test.hpp>
+
+#include <string.h>
+#include <fs/vfs/fat/fat12.hpp>
+#include <fs/vfs/io/in_memory.hpp>
+#include <fs/vfs/path.hpp>
+#include <hal/constants.hpp>
+#include <mem/virt/area.hpp>
+#include <mem/heap.hpp>
+#include <memory.hpp>
+#include <modules/memory.hpp>
+#include <modules/vfs.hpp>
+#include <syscalls/calls/mem.hpp>
+#include <vfs.hpp>
+
+using namespace Mem;
+
+class MmapFat12ImageHelper
+{
+    public:
+    static constexpr size_t kSectorSize        = 512;
+    static constexpr size_t kSectorsPerCluster = 1;
+    static constexpr size_t kReservedSectors   = 1;
+    static constexpr size_t kNumberOfFats      = 2;
+    static constexpr size_t kRootDirEntries    = 16;
+    static constexpr size_t kFatSizeSectors    = 1;
+    static constexpr size_t kTotalSectors      = 64;
+
+    static constexpr size_t kFatRegionStart = kReservedSectors;
+    static constexpr size_t kRootDirStart   = kReservedSectors + kNumberOfFats * kFatSizeSectors;
+    static constexpr size_t kRootDirSectors =
+        (kRootDirEntries * 32 + kSectorSize - 1) / kSectorSize;
+    static constexpr size_t kDataRegionStart = kRootDirStart + kRootDirSectors;
+    static constexpr size_t kImageSize       = kTotalSectors * kSectorSize;
+
+    static void CreateMinimalImage(byte *image)
+    {
+        memset(image, 0, kImageSize);
+        CreateBootSector(image);
+        CreateFatTables(image);
+        CreateRootDirectory(image);
+    }
+
+    private:
+    static void CreateBootSector(byte *image)
+    {
+        image[0] = 0xEB;
+        image[1] = 0x3C;
+        image[2] = 0x90;
+        memcpy(image + 3, "MSDOS5.0", 8);
+        *reinterpret_cast<u16 *>(image + 11) = kSectorSize;
+        image[13]                            = kSectorsPerCluster;
+        *reinterpret_cast<u16 *>(image + 14) = kReservedSectors;
+        image[16]                            = kNumberOfFats;
+        *reinterpret_cast<u16 *>(image + 17) = kRootDirEntries;
+        *reinterpret_cast<u16 *>(image + 19) = kTotalSectors;
+        image[21]                            = 0xF8;
+        *reinterpret_cast<u16 *>(image + 22) = kFatSizeSectors;
+        *reinterpret_cast<u16 *>(image + 24) = 18;
+        *reinterpret_cast<u16 *>(image + 26) = 2;
+        *reinterpret_cast<u32 *>(image + 28) = 0;
+        *reinterpret_cast<u32 *>(image + 32) = 0;
+        image[36]                            = 0x80;
+        image[38]                            = 0x29;
+        *reinterpret_cast<u32 *>(image + 39) = 0x12345678;
+        memcpy(image + 43, "TEST VOLUME", 11);
+        memcpy(image + 54, "FAT12   ", 8);
+        image[510] = 0x55;
+        image[511] = 0xAA;
+    }
+
+    static void CreateFatTables(byte *image)
+    {
+        byte *fat1 = image + kFatRegionStart * kSectorSize;
+        memset(fat1, 0, kFatSizeSectors * kSectorSize);
+        fat1[0]    = 0xF8;
+        fat1[1]    = 0xFF;
+        fat1[2]    = 0xFF;
+        byte *fat2 = image + (kFatRegionStart + kFatSizeSectors) * kSectorSize;
+        memcpy(fat2, fat1, kFatSizeSectors * kSectorSize);
+    }
+
+    static void CreateRootDirectory(byte *image)
+    {
+        byte *root_dir = image + kRootDirStart * kSectorSize;
+        memset(root_dir, 0, kRootDirSectors * kSectorSize);
+        memcpy(root_dir, "TEST VOLUME", 11);
+        root_dir[11] = 0x08;
+    }
+};
+
+class MmapTest : public TestGroupBase
+{
+    protected:
+    static constexpr size_t kPage      = hal::kPageSizeBytes;
+    static constexpr size_t kFileSize  = 2 * kPage;
+    static constexpr const char *kFile = "/MAP.BIN";
+
+    // Free ranges of the kernel address space standing in for the mappings of a process
+    static constexpr u64 kAnonAddr = 0xABCD0000;
+    static constexpr u64 kFileAddr = 0xABCE0000;
+
+    alignas(16) byte disk_image_[MmapFat12ImageHelper::kImageSize];
+    vfs::io::InMemory *io_{nullptr};
+    vfs::Fat12<vfs::io::InMemory> *fat12_{nullptr};
+
+    // Every page holds different bytes, so a page read from the wrong offset shows up
+    static byte Pattern(const size_t offset) { return static_cast<byte>(offset % 251); }
+
+    void Setup_() override
+    {
+        MmapFat12ImageHelper::CreateMinimalImage(disk_image_);
+
+        io_ = Mem::KMalloc<vfs::io::InMemory>().value_or(nullptr);
+        R_ASSERT_NOT_NULL(io_);
+        std::construct_at<vfs::io::InMemory>(io_, disk_image_, MmapFat12ImageHelper::kSectorSize);
+
+        fat12_ = Mem::KMalloc<vfs::Fat12<vfs::io::InMemory>>().value_or(nullptr);
+        R_ASSERT_NOT_NULL(fat12_);
+        std::construct_at<vfs::Fat12<vfs::io::InMemory>>(fat12_, *io_);
+
+        vfs::Unmount(vfs::Path("/"));
+        R_ASSERT_TRUE(vfs::Mount(vfs::Path("/"), {}, fat12_->GetFilesystem()).has_value());
+        R_ASSERT_TRUE(vfs::CreateFile(vfs::Path(kFile)).has_value());
+
+        auto data = Mem::KMalloc(kFileSize);
+        R_ASSERT_TRUE(data.has_value());
+        auto *bytes = static_cast<byte *>(*data);
+        for (size_t i = 0; i < kFileSize; ++i) {
+            bytes[i] = Pattern(i);
+        }
+
+        const auto written = vfs::WriteFile(vfs::Path(kFile), bytes, kFileSize);
+        Mem::KFree(*data);
+        R_ASSERT_TRUE(written.has_value());
+        R_ASSERT_EQ(kFileSize, *written);
+    }
+
+    void TearDown_() override
+    {
+        vfs::Unmount(vfs::Path("/"));
+
+        std::destroy_at(fat12_);
+        Mem::KFree(fat12_);
+
+        std::destroy_at(io_);
+        Mem::KFree(io_);
+    }
+
+    // The mapping keeps its own reference, the returned one has to be dropped before TearDown_
+    static data_structures::RefPtr<Fs::File> OpenFile()
+    {
+        auto file = VfsModule::Get().GetFdManager().GetFileTable().GetOrCreate(vfs::Path(kFile));
+        R_ASSERT_TRUE(file.has_value());
+        return std::move(*file);
+    }
+
+    /// Private read-only mapping of the whole file, as mmap would create it
+    static VPtr<byte> MapFile(Fs::File &file)
+    {
+        auto vma_res = Mem::KNew<FileBackedVMemArea>(
+            UptrToPtr<void>(kFileAddr), kFileSize,
+            VirtualMemAreaFlags{.readable = true, .writable = false, .executable = false}, file,
+            0, false
+        );
+        R_ASSERT_TRUE(vma_res.has_value());
+        (*vma_res)->SetOrigin(VMemAreaOrigin::kMmap);
+
+        auto add_res = MemoryModule::Get().GetVmm().AddArea(
+            &MemoryModule::Get().GetKernelAddressSpace(), *vma_res
+        );
+        R_ASSERT_TRUE(add_res.has_value());
+        return UptrToPtr<byte>(kFileAddr);
+    }
+
+    static void Unmap(VPtr<void> start)
+    {
+        auto rm_res = MemoryModule::Get().GetVmm().RmArea(
+            &MemoryModule::Get().GetKernelAddressSpace(), start
+        );
+        R_ASSERT_TRUE(rm_res.has_value());
+    }
+};
+
+// ------------------------------
+// Area bounds
+// ------------------------------
+
+TEST_F(MmapTest, UnmapUserArea_GivenInteriorAddress_KeepsArea)
+{
+    auto &vmm       = MemoryModule::Get().GetVmm();
+    auto &kernel_as = MemoryModule::Get().GetKernelAddressSpace();
+
+    auto start = vmm.AllocAnonymous(
+        &kernel_as, 2 * kPage, {.readable = true, .writable = true, .executable = false},
+        UptrToPtr<void>(kAnonAddr), UptrToPtr<void>(kAnonAddr + 2 * kPage), VMemAreaOrigin::kMmap
+    );
+    R_ASSERT_TRUE(start.has_value());
+    auto *interior = static_cast<VPtr<byte>>(*start) + kPage;
+
+    const auto unmapped = vmm.UnmapUserArea(&kernel_as, interior);
+    R_ASSERT_FALSE(unmapped.has_value());
+    EXPECT_EQ(MemError::InvalidArgument, unmapped.error());
+
+    const auto protected_res = vmm.ProtectArea(&kernel_as, interior, true, false, false);
+    R_ASSERT_FALSE(protected_res.has_value());
+    EXPECT_EQ(MemError::InvalidArgument, protected_res.error());
+
+    // The area is still whole and writable
+    *interior = static_cast<byte>(0x5A);
+    EXPECT_EQ(static_cast<byte>(0x5A), *interior);
+
+    EXPECT_TRUE(vmm.UnmapUserArea(&kernel_as, *start).has_value());
+}
+
+TEST_F(MmapTest, Mmap_GivenLengthBeyondUserSpace_Refuses)
+{
+    static constexpr size_t kHuge = static_cast<size_t>(-1);
+
+    const auto anon = Syscall::SysMmapAnon(kHuge, kMemProtRead);
+    R_ASSERT_FALSE(anon.has_value());
+    EXPECT_EQ(MemError::InvalidArgument, anon.error());
+
+    const auto file = Syscall::SysMmap(0, 0, kHuge, kMemProtRead, kMemMapPrivate);
+    R_ASSERT_FALSE(file.has_value());
+    EXPECT_EQ(MemError::InvalidArgument, file.error());
+}
+
+// ------------------------------
+// File mappings
+// ------------------------------
+
+TEST_F(MmapTest, FileMapping_WhenRead_FaultsInFilePages)
+{
+    auto file       = OpenFile();
+    auto *mapping   = MapFile(*file);
+    bool pages_same = true;
+
+    for (size_t i = 0; i < kFileSize; ++i) {
+        pages_same &= mapping[i] == Pattern(i);
+    }
+    EXPECT_TRUE(pages_same);
+
+    Unmap(mapping);
+}
+
+TEST_F(MmapTest, PageCacheWrite_GivenMappingOfSameFile_CopiesPages)
+{
+    auto &cache   = VfsModule::Get().GetPageCache();
+    auto file     = OpenFile();
+    auto *mapping = MapFile(*file);
+
+    // The source pages are faulted in by the copy itself, whole pages and a partial one
+    const auto whole = cache.Write(*file, std::span(mapping + kPage, kPage), 0, false);
+    R_ASSERT_TRUE(whole.has_value());
+    EXPECT_EQ(kPage, *whole);
+
+    const auto partial = cache.Write(*file, std::span(mapping + kPage, 16), kPage + 8, false);
+    R_ASSERT_TRUE(partial.has_value());
+    EXPECT_EQ(16_size, *partial);
+
+    auto read_buf = Mem::KMalloc(kFileSize);
+    R_ASSERT_TRUE(read_buf.has_value());
+    auto *bytes = static_cast<byte *>(*read_buf);
+
+    const auto read = cache.Read(*file, std::span(bytes, kFileSize), 0);
+    R_ASSERT_TRUE(read.has_value());
+    EXPECT_EQ(kFileSize, *read);
+
+    bool pages_same = true;
+    for (size_t i = 0; i < kPage; ++i) {
+        pages_same &= bytes[i] == Pattern(kPage + i);
+    }
+    for (size_t i = 0; i < 16; ++i) {
+        pages_same &= bytes[kPage + 8 + i] == Pattern(kPage + i);
+    }
+    EXPECT_TRUE(pages_same);
+
+    Mem::KFree(*read_buf);
+    Unmap(mapping);
+}
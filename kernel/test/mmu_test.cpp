@@ -108,6 +108,7 @@ class MmuTest : public TestGroupBase
         .UserAccessible = false,
         .WriteThrough   = false,
         .CacheDisable   = false,
+        .WriteCombining = false,
         .Global         = true,
         .NoExecute      = false,
     };
@@ -263,6 +264,46 @@ TEST_F(MmuTest, Translate_GivenUnmappedPage_ReturnsError)
     EXPECT_FALSE(result.has_value());
 }
 
+// ------------------------------
+// Huge Page Tests
+// ------------------------------
+
+TEST_F(MmuTest, SplitHugePages_GivenGigabytePage_KeepsTranslationAndAllowsPageFlags)
+{
+    // Given: a 1 GiB page in a page directory pointer table created by Map()
+    auto root = reinterpret_cast<Mem::PPtr<void>>(pml4_phys_);
+    mmu_.Map(
+        *ctx_, root, reinterpret_cast<VPtr<void>>(0x1000), reinterpret_cast<PPtr<void>>(0x2000),
+        kDefaultFlags
+    );
+
+    auto *pml4 = reinterpret_cast<PageMapTable<4> *>(pml4_virt_);
+    auto *pdpt =
+        reinterpret_cast<PageMapTable<3> *>(Mem::PhysToVirt((*pml4)[0].GetNextLevelTable()));
+    reinterpret_cast<PageMapEntry<3, kHugePage> &>((*pdpt)[1]).SetFrameAddress(
+        reinterpret_cast<PPtr<void>>(0x80000000), kPresentBit | kWriteBit
+    );
+
+    VPtr<void> vaddr = reinterpret_cast<VPtr<void>>(0x40203000);
+    EXPECT_FALSE(mmu_.SetPageFlags(root, vaddr, kDefaultFlags).has_value());
+
+    // When
+    auto result = mmu_.SplitHugePages(*ctx_, root, vaddr);
+
+    // Then
+    EXPECT_TRUE(result.has_value());
+
+    auto trans_res = mmu_.Translate(*ctx_, root, vaddr);
+    EXPECT_TRUE(trans_res.has_value());
+    EXPECT_EQ(reinterpret_cast<PPtr<void>>(0x80203000), trans_res.value());
+
+    auto other_res = mmu_.Translate(*ctx_, root, reinterpret_cast<VPtr<void>>(0x7FFFF000));
+    EXPECT_TRUE(other_res.has_value());
+    EXPECT_EQ(reinterpret_cast<PPtr<void>>(0xBFFFF000), other_res.value());
+
+    EXPECT_TRUE(mmu_.SetPageFlags(root, vaddr, kDefaultFlags).has_value());
+}
+
 // ------------------------------
 // Control Register Tests
 // ------------------------------
@@ -0,0 +1,130 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025-2026 The AlkOS Authors
+// See the AUTHORS file for the full list of contributors.
+
+#include <pixel_ops.hpp>
+#include <test_module/test.hpp>
+
+using namespace Graphics;
+
+class PixelOpsTest : public TestGroupBase
+{
+    protected:
+    static constexpr u32 kWidth  = 8;
+    static constexpr u32 kHeight = 6;
+
+    void Setup_() override
+    {
+        for (u32 i = 0; i < kWidth * kHeight; ++i) {
+            pixels_[i] = NativePixel(i);
+        }
+    }
+
+    NODISCARD Surface MakeSurface() { return {pixels_, kWidth, kHeight, kWidth * 4}; }
+
+    NODISCARD u32 At(u32 x, u32 y) const { return pixels_[y * kWidth + x].value; }
+
+    NativePixel pixels_[kWidth * kHeight];
+};
+
+TEST_F(PixelOpsTest, FillPixelsWritesOnlyTheSpan)
+{
+    FillPixels({pixels_ + 1, 5}, NativePixel(0x00123456));
+
+    EXPECT_EQ(0_u32, At(0, 0));
+    for (u32 x = 1; x < 6; ++x) {
+        EXPECT_EQ(0x00123456_u32, At(x, 0));
+    }
+    EXPECT_EQ(6_u32, At(6, 0));
+}
+
+TEST_F(PixelOpsTest, FillPixelsRepeatingByte)
+{
+    FillPixels({pixels_, 3}, NativePixel(0xABABABAB));
+
+    EXPECT_EQ(0xABABABAB_u32, At(2, 0));
+    EXPECT_EQ(3_u32, At(3, 0));
+}
+
+TEST_F(PixelOpsTest, BlendPixelsWeightsChannels)
+{
+    NativePixel dest[3] = {
+        NativePixel(0x00000000), NativePixel(0x00000000), NativePixel(0x10FF80FF)
+    };
+    const NativePixel src[3] = {
+        NativePixel(0xFFFFFFFF), NativePixel(0xFF804000), NativePixel(0x00000000)
+    };
+
+    BlendPixels({dest, 1}, {src, 1}, 255);
+    BlendPixels({dest + 1, 1}, {src + 1, 1}, 0);
+    BlendPixels({dest + 2, 1}, {src + 2, 1}, 128);
+
+    EXPECT_EQ(0xFFFFFFFF_u32, dest[0].value);
+    EXPECT_EQ(0x00000000_u32, dest[1].value);
+    EXPECT_EQ(0x087F407F_u32, dest[2].value);
+}
+
+TEST_F(PixelOpsTest, CopyRectClipsToBothSurfaces)
+{
+    NativePixel other[4 * 4];
+    for (u32 i = 0; i < 4 * 4; ++i) {
+        other[i] = NativePixel(100 + i);
+    }
+    Surface src(other, 4, 4, 4 * 4);
+    Surface dest = MakeSurface();
+
+    // One column is cut on the left of the source, one row on the bottom of dest
+    const Rect area = CopyRect(dest, {5, 3}, src, {-1, 0, 4, 4});
+
+    EXPECT_EQ(6, area.x);
+    EXPECT_EQ(3, area.y);
+    EXPECT_EQ(2, area.w);
+    EXPECT_EQ(3, area.h);
+    EXPECT_EQ(100_u32, At(6, 3));
+    EXPECT_EQ(109_u32, At(7, 5));
+    EXPECT_EQ(5 * kWidth + 5, At(5, 5));
+}
+
+TEST_F(PixelOpsTest, CopyRectMovesOverlappingRowsDown)
+{
+    Surface surface = MakeSurface();
+
+    CopyRect(surface, {1, 2}, surface, {0, 0, 4, 4});
+
+    for (u32 y = 0; y < 4; ++y) {
+        for (u32 x = 0; x < 4; ++x) {
+            EXPECT_EQ(y * kWidth + x, At(x + 1, y + 2));
+        }
+    }
+    EXPECT_EQ(2 * kWidth, At(0, 2));
+}
+
+TEST_F(PixelOpsTest, CopyRectOutsideSurfaceIsEmpty)
+{
+    Surface surface = MakeSurface();
+
+    const Rect area = CopyRect(surface, {static_cast<i32>(kWidth), 0}, surface, {0, 0, 2, 2});
+
+    EXPECT_TRUE(Graphics::IsEmpty(area));
+    EXPECT_EQ(0_u32, At(0, 0));
+}
+
+TEST_F(PixelOpsTest, ExpandIndexedScalesBlocks)
+{
+    NativePixel palette[256];
+    for (u32 i = 0; i < 256; ++i) {
+        palette[i] = NativePixel(0x1000 + i);
+    }
+    const u8 image[2 * 2] = {1, 2, 3, 4};
+    Surface surface       = MakeSurface();
+
+    ExpandIndexed(surface, {1, 1}, image, 2, 2, 2, palette, 2);
+
+    EXPECT_EQ(0x1001_u32, At(1, 1));
+    EXPECT_EQ(0x1001_u32, At(2, 2));
+    EXPECT_EQ(0x1002_u32, At(3, 1));
+    EXPECT_EQ(0x1003_u32, At(1, 3));
+    EXPECT_EQ(0x1004_u32, At(4, 4));
+    EXPECT_EQ(5 * kWidth + 5, At(5, 5));
+    EXPECT_EQ(kWidth, At(0, 1));
+}
@@ -0,0 +1,91 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025-2026 The AlkOS Authors
+// See the AUTHORS file for the full list of contributors.
+
+#include <test_module/test.hpp>
+
+#include <hal/constants.hpp>
+#include <mem/heap.hpp>
+#include <mem/virt/area.hpp>
+#include <modules/memory.hpp>
+#include <scheduling/process.hpp>
+#include <syscalls/stats.hpp>
+
+using namespace Mem;
+
+class SyscallTraceTest : public TestGroupBase
+{
+    protected:
+    // A single mapped page standing in for the tracer's buffer, nothing is mapped after it
+    static constexpr u64 kPageAddr    = 0xABCE0000;
+    static constexpr size_t kRecords  = 4;
+    static constexpr size_t kPageRecs = hal::kPageSizeBytes / sizeof(SyscallTraceRecord);
+
+    void Setup_() override
+    {
+        Mem::VirtualMemAreaFlags flags{.readable = true, .writable = true, .executable = false};
+        auto vma_res = Mem::KNew<Mem::AnonymousVMemArea>(
+            UptrToPtr<void>(kPageAddr), hal::kPageSizeBytes, flags
+        );
+        R_ASSERT_TRUE(vma_res.has_value());
+
+        auto add_res = MemoryModule::Get().GetVmm().AddArea(
+            &MemoryModule::Get().GetKernelAddressSpace(), *vma_res
+        );
+        R_ASSERT_TRUE(add_res.has_value());
+
+        auto process_res = Mem::KNew<Sched::Process>();
+        R_ASSERT_TRUE(process_res.has_value());
+        process_ = *process_res;
+        R_ASSERT_TRUE(Syscall::StartSyscallTrace(*process_).has_value());
+
+        for (u32 i = 0; i < kRecords; ++i) {
+            process_->syscall_trace->Push({.number = i});
+        }
+    }
+
+    void TearDown_() override
+    {
+        Syscall::StopSyscallTrace(*process_);
+        Mem::KDelete(process_);
+
+        auto rm_res = MemoryModule::Get().GetVmm().RmArea(
+            &MemoryModule::Get().GetKernelAddressSpace(), UptrToPtr<void>(kPageAddr)
+        );
+        R_ASSERT_TRUE(rm_res.has_value());
+    }
+
+    Sched::Process *process_{nullptr};
+};
+
+TEST_F(SyscallTraceTest, ReadSyscallTrace_GivenMappedBuffer_ConsumesRecordsInOrder)
+{
+    auto *records = UptrToPtr<SyscallTraceRecord>(kPageAddr);
+
+    const auto read = Syscall::ReadSyscallTrace(*process_, std::span(records, kRecords));
+    R_ASSERT_TRUE(read.has_value());
+    EXPECT_EQ(kRecords, *read);
+    for (u32 i = 0; i < kRecords; ++i) {
+        EXPECT_EQ(i, records[i].number);
+    }
+
+    const auto again = Syscall::ReadSyscallTrace(*process_, std::span(records, kRecords));
+    R_ASSERT_TRUE(again.has_value());
+    EXPECT_EQ(0_size, *again);
+}
+
+TEST_F(SyscallTraceTest, ReadSyscallTrace_GivenFaultingBuffer_KeepsRecords)
+{
+    // The buffer starts on the last record slot of the page and runs into the unmapped one
+    auto *tail = UptrToPtr<SyscallTraceRecord>(kPageAddr) + (kPageRecs - 1);
+
+    const auto failed = Syscall::ReadSyscallTrace(*process_, std::span(tail, kRecords));
+    EXPECT_FALSE(failed.has_value());
+
+    auto *records   = UptrToPtr<SyscallTraceRecord>(kPageAddr);
+    const auto read = Syscall::ReadSyscallTrace(*process_, std::span(records, kRecords));
+    R_ASSERT_TRUE(read.has_value());
+    EXPECT_EQ(kRecords, *read);
+    EXPECT_EQ(0_u32, records[0].number);
+    EXPECT_EQ(static_cast<u32>(kRecords - 1), records[kRecords - 1].number);
+}
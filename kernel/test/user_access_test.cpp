@@ -0,0 +1,125 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025-2026 The AlkOS Authors
+// See the AUTHORS file for the full list of contributors.
+
+#include <test_module/test.hpp>
+
+#include <string.h>
+
+#include <hal/constants.hpp>
+#include <mem/virt/addr_space.hpp>
+#include <mem/virt/area.hpp>
+#include <mem/virt/user_access.hpp>
+#include <modules/memory.hpp>
+
+using namespace Mem;
+
+class UserAccessTest : public TestGroupBase
+{
+    protected:
+    // A single mapped page with nothing mapped after it
+    static constexpr u64 kPageAddr = 0xABCD0000;
+
+    void Setup_() override
+    {
+        Mem::VirtualMemAreaFlags flags{.readable = true, .writable = true, .executable = false};
+        auto vma_res = Mem::KNew<Mem::AnonymousVMemArea>(
+            UptrToPtr<void>(kPageAddr), hal::kPageSizeBytes, flags
+        );
+        R_ASSERT_TRUE(vma_res.has_value());
+
+        auto add_res = MemoryModule::Get().GetVmm().AddArea(
+            &MemoryModule::Get().GetKernelAddressSpace(), *vma_res
+        );
+        R_ASSERT_TRUE(add_res.has_value());
+    }
+
+    void TearDown_() override
+    {
+        auto rm_res = MemoryModule::Get().GetVmm().RmArea(
+            &MemoryModule::Get().GetKernelAddressSpace(), UptrToPtr<void>(kPageAddr)
+        );
+        R_ASSERT_TRUE(rm_res.has_value());
+    }
+};
+
+TEST_F(UserAccessTest, IsUserRange_GivenRangeCrossingIntoKernelSpace_ReturnsFalse)
+{
+    EXPECT_TRUE(IsUserRange(kUserSpaceEndExclusive - 16, 16));
+    EXPECT_FALSE(IsUserRange(kUserSpaceEndExclusive - 16, 17));
+    EXPECT_FALSE(IsUserRange(kKernelSpaceStart, 1));
+    EXPECT_FALSE(IsUserRange(u64{1}, std::numeric_limits<u64>::max()));
+}
+
+TEST_F(UserAccessTest, CopyToUserAndBack_GivenMappedPage_CopiesData)
+{
+    const u64 value = 0xDEADBEEFCAFEBABE;
+    auto *user_ptr  = UptrToPtr<u64>(kPageAddr + 8);
+
+    EXPECT_TRUE(CopyToUser(user_ptr, value).has_value());
+
+    u64 read_back = 0;
+    EXPECT_TRUE(CopyFromUser(read_back, user_ptr).has_value());
+    EXPECT_EQ(value, read_back);
+}
+
+TEST_F(UserAccessTest, CopyFromUser_GivenUnmappedPage_FailsInsteadOfPanicking)
+{
+    byte buffer[32];
+    const auto *user_ptr = UptrToPtr<const byte>(kPageAddr + hal::kPageSizeBytes - 16);
+
+    const auto result = CopyFromUser(buffer, user_ptr, sizeof(buffer));
+    EXPECT_FALSE(result.has_value());
+    EXPECT_EQ(MemError::BadAddress, result.error());
+}
+
+TEST_F(UserAccessTest, CopyStringFromUser_GivenTerminatedString_ReturnsLength)
+{
+    // The string ends right before the unmapped page, which must never be touched
+    static constexpr char kText[] = "/usr/bin/test";
+    const u64 addr                = kPageAddr + hal::kPageSizeBytes - sizeof(kText);
+    memcpy(UptrToPtr<char>(addr), kText, sizeof(kText));
+
+    char buffer[64];
+    const auto result = CopyStringFromUser(buffer, UptrToPtr<const char>(addr), sizeof(buffer));
+    EXPECT_TRUE(result.has_value());
+    EXPECT_EQ(sizeof(kText) - 1, *result);
+    EXPECT_EQ(0, strcmp(kText, buffer));
+}
+
+TEST_F(UserAccessTest, CopyStringFromUser_GivenStringRunningIntoUnmappedPage_ReturnsBadAddress)
+{
+    const u64 addr = kPageAddr + hal::kPageSizeBytes - 8;
+    memset(UptrToPtr<char>(addr), 'a', 8);
+
+    char buffer[64];
+    const auto result = CopyStringFromUser(buffer, UptrToPtr<const char>(addr), sizeof(buffer));
+    EXPECT_FALSE(result.has_value());
+    EXPECT_EQ(MemError::BadAddress, result.error());
+}
+
+TEST_F(UserAccessTest, CopyStringFromUser_GivenStringLongerThanCapacity_ReturnsInvalidArgument)
+{
+    memset(UptrToPtr<char>(kPageAddr), 'a', 64);
+
+    char buffer[16];
+    const auto result =
+        CopyStringFromUser(buffer, UptrToPtr<const char>(kPageAddr), sizeof(buffer));
+    EXPECT_FALSE(result.has_value());
+    EXPECT_EQ(MemError::InvalidArgument, result.error());
+}
+
+TEST_F(UserAccessTest, CopyFromUser_GivenNoAccessArea_ReturnsBadAddress)
+{
+    // Fault the page in first, so it stays mapped as a supervisor page afterwards
+    memset(UptrToPtr<byte>(kPageAddr), 0, 64);
+
+    auto &vmm = MemoryModule::Get().GetVmm();
+    auto *as  = &MemoryModule::Get().GetKernelAddressSpace();
+    R_ASSERT_TRUE(vmm.UpdateAreaFlags(as, UptrToPtr<void>(kPageAddr), {}).has_value());
+
+    byte buffer[32];
+    const auto result = CopyFromUser(buffer, UptrToPtr<const byte>(kPageAddr), sizeof(buffer));
+    EXPECT_FALSE(result.has_value());
+    EXPECT_EQ(MemError::BadAddress, result.error());
+}
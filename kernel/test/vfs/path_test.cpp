@@ -421,3 +421,74 @@ TEST_F(VFSPathTest, StringAccessAndEdgeCases)
     EXPECT_TRUE(path.GetComponent(100).empty());
     EXPECT_TRUE(path[100].empty());
 }
+
+// =============================================================================
+// Limits and Errors
+// =============================================================================
+
+TEST_F(VFSPathTest, LongPathsMoveToHeapIntact)
+{
+    // Longer than the inline buffer, short enough to fit the limits
+    char long_str[vfs::kInlinePathSize * 3];
+    size_t len = 0;
+    for (size_t i = 0; len + 9 < sizeof(long_str) - 1; ++i) {
+        memcpy(long_str + len, "/segment", 8);
+        long_str[len + 8] = static_cast<char>('a' + i % 26);
+        len += 9;
+    }
+    long_str[len] = '\0';
+
+    vfs::Path path(long_str);
+    EXPECT_TRUE(path.IsValid());
+    EXPECT_EQ(std::string_view(long_str), path.StringView());
+    EXPECT_EQ(len / 9, path.ComponentCount());
+
+    vfs::Path copy = path;
+    EXPECT_TRUE(copy.IsValid());
+    EXPECT_TRUE(copy == path);
+    EXPECT_EQ("segmenta", copy.GetComponent(0));
+}
+
+TEST_F(VFSPathTest, OverlongStringIsReportedNotTruncated)
+{
+    char long_str[vfs::kMaxPathSize + 16];
+    memset(long_str, 'a', sizeof(long_str) - 1);
+    long_str[0]                    = '/';
+    long_str[sizeof(long_str) - 1] = '\0';
+
+    vfs::Path path(long_str);
+    EXPECT_FALSE(path.IsValid());
+    EXPECT_EQ(vfs::PathError::kTooLong, path.GetError());
+
+    // Derived paths keep the error
+    EXPECT_FALSE(path.GetParent().IsValid());
+    EXPECT_FALSE(path.GetNormalized().IsValid());
+    EXPECT_FALSE(path.GetSubpath(0).IsValid());
+    EXPECT_FALSE((vfs::Path("/home") / path).IsValid());
+}
+
+TEST_F(VFSPathTest, TooManyComponentsIsReported)
+{
+    vfs::Path path("/");
+    for (size_t i = 0; i < vfs::kMaxComponents; ++i) {
+        path /= "d";
+    }
+    EXPECT_TRUE(path.IsValid());
+    EXPECT_EQ(vfs::kMaxComponents, path.ComponentCount());
+
+    vfs::Path overflowed = path / "e";
+    EXPECT_FALSE(overflowed.IsValid());
+    EXPECT_EQ(vfs::PathError::kTooLong, overflowed.GetError());
+    EXPECT_TRUE(path.IsValid());
+}
+
+TEST_F(VFSPathTest, NormalizationOfValidPathStaysValid)
+{
+    vfs::Path path("/a/./b/../c//d/");
+    vfs::Path normalized = path.GetNormalized();
+    EXPECT_TRUE(normalized.IsValid());
+    EXPECT_EQ("/a/c/d", normalized.StringView());
+
+    vfs::Path relative("../x/./y/..");
+    EXPECT_EQ("../x", relative.GetNormalized().StringView());
+}
@@ -0,0 +1,163 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025-2026 The AlkOS Authors
+// See the AUTHORS file for the full list of contributors.
+
+#include <test_module/test.hpp>
+
+#include <mutex.hpp>
+
+#include <mem/heap.hpp>
+#include <modules/memory.hpp>
+#include <scheduling/local_lock.hpp>
+#include <video/window_manager.hpp>
+
+using namespace Video;
+
+class WindowManagerTest : public TestGroupBase
+{
+    protected:
+    static constexpr Graphics::PixelFormat kFormat{16, 8, 8, 8, 0, 8};
+    static constexpr u32 kWidth  = 64;
+    static constexpr u32 kHeight = 32;
+    static constexpr u32 kPitch  = kWidth * sizeof(Graphics::NativePixel);
+
+    void Setup_() override
+    {
+        // A plain frame stands in for VRAM
+        auto vram = MemoryModule::Get().GetBuddyPmm().Alloc(
+            {.order = Mem::BuddyPmm::SizeToPageOrder(kPitch * kHeight)}
+        );
+        R_ASSERT_TRUE(vram.has_value());
+        vram_ = *vram;
+        framebuffer_.Init(
+            Graphics::Surface(
+                reinterpret_cast<Graphics::NativePixel *>(Mem::PhysToVirt(vram_)), kWidth, kHeight,
+                kPitch
+            ),
+            kFormat, vram_
+        );
+
+        auto wm = Mem::KNew<WindowManager>();
+        R_ASSERT_TRUE(wm.has_value());
+        wm_ = *wm;
+        wm_->Init(framebuffer_);
+    }
+
+    void TearDown_() override
+    {
+        Mem::KDelete(wm_->compositor_wq_);
+        Mem::KDelete(wm_->frame_wq_);
+        Mem::KDelete(wm_);
+        MemoryModule::Get().GetBuddyPmm().Free(vram_);
+    }
+
+    /// Create a session the way CreateSession() does for a process owning the given space
+    GraphicSessionNode *AddSession(const Sched::Pid pid, Mem::VPtr<Mem::AddressSpace> as)
+    {
+        auto buffer = wm_->AllocUserBuffer();
+        R_ASSERT_TRUE(buffer.has_value());
+
+        auto user_buffer = MemoryModule::Get().GetVmm().MapUserBackbuffer(
+            as, buffer->phys_buffer, buffer->size_bytes
+        );
+        R_ASSERT_TRUE(user_buffer.has_value());
+
+        LocalCoreLock core_lock{};
+        std::lock_guard lock(wm_->lock_);
+        GraphicSessionNode *node = wm_->RegisterGraphicsSession(pid, *buffer, *user_buffer, as);
+        wm_->Raise(node);
+        return node;
+    }
+
+    // Test bodies derive from the fixture and do not inherit its friendship
+
+    NODISCARD GraphicSessionNode *GetActive() const { return wm_->active_session_; }
+    NODISCARD GraphicSessionNode *GetDirect() const { return wm_->direct_session_; }
+    NODISCARD GraphicSessionNode *Find(const Sched::Pid pid) const { return wm_->FindSession(pid); }
+    NODISCARD bool IsMappingPending() const { return wm_->mapping_pending_; }
+    void ClearMappingPending() const { wm_->mapping_pending_ = false; }
+
+    /// As if the compositor had moved the buffer of the session to the screen
+    void MapDirect(GraphicSessionNode *node) const
+    {
+        node->data.mode      = kGuiSessionDirect;
+        wm_->direct_session_ = node;
+    }
+
+    NODISCARD bool UpdateDirectMapping() const
+    {
+        LocalCoreLock core_lock{};
+        std::lock_guard lock(wm_->lock_);
+        return wm_->UpdateDirectMapping().has_value();
+    }
+
+    static Mem::VPtr<Mem::AddressSpace> CreateAddrSpace()
+    {
+        auto as = MemoryModule::Get().GetVmm().CreateUserAddrSpace();
+        R_ASSERT_TRUE(as.has_value());
+        return *as;
+    }
+
+    static void DestroyAddrSpace(Mem::VPtr<Mem::AddressSpace> as)
+    {
+        R_ASSERT_TRUE(MemoryModule::Get().GetVmm().DestroyUserAddrSpace(as).has_value());
+    }
+
+    Drivers::Video::Framebuffer framebuffer_{};
+    Mem::PPtr<Mem::Page> vram_{nullptr};
+    WindowManager *wm_{nullptr};
+};
+
+TEST_F(WindowManagerTest, SetSessionMode_LeavesTheMappingToTheCompositor)
+{
+    const Sched::Pid pid{.id = 1, .count = 0};
+    auto *as = CreateAddrSpace();
+    AddSession(pid, as);
+    ClearMappingPending();
+
+    EXPECT_TRUE(wm_->SetSessionMode(pid, kGuiSessionDirect).has_value());
+    EXPECT_TRUE(IsMappingPending());
+    EXPECT_NULL(GetDirect());
+
+    wm_->ReleaseSession(pid);
+    DestroyAddrSpace(as);
+}
+
+TEST_F(WindowManagerTest, ReleaseSession_GivenTopSession_RaisesTheOneBelow)
+{
+    const Sched::Pid below_pid{.id = 1, .count = 0};
+    const Sched::Pid top_pid{.id = 2, .count = 0};
+    auto *below_as            = CreateAddrSpace();
+    auto *top_as              = CreateAddrSpace();
+    GraphicSessionNode *below = AddSession(below_pid, below_as);
+    AddSession(top_pid, top_as);
+
+    // Torn down in the order of process cleanup, the session goes before its address space
+    wm_->ReleaseSession(top_pid);
+    DestroyAddrSpace(top_as);
+
+    EXPECT_EQ(below, GetActive());
+    EXPECT_NULL(Find(top_pid));
+    EXPECT_FALSE(wm_->SetSessionMode(top_pid, kGuiSessionDirect).has_value());
+
+    wm_->ReleaseSession(below_pid);
+    DestroyAddrSpace(below_as);
+
+    EXPECT_NULL(GetActive());
+    EXPECT_NULL(Find(below_pid));
+}
+
+TEST_F(WindowManagerTest, ReleaseSession_GivenDirectSession_ForgetsTheMapping)
+{
+    const Sched::Pid pid{.id = 1, .count = 0};
+    auto *as = CreateAddrSpace();
+    MapDirect(AddSession(pid, as));
+
+    wm_->ReleaseSession(pid);
+    EXPECT_NULL(GetDirect());
+    EXPECT_NULL(Find(pid));
+
+    // Nothing is left for the compositor to move back into the destroyed address space
+    DestroyAddrSpace(as);
+    EXPECT_TRUE(UpdateDirectMapping());
+}
@@ -14,7 +14,7 @@
  * @brief Userspace syscall interface for x86_64
  *
  * This header provides inline assembly wrappers for making system calls.
- * On x86_64, we use the int 0x80 instruction with the following convention:
+ * On x86_64, we use the syscall instruction with the following convention:
  * - RAX: syscall number
  * - RDI: arg0
  * - RSI: arg1
@@ -23,43 +23,49 @@
  * - R8:  arg4
  * - R9:  arg5
  * - Return value: RAX
+ *
+ * The syscall instruction stores the return address in RCX and RFLAGS in R11, so both are
+ * clobbered. The kernel still accepts int 0x80 with the same register convention.
  */
 
-#define syscall0(num)                                                                             \
-    ({                                                                                            \
-        size_t __ret;                                                                             \
-        __asm__ volatile("int    $0x80\n\t" : "=a"(__ret) : "0"((size_t)(num)) : "memory", "cc"); \
-        __ret;                                                                                    \
+#define syscall0(num)                                     \
+    ({                                                    \
+        size_t __ret;                                     \
+        __asm__ volatile("syscall\n\t"                    \
+                         : "=a"(__ret)                    \
+                         : "0"((size_t)(num))             \
+                         : "rcx", "r11", "memory", "cc"); \
+        __ret;                                            \
     })
 
 #define syscall1(num, arg0)                                        \
     ({                                                             \
         size_t __ret;                                              \
-        __asm__ volatile("int    $0x80\n\t"                        \
+        __asm__ volatile("syscall\n\t"                             \
                          : "=a"(__ret)                             \
                          : "0"((size_t)(num)), "D"((size_t)(arg0)) \
-                         : "memory", "cc");                        \
+                         : "rcx", "r11", "memory", "cc");          \
         __ret;                                                     \
     })
 
 #define syscall2(num, arg0, arg1)                                                       \
     ({                                                                                  \
         size_t __ret;                                                                   \
-        __asm__ volatile("int    $0x80\n\t"                                             \
+        __asm__ volatile("syscall\n\t"                                                  \
                          : "=a"(__ret)                                                  \
                          : "0"((size_t)(num)), "D"((size_t)(arg0)), "S"((size_t)(arg1)) \
-                         : "memory", "cc");                                             \
+                         : "rcx", "r11", "memory", "cc");                               \
         __ret;                                                                          \
     })
 
 #define syscall3(num, arg0, arg1, arg2)                                                  \
     ({                                                                                   \
         size_t __ret;                                                                    \
-        __asm__ volatile("int    $0x80\n\t"                                              \
+        __asm__ volatile("syscall\n\t"                                                   \
                          : "=a"(__ret)                                                   \
                          : "0"((size_t)(num)), "D"((size_t)(arg0)), "S"((size_t)(arg1)), \
                            "d"((size_t)(arg2))                                           \
-                         : "memory", "cc");                                              \
+                         : "rcx", "r11", "memory", "cc");                                \
         __ret;                                                                           \
     })
 
@@ -67,11 +73,11 @@
     ({                                                                                   \
         size_t __ret;                                                                    \
         register size_t __r10 asm("r10") = (size_t)(arg3);                               \
-        __asm__ volatile("int    $0x80\n\t"                                              \
+        __asm__ volatile("syscall\n\t"                                                   \
                          : "=a"(__ret)                                                   \
                          : "0"((size_t)(num)), "D"((size_t)(arg0)), "S"((size_t)(arg1)), \
                            "d"((size_t)(arg2)), "r"(__r10)                               \
-                         : "memory", "cc");                                              \
+                         : "rcx", "r11", "memory", "cc");                                \
         __ret;                                                                           \
     })
 
@@ -80,11 +86,11 @@
         size_t __ret;                                                                    \
         register size_t __r10 asm("r10") = (size_t)(arg3);                               \
         register size_t __r8 asm("r8")   = (size_t)(arg4);                               \
-        __asm__ volatile("int    $0x80\n\t"                                              \
+        __asm__ volatile("syscall\n\t"                                                   \
                          : "=a"(__ret)                                                   \
                          : "0"((size_t)(num)), "D"((size_t)(arg0)), "S"((size_t)(arg1)), \
                            "d"((size_t)(arg2)), "r"(__r10), "r"(__r8)                    \
-                         : "memory", "cc");                                              \
+                         : "rcx", "r11", "memory", "cc");                                \
         __ret;                                                                           \
     })
 
@@ -94,11 +100,11 @@
         register size_t __r10 asm("r10") = (size_t)(arg3);                               \
         register size_t __r8 asm("r8")   = (size_t)(arg4);                               \
         register size_t __r9 asm("r9")   = (size_t)(arg5);                               \
-        __asm__ volatile("int    $0x80\n\t"                                              \
+        __asm__ volatile("syscall\n\t"                                                   \
                          : "=a"(__ret)                                                   \
                          : "0"((size_t)(num)), "D"((size_t)(arg0)), "S"((size_t)(arg1)), \
                            "d"((size_t)(arg2)), "r"(__r10), "r"(__r8), "r"(__r9)         \
-                         : "memory", "cc");                                              \
+                         : "rcx", "r11", "memory", "cc");                                \
         __ret;                                                                           \
     })
 
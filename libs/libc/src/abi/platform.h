@@ -35,6 +35,18 @@ SYSCALL_NAME(write, kSysWrite, ssize_t, fd_t, fd, const void *, buf, size_t, cou
 SYSCALL_NAME(seek, kSysSeek, ssize_t, fd_t, fd, ssize_t, offset, FdSeek, whence);
 SYSCALL_NAME(dup, kSysDup, fd_t, fd_t, fd);
 SYSCALL_NAME(dup_to, kSysDupTo, fd_t, fd_t, old_fd, fd_t, new_fd);
+SYSCALL_NAME(read_v, kSysReadV, ssize_t, fd_t, fd, const IoVec *, iov, size_t, count);
+SYSCALL_NAME(write_v, kSysWriteV, ssize_t, fd_t, fd, const IoVec *, iov, size_t, count);
+SYSCALL_NAME(pread, kSysPRead, ssize_t, fd_t, fd, void *, buf, size_t, count, u64, offset);
+SYSCALL_NAME(
+    pwrite, kSysPWrite, ssize_t, fd_t, fd, const void *, buf, size_t, count, u64, offset
+);
+SYSCALL_NAME(pipe, kSysPipe, int, fd_t *, fds, FdOpenFlags, flags);
+SYSCALL_NAME(poll, kSysPoll, int, PollFd *, fds, size_t, count, i64, timeout_ns);
+SYSCALL_NAME(splice, kSysSplice, ssize_t, fd_t, in_fd, fd_t, out_fd, size_t, count);
+SYSCALL_NAME(
+    send_file, kSysSendFile, ssize_t, fd_t, out_fd, fd_t, in_fd, u64 *, offset, size_t, count
+);
 
 /* File system */
 SYSCALL_NAME(
@@ -62,14 +74,44 @@ SYSCALL_NAME(get_heap_start, kGetHeapAddr, void *);
 
 // Video
 SYSCALL_VOID_NAME(create_graphic_session, kSysCreateGraphicSession, GuiBufferInfo *, info);
-SYSCALL_VOID_NAME(blit, kSysBlit);
+SYSCALL_NAME(blit, kSysBlit, int, const GuiRect *, rects, size_t, count);
+SYSCALL_NAME(set_graphic_session_mode, kSysSetGraphicSessionMode, int, GuiSessionMode, mode);
+SYSCALL_NAME(set_graphic_session_frame, kSysSetGraphicSessionFrame, int, GuiRect *, frame);
+SYSCALL_NAME(wait_frame, kSysWaitFrame, int, GuiFrameStats *, stats);
 
 /* Input Syscalls */
 SYSCALL_NAME(get_key_state, kSysGetKeyState, bool, VirtualKey, vk);
+SYSCALL_NAME(
+    read_input_events, kSysReadInputEvents, int, InputEvent *, events, size_t, count, i64,
+    timeout_ns
+);
 
 // Power Management
 SYSCALL_VOID_NAME(power, kSysPower, PowerAction, action);
 
+/* Memory Syscalls */
+SYSCALL_NAME(
+    mmap, kSysMmap, i64, fd_t, fd, u64, offset, size_t, length, MemProtFlags, prot, MemMapFlags,
+    flags
+);
+SYSCALL_NAME(munmap, kSysMunmap, int, void *, addr);
+SYSCALL_NAME(msync, kSysMsync, int, void *, addr);
+SYSCALL_NAME(mmap_anon, kSysMmapAnon, i64, size_t, length, MemProtFlags, prot);
+SYSCALL_NAME(mprotect, kSysMprotect, int, void *, addr, MemProtFlags, prot);
+
+/* Io Ring Syscalls */
+SYSCALL_NAME(ring_setup, kSysRingSetup, i64);
+SYSCALL_NAME(ring_enter, kSysRingEnter, int, u32, count);
+
+/* Tracing Syscalls */
+SYSCALL_NAME(get_syscall_stats, kSysGetSyscallStats, int, SyscallStats *, stats, size_t, count);
+SYSCALL_NAME(trace_syscalls, kSysTraceSyscalls, int, u64, pid, bool, enable);
+SYSCALL_NAME(
+    read_syscall_trace, kSysReadSyscallTrace, int, u64, pid, SyscallTraceRecord *, records,
+    size_t, count
+);
+SYSCALL_VOID_NAME(nop, kSysNop);
+
 END_DECL_C
 
 #endif  // LIBS_LIBC_SRC_ABI_PLATFORM_H_
@@ -14,8 +14,11 @@
 #include <alkos/sys/fs/fd.h>
 #include <alkos/sys/fs/fs.h>
 #include <alkos/sys/input.h>
+#include <alkos/sys/mem.h>
 #include <alkos/sys/power.h>
 #include <alkos/sys/proc.h>
+#include <alkos/sys/ring.h>
+#include <alkos/sys/syscall_stats.h>
 #include <alkos/sys/thread.h>
 #include <alkos/sys/time.h>
 
@@ -5,6 +5,8 @@
 #ifndef LIBS_LIBC_SRC_INCLUDE_ALKOS_FD_H_
 #define LIBS_LIBC_SRC_INCLUDE_ALKOS_FD_H_
 
+#include <types.h>
+
 typedef int fd_t;
 
 typedef enum {
@@ -25,4 +27,27 @@ typedef enum { kFdBufferNone = 0, kFdBufferLine = 1, kFdBufferFull = 2 } FdBuffe
 
 typedef enum { kFdSeekSet = 0, kFdSeekCurrent = 1, kFdSeekEnd = 2 } FdSeek;
 
+// Single buffer of a vectored read or write
+typedef struct {
+    void *base;
+    size_t length;
+} IoVec;
+
+// Readiness of a polled file descriptor. Errors, hang ups and invalid descriptors are reported
+// even if not requested.
+typedef enum {
+    kPollIn      = 0x1,   // Reading does not block
+    kPollOut     = 0x2,   // Writing does not block
+    kPollError   = 0x4,   // Every read end is closed, writes fail
+    kPollHangUp  = 0x8,   // Every write end is closed, reads return end of file
+    kPollInvalid = 0x10,  // Not an open file descriptor
+} PollEvents;
+
+// Single entry of a poll request
+typedef struct {
+    fd_t fd;      // Descriptor to watch, negative entries are skipped
+    u16 events;   // Requested PollEvents
+    u16 revents;  // PollEvents that are ready, filled by the call
+} PollFd;
+
 #endif  // LIBS_LIBC_SRC_INCLUDE_ALKOS_FD_H_
@@ -137,4 +137,14 @@ typedef struct {
     bool scroll_lock : 1;
 } KeyModifiers;
 
+/**
+ * @brief Key press or release, as read by ReadInputEvents()
+ */
+typedef struct {
+    u64 time_ns;  // System lifetime at the interrupt
+    VirtualKey key;
+    bool pressed;  // Held keys repeat their press events
+    KeyModifiers modifiers;
+} InputEvent;
+
 #endif  // LIBS_LIBC_SRC_INCLUDE_ALKOS_INPUT_H_
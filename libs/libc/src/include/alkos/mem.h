@@ -0,0 +1,23 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025-2026 The AlkOS Authors
+// See the AUTHORS file for the full list of contributors.
+
+#ifndef LIBS_LIBC_SRC_INCLUDE_ALKOS_MEM_H_
+#define LIBS_LIBC_SRC_INCLUDE_ALKOS_MEM_H_
+
+// Size of the demand paged heap range reserved for every process at exec
+static const unsigned long long kMemHeapSize = 16ULL * 1024 * 1024 * 1024;  // 16 GB
+
+typedef enum {
+    kMemProtNone  = 0x0,
+    kMemProtRead  = 0x1,
+    kMemProtWrite = 0x2,
+    kMemProtExec  = 0x4,
+} MemProtFlags;
+
+typedef enum {
+    kMemMapPrivate = 0x0,  // Writes are private to the process (copy-on-write)
+    kMemMapShared  = 0x1,  // Writes reach the underlying file
+} MemMapFlags;
+
+#endif  // LIBS_LIBC_SRC_INCLUDE_ALKOS_MEM_H_
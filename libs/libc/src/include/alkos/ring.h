@@ -0,0 +1,55 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025-2026 The AlkOS Authors
+// See the AUTHORS file for the full list of contributors.
+
+#ifndef LIBS_LIBC_SRC_INCLUDE_ALKOS_RING_H_
+#define LIBS_LIBC_SRC_INCLUDE_ALKOS_RING_H_
+
+#include <types.h>
+#include "alkos/fd.h"
+
+// Number of entries of the submission and completion queues, both powers of two
+enum { kRingSqEntries = 64, kRingCqEntries = 128 };
+
+// Read or write at the shared offset of the descriptor instead of an explicit one
+static const unsigned long long kRingOffsetCurrent = ~0ULL;
+
+typedef enum {
+    kRingOpNop   = 0,  // Completes with 0
+    kRingOpRead  = 1,  // fd, addr: buffer, length, offset
+    kRingOpWrite = 2,  // fd, addr: buffer, length, offset
+    kRingOpOpen  = 3,  // addr: path, length: FdOpenFlags. Completes with the new fd
+    kRingOpClose = 4,  // fd
+    kRingOpBlit  = 5,  // addr: GuiRect array, length: its size, 0 for the whole screen
+    kRingOpSleep = 6,  // length: nanoseconds
+} RingOp;
+
+// Single queued operation, the meaning of the fields depends on op
+typedef struct {
+    u32 op;         // RingOp
+    fd_t fd;        // Descriptor the operation works on
+    u64 addr;       // Buffer or path
+    u64 length;     // Buffer length or operation specific argument
+    u64 offset;     // File offset or kRingOffsetCurrent
+    u64 user_data;  // Copied to the completion unchanged
+} RingSubmission;
+
+// Result of a processed submission, completions are posted in submission order
+typedef struct {
+    u64 user_data;  // user_data of the submission
+    i64 result;     // Non-negative on success, negative error on failure
+} RingCompletion;
+
+// Queue pair shared between a process and the kernel. Indices run freely and are masked with
+// the number of entries when used. The process advances sq_tail and cq_head, the kernel
+// advances sq_head and cq_tail.
+typedef struct {
+    u32 sq_head;
+    u32 sq_tail;
+    u32 cq_head;
+    u32 cq_tail;
+    RingSubmission sq[kRingSqEntries];
+    RingCompletion cq[kRingCqEntries];
+} IoRing;
+
+#endif  // LIBS_LIBC_SRC_INCLUDE_ALKOS_RING_H_
@@ -8,8 +8,11 @@
 #include "alkos/fd.h"
 #include "alkos/fs.h"
 #include "alkos/input.h"
+#include "alkos/mem.h"
 #include "alkos/power.h"
 #include "alkos/proc.h"
+#include "alkos/ring.h"
+#include "alkos/syscall_stats.h"
 #include "alkos/thread.h"
 #include "alkos/time.h"
 #include "alkos/video.h"
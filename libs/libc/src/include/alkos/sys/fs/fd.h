@@ -66,6 +66,56 @@ FAST_CALL ssize_t SeekFd(fd_t fd, ssize_t offset, FdSeek whence)
     return __platform_seek(fd, offset, whence);
 }
 
+/**
+ * @brief Read from a file descriptor into several buffers with a single call
+ * @param fd File descriptor to read from
+ * @param iov Buffers to fill, in order
+ * @param count Number of buffers
+ * @return Total number of bytes read on success, -1 on failure
+ */
+FAST_CALL ssize_t ReadFdV(fd_t fd, const IoVec *iov, size_t count)
+{
+    return __platform_read_v(fd, iov, count);
+}
+
+/**
+ * @brief Write several buffers to a file descriptor with a single call
+ * @param fd File descriptor to write to
+ * @param iov Buffers to write, in order
+ * @param count Number of buffers
+ * @return Total number of bytes written on success, -1 on failure
+ */
+FAST_CALL ssize_t WriteFdV(fd_t fd, const IoVec *iov, size_t count)
+{
+    return __platform_write_v(fd, iov, count);
+}
+
+/**
+ * @brief Read from a file at the given offset, without moving the file descriptor offset
+ * @param fd File descriptor to read from
+ * @param buf Buffer to store read data
+ * @param count Number of bytes to read
+ * @param offset Offset in the file to read at
+ * @return Number of bytes read on success, -1 on failure
+ */
+FAST_CALL ssize_t ReadFdAt(fd_t fd, void *buf, size_t count, u64 offset)
+{
+    return __platform_pread(fd, buf, count, offset);
+}
+
+/**
+ * @brief Write to a file at the given offset, without moving the file descriptor offset
+ * @param fd File descriptor to write to
+ * @param buf Buffer containing data to write
+ * @param count Number of bytes to write
+ * @param offset Offset in the file to write at
+ * @return Number of bytes written on success, -1 on failure
+ */
+FAST_CALL ssize_t WriteFdAt(fd_t fd, const void *buf, size_t count, u64 offset)
+{
+    return __platform_pwrite(fd, buf, count, offset);
+}
+
 /**
  * @brief Duplicate a file descriptor
  * @param fd File descriptor to duplicate
@@ -81,6 +131,54 @@ FAST_CALL fd_t DuplicateFd(fd_t fd) { return __platform_dup(fd); }
  */
 FAST_CALL fd_t DuplicateFdTo(fd_t old_fd, fd_t new_fd) { return __platform_dup_to(old_fd, new_fd); }
 
+/**
+ * @brief Create an anonymous pipe. Reads block while it is empty and return 0 once every
+ * write end is closed, writes block while it is full.
+ * @param fds Receives the read end in fds[0] and the write end in fds[1]
+ * @param flags kFdFlagNonBlock to make both ends non-blocking, otherwise 0
+ * @return 0 on success, negative error on failure
+ */
+FAST_CALL int CreatePipe(fd_t fds[2], FdOpenFlags flags) { return __platform_pipe(fds, flags); }
+
+/**
+ * @brief Wait until at least one of several file descriptors is ready
+ * @param fds Descriptors with requested events, revents of every entry is filled
+ * @param count Number of entries
+ * @param timeout_ns Maximal wait in nanoseconds, negative waits without limit, 0 only checks
+ * @return Number of entries with non-zero revents (0 on timeout), negative error on failure
+ */
+FAST_CALL int PollFds(PollFd *fds, size_t count, i64 timeout_ns)
+{
+    return __platform_poll(fds, count, timeout_ns);
+}
+
+/**
+ * @brief Move data between file descriptors inside the kernel, without a user buffer. File
+ * data is taken straight from the page cache, a whole file is moved by a single call.
+ * @param in_fd File or pipe to read from, a file is read at and advances its offset
+ * @param out_fd File descriptor to write to
+ * @param count Maximal number of bytes to move
+ * @return Number of bytes moved (0 at end of input) on success, negative error on failure
+ */
+FAST_CALL ssize_t SpliceFd(fd_t in_fd, fd_t out_fd, size_t count)
+{
+    return __platform_splice(in_fd, out_fd, count);
+}
+
+/**
+ * @brief Move file data at the given offset to another file descriptor inside the kernel,
+ * without moving the offset of the input file descriptor
+ * @param out_fd File descriptor to write to
+ * @param in_fd File to read from
+ * @param offset Offset in the file, advanced past the data moved
+ * @param count Maximal number of bytes to move
+ * @return Number of bytes moved (0 at end of file) on success, negative error on failure
+ */
+FAST_CALL ssize_t SendFileToFd(fd_t out_fd, fd_t in_fd, u64 *offset, size_t count)
+{
+    return __platform_send_file(out_fd, in_fd, offset, count);
+}
+
 END_DECL_C
 
 #endif  // LIBS_LIBC_SRC_INCLUDE_ALKOS_SYS_FS_FD_H_
@@ -11,4 +11,18 @@
 
 FORCE_INLINE_F bool GetKeyState(VirtualKey vk) { return __platform_get_key_state(vk); }
 
+/**
+ * @brief Take the oldest key events of the calling process. Events are queued from the first
+ * call on, while the process has the input focus.
+ * @param events Receives the events, oldest first
+ * @param count Number of entries in events
+ * @param timeout_ns Maximal wait for the first event in nanoseconds, negative waits without
+ * limit, 0 only checks
+ * @return Number of events read (0 on timeout), negative error on failure
+ */
+FORCE_INLINE_F int ReadInputEvents(InputEvent *events, size_t count, i64 timeout_ns)
+{
+    return __platform_read_input_events(events, count, timeout_ns);
+}
+
 #endif  // LIBS_LIBC_SRC_INCLUDE_ALKOS_SYS_INPUT_H_
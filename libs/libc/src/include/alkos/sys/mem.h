@@ -0,0 +1,66 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025-2026 The AlkOS Authors
+// See the AUTHORS file for the full list of contributors.
+
+#ifndef LIBS_LIBC_SRC_INCLUDE_ALKOS_SYS_MEM_H_
+#define LIBS_LIBC_SRC_INCLUDE_ALKOS_SYS_MEM_H_
+
+#include "alkos/mem.h"
+#include "defines.h"
+#include "platform.h"
+#include "types.h"
+
+BEGIN_DECL_C
+
+/**
+ * @brief Map a file into the address space of the calling process
+ * @param fd File descriptor of the file to map
+ * @param offset Offset in the file, must be page aligned
+ * @param length Length of the mapping in bytes
+ * @param prot Access permissions of the mapping
+ * @param flags Whether writes are shared with the file or private to the process
+ * @return Address of the mapping on success, NULL on failure
+ */
+FAST_CALL void *MapFile(fd_t fd, u64 offset, size_t length, MemProtFlags prot, MemMapFlags flags)
+{
+    const i64 result = __platform_mmap(fd, offset, length, prot, flags);
+    return result < 0 ? NULL : (void *)result;
+}
+
+/**
+ * @brief Map zero-filled memory into the address space of the calling process
+ * @param length Length of the mapping in bytes, rounded up to whole pages
+ * @param prot Access permissions of the mapping, kMemProtNone for guard pages
+ * @return Address of the mapping on success, NULL on failure
+ */
+FAST_CALL void *MapAnonymous(size_t length, MemProtFlags prot)
+{
+    const i64 result = __platform_mmap_anon(length, prot);
+    return result < 0 ? NULL : (void *)result;
+}
+
+/**
+ * @brief Remove the mapping starting at the given address
+ * @param addr Address returned by a mapping call, other memory cannot be unmapped
+ * @return 0 on success, negative error on failure
+ */
+FAST_CALL int Unmap(void *addr) { return __platform_munmap(addr); }
+
+/**
+ * @brief Change the access permissions of a whole mapping
+ * @param addr Address returned by a mapping call
+ * @param prot New access permissions, shared file mappings created read-only stay read-only
+ * @return 0 on success, negative error on failure
+ */
+FAST_CALL int Protect(void *addr, MemProtFlags prot) { return __platform_mprotect(addr, prot); }
+
+/**
+ * @brief Write modified pages of a shared file mapping back to the file
+ * @param addr Address returned by a mapping call
+ * @return 0 on success, negative error on failure
+ */
+FAST_CALL int SyncMapping(void *addr) { return __platform_msync(addr); }
+
+END_DECL_C
+
+#endif  // LIBS_LIBC_SRC_INCLUDE_ALKOS_SYS_MEM_H_
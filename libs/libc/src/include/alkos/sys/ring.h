@@ -0,0 +1,69 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025-2026 The AlkOS Authors
+// See the AUTHORS file for the full list of contributors.
+
+#ifndef LIBS_LIBC_SRC_INCLUDE_ALKOS_SYS_RING_H_
+#define LIBS_LIBC_SRC_INCLUDE_ALKOS_SYS_RING_H_
+
+#include "alkos/ring.h"
+#include "defines.h"
+#include "platform.h"
+#include "types.h"
+
+BEGIN_DECL_C
+
+/**
+ * @brief Create the io ring of the calling process and map it. A process has a single ring, so
+ * only one call may succeed, keep the returned pointer
+ * @return The ring on success, NULL on failure or when the ring already exists
+ */
+FAST_CALL IoRing *SetupRing(void)
+{
+    const i64 result = __platform_ring_setup();
+    return result < 0 ? NULL : (IoRing *)result;
+}
+
+/**
+ * @brief Process queued submissions in a single kernel entry. Every processed submission has
+ * its completion posted before the call returns, processing stops early once the completion
+ * queue is full.
+ * @param count Maximal number of submissions to process
+ * @return Number of submissions processed on success, negative error on failure
+ */
+FAST_CALL int EnterRing(u32 count) { return __platform_ring_enter(count); }
+
+/**
+ * @brief Queue a submission, it is processed by the next EnterRing()
+ * @return false if the submission queue is full
+ */
+FAST_CALL bool RingSubmit(IoRing *ring, const RingSubmission *submission)
+{
+    const u32 tail = ring->sq_tail;
+    if (tail - __atomic_load_n(&ring->sq_head, __ATOMIC_ACQUIRE) == kRingSqEntries) {
+        return false;
+    }
+
+    ring->sq[tail & (kRingSqEntries - 1)] = *submission;
+    __atomic_store_n(&ring->sq_tail, tail + 1, __ATOMIC_RELEASE);
+    return true;
+}
+
+/**
+ * @brief Take the oldest completion off the completion queue
+ * @return false if no completion is pending
+ */
+FAST_CALL bool RingReap(IoRing *ring, RingCompletion *completion)
+{
+    const u32 head = ring->cq_head;
+    if (head == __atomic_load_n(&ring->cq_tail, __ATOMIC_ACQUIRE)) {
+        return false;
+    }
+
+    *completion = ring->cq[head & (kRingCqEntries - 1)];
+    __atomic_store_n(&ring->cq_head, head + 1, __ATOMIC_RELEASE);
+    return true;
+}
+
+END_DECL_C
+
+#endif  // LIBS_LIBC_SRC_INCLUDE_ALKOS_SYS_RING_H_
@@ -0,0 +1,44 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025-2026 The AlkOS Authors
+// See the AUTHORS file for the full list of contributors.
+
+#ifndef LIBS_LIBC_SRC_INCLUDE_ALKOS_SYS_SYSCALL_STATS_H_
+#define LIBS_LIBC_SRC_INCLUDE_ALKOS_SYS_SYSCALL_STATS_H_
+
+#include "alkos/syscall_stats.h"
+#include "defines.h"
+#include "platform.h"
+#include "types.h"
+
+BEGIN_DECL_C
+
+/**
+ * @brief Read the statistics of every syscall number, summed over all cores
+ * @param stats Receives the statistics, indexed by syscall number
+ * @param count Number of entries in stats
+ * @return Number of entries filled, 0 if the kernel was built without the syscall_stats
+ * feature, negative error on failure
+ */
+FAST_CALL int GetSyscallStats(SyscallStats *stats, size_t count)
+{
+    return __platform_get_syscall_stats(stats, count);
+}
+
+/**
+ * @brief Start or stop recording the syscalls of a process, stopping drops unread records
+ * @return 0 on success, negative error on failure
+ */
+FAST_CALL int TraceSyscalls(u64 pid, bool enable) { return __platform_trace_syscalls(pid, enable); }
+
+/**
+ * @brief Take the oldest recorded syscalls of a traced process
+ * @return Number of records read, negative error on failure
+ */
+FAST_CALL int ReadSyscallTrace(u64 pid, SyscallTraceRecord *records, size_t count)
+{
+    return __platform_read_syscall_trace(pid, records, count);
+}
+
+END_DECL_C
+
+#endif  // LIBS_LIBC_SRC_INCLUDE_ALKOS_SYS_SYSCALL_STATS_H_
@@ -12,7 +12,51 @@
 
 BEGIN_DECL_C
 
-FORCE_INLINE_F void Blit() { __platform_blit(); }
+/**
+ * @brief Copy the whole session buffer to the screen
+ * @return GuiSessionVisibility of the session, negative error on failure
+ */
+FORCE_INLINE_F int Blit() { return __platform_blit(NULL, 0); }
+
+/**
+ * @brief Copy only the given areas of the session buffer to the screen. Areas are clipped to
+ * the session frame, more than kGuiMaxDamageRects of them copy the whole buffer.
+ * @return GuiSessionVisibility of the session, negative error on failure
+ */
+FORCE_INLINE_F int BlitRects(const GuiRect *rects, size_t count)
+{
+    return __platform_blit(rects, count);
+}
+
+/**
+ * @brief Choose where the session buffer lives. In kGuiSessionDirect mode the buffer is the
+ * screen itself while the session is shown and plain RAM otherwise, the kernel moves the
+ * contents on every switch.
+ * @return 0 on success, negative error on failure
+ */
+FORCE_INLINE_F int SetGraphicSessionMode(GuiSessionMode mode)
+{
+    return __platform_set_graphic_session_mode(mode);
+}
+
+/**
+ * @brief Show the session in the given area of the screen instead of the whole of it. The top
+ * left part of the buffer of the same size is shown there, the pitch does not change.
+ * @param frame Clipped to the screen, updated to the area actually used
+ * @return 0 on success, negative error on failure
+ */
+FORCE_INLINE_F int SetGraphicSessionFrame(GuiRect *frame)
+{
+    return __platform_set_graphic_session_frame(frame);
+}
+
+/**
+ * @brief Wait for the next present slot of the session, the display refreshes at a fixed rate.
+ * Sessions in the background or hidden get a slot only every few refreshes.
+ * @param stats Filled with the presentation statistics of the session, may be NULL
+ * @return 0 on success, negative error on failure
+ */
+FORCE_INLINE_F int WaitFrame(GuiFrameStats *stats) { return __platform_wait_frame(stats); }
 
 FORCE_INLINE_F GuiBufferInfo GetVideoBufferInfo()
 {
@@ -25,6 +69,7 @@ END_DECL_C
 
 #ifdef __cplusplus
 
+#include <damage.hpp>
 #include <tuple.hpp>
 
 FORCE_INLINE_F std::tuple<Graphics::Surface, Graphics::PixelFormat> GetVideoContext()
@@ -42,6 +87,28 @@ FORCE_INLINE_F std::tuple<Graphics::Surface, Graphics::PixelFormat> GetVideoCont
     return {surface, format};
 }
 
+/**
+ * @brief Copy the areas recorded in a damage list to the screen, nothing if it is empty
+ * @return GuiSessionVisibility of the session, kGuiSessionVisible if there was nothing to copy
+ */
+FORCE_INLINE_F int BlitDamage(const Graphics::DamageList &damage)
+{
+    if (damage.IsEmpty()) {
+        return kGuiSessionVisible;
+    }
+
+    GuiRect rects[Graphics::DamageList::kCapacity];
+    size_t count = 0;
+    for (const Graphics::Rect &rect : damage.GetRects()) {
+        rects[count++] = {
+            static_cast<u32>(rect.x), static_cast<u32>(rect.y), static_cast<u32>(rect.w),
+            static_cast<u32>(rect.h)
+        };
+    }
+
+    return BlitRects(rects, count);
+}
+
 #endif  // __cplusplus
 
 #endif  // LIBS_LIBC_SRC_INCLUDE_ALKOS_SYS_VIDEO_H_
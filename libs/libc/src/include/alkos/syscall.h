@@ -34,6 +34,14 @@ enum SyscallNumber {
     kSysSeek,
     kSysDup,
     kSysDupTo,
+    kSysReadV,
+    kSysWriteV,
+    kSysPRead,
+    kSysPWrite,
+    kSysPipe,
+    kSysPoll,
+    kSysSplice,
+    kSysSendFile,
 
     /* File system syscalls */
     kSysReadDirectory,
@@ -59,16 +67,45 @@ enum SyscallNumber {
     /* Video Syscalls */
     kSysCreateGraphicSession,
     kSysBlit,
+    kSysSetGraphicSessionMode,
+    kSysSetGraphicSessionFrame,
+    kSysWaitFrame,
 
     /* Input Syscalls */
     kSysGetKeyState,
+    kSysReadInputEvents,
 
     /* Power Management Syscalls */
     kSysPower,
 
+    /* Memory Syscalls */
+    kSysMmap,
+    kSysMunmap,
+    kSysMsync,
+    kSysMmapAnon,
+    kSysMprotect,
+
+    /* Io Ring Syscalls */
+    kSysRingSetup,
+    kSysRingEnter,
+
+    /* Tracing Syscalls */
+    kSysGetSyscallStats,
+    kSysTraceSyscalls,
+    kSysReadSyscallTrace,
+    kSysNop,
+
     kSysMax,
 };
 
+/**
+ * @brief Returned when the arguments of a syscall fail validation before it is dispatched.
+ * Lies below every error the calls themselves encode as -error, so the two never collide.
+ */
+enum SyscallStatus {
+    kSyscallBadArgument = -4095,
+};
+
 #define SYSCALL_NAME(name, num, ret_type, ...) \
     ret_type __platform_##name(FOR_EACH_PAIR(MERGE, __VA_ARGS__))
 
@@ -0,0 +1,36 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025-2026 The AlkOS Authors
+// See the AUTHORS file for the full list of contributors.
+
+#ifndef LIBS_LIBC_SRC_INCLUDE_ALKOS_SYSCALL_STATS_H_
+#define LIBS_LIBC_SRC_INCLUDE_ALKOS_SYSCALL_STATS_H_
+
+#include <types.h>
+
+// Latency histogram size. Bucket i counts calls that took [2^i, 2^(i+1)) TSC cycles, the last
+// bucket also counts everything longer.
+enum { kSyscallLatencyBuckets = 32 };
+
+// Number of leading arguments kept in a trace record
+enum { kSyscallTraceArgs = 3 };
+
+// Accumulated statistics of a single syscall number, latencies are in TSC cycles and include
+// time spent blocked inside the kernel
+typedef struct {
+    u64 count;         // Completed calls
+    u64 total_cycles;  // Sum of all latencies
+    u64 max_cycles;    // Longest call
+    u32 histogram[kSyscallLatencyBuckets];
+} SyscallStats;
+
+// Single completed call of a traced process
+typedef struct {
+    u64 start_cycles;             // TSC at kernel entry
+    u64 cycles;                   // Latency of the call
+    i64 result;                   // Raw return value
+    u64 args[kSyscallTraceArgs];  // Leading arguments
+    u32 number;                   // Syscall number
+    u32 tid;                      // Thread index of the caller
+} SyscallTraceRecord;
+
+#endif  // LIBS_LIBC_SRC_INCLUDE_ALKOS_SYSCALL_STATS_H_
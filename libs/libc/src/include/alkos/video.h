@@ -25,4 +25,35 @@ typedef struct {
     GuiPixelFormat format;
 } GuiBufferInfo;
 
+typedef enum {
+    kGuiSessionBackbuffer = 0,  // Draw to RAM, Blit copies the changes to the screen
+    kGuiSessionDirect     = 1,  // Draw straight to VRAM while the session is shown, Blit is a no-op
+} GuiSessionMode;
+
+// Blits with more damage rectangles copy the whole screen instead
+enum { kGuiMaxDamageRects = 32 };
+
+// Changed area of the session buffer or the area of the screen showing it, in pixels
+typedef struct {
+    u32 x;
+    u32 y;
+    u32 width;
+    u32 height;
+} GuiRect;
+
+// Reported by every blit, a hidden session may stop drawing until it is shown again
+typedef enum {
+    kGuiSessionHidden  = 0,  // Fully covered by other sessions, blits do not reach the screen
+    kGuiSessionVisible = 1,
+} GuiSessionVisibility;
+
+// Presentation statistics of a session, reported by WaitFrame
+typedef struct {
+    u64 presented;        // Frames that reached the screen
+    u64 dropped;          // Frames replaced by a newer blit or hidden before they were presented
+    u64 last_latency_ns;  // From the blit to the present of the last frame
+    u64 max_latency_ns;
+    u64 present_time_ns;  // System lifetime of the last present
+} GuiFrameStats;
+
 #endif  // LIBS_LIBC_SRC_INCLUDE_ALKOS_VIDEO_H_
@@ -0,0 +1,37 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025-2026 The AlkOS Authors
+// See the AUTHORS file for the full list of contributors.
+
+#ifndef LIBS_LIBC_SRC_INCLUDE_MALLOC_H_
+#define LIBS_LIBC_SRC_INCLUDE_MALLOC_H_
+
+#include <defines.h>
+#include <stddef.h>
+
+BEGIN_DECL_C
+
+// Heap statistics, field meanings follow glibc
+struct mallinfo2 {
+    size_t arena;     // Bytes of the heap range in use by slabs and the block heap
+    size_t ordblks;   // Number of free blocks
+    size_t smblks;    // Unused, always 0
+    size_t hblks;     // Number of direct mappings
+    size_t hblkhd;    // Bytes in direct mappings
+    size_t usmblks;   // Peak number of bytes allocated
+    size_t fsmblks;   // Bytes parked in thread caches
+    size_t uordblks;  // Bytes allocated
+    size_t fordblks;  // Bytes free inside the arena
+    size_t keepcost;  // Releasable bytes at the top of the heap, always 0
+};
+
+struct mallinfo2 mallinfo2(void);
+
+// Print heap statistics to stderr
+void malloc_stats(void);
+
+// Number of bytes usable in the allocation at ptr
+size_t malloc_usable_size(void *ptr);
+
+END_DECL_C
+
+#endif  // LIBS_LIBC_SRC_INCLUDE_MALLOC_H_
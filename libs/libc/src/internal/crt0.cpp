@@ -8,6 +8,7 @@
  */
 
 #include "internal/crt0.hpp"
+#include "internal/memory_routines.hpp"
 #include "internal/stdio.hpp"
 
 BEGIN_DECL_C
@@ -22,6 +23,7 @@ size_t atexit_func_count = 0;
  */
 USED NO_RET SECTION(.text.start) void _start()
 {
+    InitMemoryRoutines();    // Select mem* implementations for this CPU
     InitStdio();             // Initialize standard I/O streams
     InitializeRuntime();     // Initialize runtime and global constructors
     const int res = main();  // Call the user program's main function
@@ -26,6 +26,18 @@ DEFINE_SYSCALL(write, kSysWrite, ssize_t, fd_t, fd, const void *, buf, size_t, c
 DEFINE_SYSCALL(seek, kSysSeek, ssize_t, fd_t, fd, ssize_t, offset, FdSeek, whence)
 DEFINE_SYSCALL(dup, kSysDup, fd_t, fd_t, fd)
 DEFINE_SYSCALL(dup_to, kSysDupTo, fd_t, fd_t, old_fd, fd_t, new_fd)
+DEFINE_SYSCALL(read_v, kSysReadV, ssize_t, fd_t, fd, const IoVec *, iov, size_t, count)
+DEFINE_SYSCALL(write_v, kSysWriteV, ssize_t, fd_t, fd, const IoVec *, iov, size_t, count)
+DEFINE_SYSCALL(pread, kSysPRead, ssize_t, fd_t, fd, void *, buf, size_t, count, u64, offset)
+DEFINE_SYSCALL(
+    pwrite, kSysPWrite, ssize_t, fd_t, fd, const void *, buf, size_t, count, u64, offset
+)
+DEFINE_SYSCALL(pipe, kSysPipe, int, fd_t *, fds, FdOpenFlags, flags)
+DEFINE_SYSCALL(poll, kSysPoll, int, PollFd *, fds, size_t, count, i64, timeout_ns)
+DEFINE_SYSCALL(splice, kSysSplice, ssize_t, fd_t, in_fd, fd_t, out_fd, size_t, count)
+DEFINE_SYSCALL(
+    send_file, kSysSendFile, ssize_t, fd_t, out_fd, fd_t, in_fd, u64 *, offset, size_t, count
+)
 
 DEFINE_SYSCALL(
     read_directory, kSysReadDirectory, int, const char *, path, DirEntry *, entries, size_t,
@@ -51,11 +63,39 @@ DEFINE_SYSCALL(wait, kWait, int, u64, pid);
 DEFINE_SYSCALL(get_heap_start, kGetHeapAddr, void *);
 
 DEFINE_SYSCALL_VOID(create_graphic_session, kSysCreateGraphicSession, GuiBufferInfo *, info)
-DEFINE_SYSCALL_VOID(blit, kSysBlit)
+DEFINE_SYSCALL(blit, kSysBlit, int, const GuiRect *, rects, size_t, count)
+DEFINE_SYSCALL(set_graphic_session_mode, kSysSetGraphicSessionMode, int, GuiSessionMode, mode)
+DEFINE_SYSCALL(set_graphic_session_frame, kSysSetGraphicSessionFrame, int, GuiRect *, frame)
+DEFINE_SYSCALL(wait_frame, kSysWaitFrame, int, GuiFrameStats *, stats)
 
 /* Input Syscalls */
 DEFINE_SYSCALL(get_key_state, kSysGetKeyState, bool, VirtualKey, vk)
+DEFINE_SYSCALL(
+    read_input_events, kSysReadInputEvents, int, InputEvent *, events, size_t, count, i64,
+    timeout_ns
+)
 
 DEFINE_SYSCALL_VOID(power, kSysPower, PowerAction, action)
 
+/* Memory Syscalls */
+DEFINE_SYSCALL(
+    mmap, kSysMmap, i64, fd_t, fd, u64, offset, size_t, length, MemProtFlags, prot, MemMapFlags,
+    flags
+)
+DEFINE_SYSCALL(munmap, kSysMunmap, int, void *, addr)
+DEFINE_SYSCALL(msync, kSysMsync, int, void *, addr)
+DEFINE_SYSCALL(mmap_anon, kSysMmapAnon, i64, size_t, length, MemProtFlags, prot)
+DEFINE_SYSCALL(mprotect, kSysMprotect, int, void *, addr, MemProtFlags, prot)
+
+DEFINE_SYSCALL(ring_setup, kSysRingSetup, i64)
+DEFINE_SYSCALL(ring_enter, kSysRingEnter, int, u32, count)
+
+DEFINE_SYSCALL(get_syscall_stats, kSysGetSyscallStats, int, SyscallStats *, stats, size_t, count)
+DEFINE_SYSCALL(trace_syscalls, kSysTraceSyscalls, int, u64, pid, bool, enable)
+DEFINE_SYSCALL(
+    read_syscall_trace, kSysReadSyscallTrace, int, u64, pid, SyscallTraceRecord *, records,
+    size_t, count
+)
+DEFINE_SYSCALL_VOID(nop, kSysNop)
+
 #endif  // __ALKOS_KERNEL__
@@ -0,0 +1,24 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025-2026 The AlkOS Authors
+// See the AUTHORS file for the full list of contributors.
+
+#ifndef LIBS_LIBC_SRC_INTERNAL_MEMORY_ROUTINES_HPP_
+#define LIBS_LIBC_SRC_INTERNAL_MEMORY_ROUTINES_HPP_
+
+#include "defines.h"
+#include "types.h"
+
+BEGIN_DECL_C
+
+/**
+ * @brief Select the memcpy/memmove/memset/memcmp tiers for the running CPU using CPUID.
+ *
+ * Until it is called the portable word-sized paths are used, so the mem* functions are usable
+ * from the very first instruction. The kernel calls it right after enabling CPU features,
+ * userspace programs from crt0.
+ */
+void InitMemoryRoutines();
+
+END_DECL_C
+
+#endif  // LIBS_LIBC_SRC_INTERNAL_MEMORY_ROUTINES_HPP_
@@ -343,6 +343,28 @@ size_t fwrite(const void *buf, size_t size, size_t count, FILE *stream)
         return result / size;
     }
 
+    // A fully buffered write that does not fit into the buffer is sent together with the
+    // buffered data in a single vectored write, instead of being copied through the buffer
+    if (stream->flags.buffer_mode == kFdBufferFull &&
+        total_bytes > stream->buffer_size - stream->buffer_pos) {
+        const size_t buffered = stream->buffer_pos;
+        const size_t first    = buffered > 0 ? 0 : 1;
+        const IoVec iov[]     = {
+            {.base = stream->buffer, .length = buffered},
+            {.base = const_cast<byte *>(src), .length = total_bytes},
+        };
+
+        ssize_t result     = WriteFdV(stream->fd, iov + first, 2 - first);
+        stream->buffer_pos = 0;
+        if (result < 0 || static_cast<size_t>(result) < buffered) {
+            stream->flags.error = true;
+            return 0;
+        }
+
+        stream->file_pos += result;
+        return (result - buffered) / size;
+    }
+
     // Buffered write
     while (bytes_written < total_bytes) {
         size_t remaining    = total_bytes - bytes_written;
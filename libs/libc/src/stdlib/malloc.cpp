@@ -4,110 +4,94 @@
 
 #include <string.h>
 
+#include <allocators/size_class_heap.hpp>
+#include <alkos/mem.h>
+#include <alkos/sys/mem.h>
 #include <alkos/sys/proc.h>
+#include <atomic.hpp>
 
 #include "assert.h"
+#include "malloc.h"
+#include "stdio.h"
 #include "stdlib.h"
 
-// Simple malloc implementation
-// https://gist.github.com/mshr-h/9636fa0adcf834103b1b
-
 namespace
 {
-int has_initialized = 0;
-void *managed_memory_start;
-void *last_valid_address;
 
-struct mem_control_block {
-    int is_available;
-    int size;
-};
+// Large objects get their own anonymous mapping so that freeing them returns the frames
+struct MallocPageSource {
+    void *MapLarge(const size_t size)
+    {
+        return MapAnonymous(size, static_cast<MemProtFlags>(kMemProtRead | kMemProtWrite));
+    }
 
-void malloc_init()
-{
-    ASSERT_FALSE(kIsKernel);
-    /* grab the last valid address from the OS */
-    last_valid_address = GetHeapStart();
-    /* we don't have any memory to manage yet, so
-     * just set the beginning to be last_valid_address */
-    managed_memory_start = last_valid_address;
-    /* Okay, we're initialized and ready to go */
-    has_initialized = 1;
-}
-}  // namespace
+    void UnmapLarge(void *ptr, size_t) { static_cast<void>(Unmap(ptr)); }
+};
 
-void *malloc(size_t numbytes)
+class MallocLock
 {
-    /* Holds where we are looking in memory */
-    /* This is the same as current_location, but cast to a memory_control_block */
-    struct mem_control_block *current_location_mcb;
-    /* This is the memory location we will return.
-       It will be set to 0 until we find something suitable */
-
-    /* Initialize if we haven't already done so */
-    if (!has_initialized) {
-        malloc_init();
-    }
-
-    /* The memory we search for has to include the memory
-     * control block, but the user of malloc doesn't need
-     * to know this, so we'll just add it in for them. */
-    numbytes = numbytes + sizeof(mem_control_block);
-
-    /* Set memory_location to 0 until we find a suitable location */
-    void *memory_location = nullptr;
-
-    /* Begin searching at the start of managed memory */
-    void *current_location = managed_memory_start;
-
-    /* Keep going until we have searched all allocated space */
-    while (current_location != last_valid_address) {
-        current_location_mcb = static_cast<mem_control_block *>(current_location);
-        if (current_location_mcb->is_available) {
-            if (current_location_mcb->size >= static_cast<int>(numbytes)) {
-                /* Woohoo! We've found an open, appropriately-size location. */
-                current_location_mcb->is_available = 0;
-                memory_location                    = current_location;
-                break;
+    public:
+    void lock()
+    {
+        while (flag_.test_and_set(std::memory_order_acquire)) {
+            while (flag_.test(std::memory_order_relaxed)) {
+#if defined(__x86_64__) || defined(__i386__)
+                __builtin_ia32_pause();
+#endif
             }
         }
-        /* If we made it here, it's because the current memory
-         * block not suitable, move to the next one */
-        current_location = static_cast<char *>(current_location) + current_location_mcb->size;
     }
 
-    /* If we still don't have a valid location, abort */
-    if (!memory_location) {
-        /* The new memory will be where the last valid * address left off */
-        memory_location = last_valid_address;
-        /* We'll move the last valid address forward * numbytes */
-        last_valid_address = last_valid_address + numbytes;
-        /* We need to initialize the mem_control_block */
-        current_location_mcb               = static_cast<mem_control_block *>(memory_location);
-        current_location_mcb->is_available = 0;
-        current_location_mcb->size         = numbytes;
+    bool try_lock() { return !flag_.test_and_set(std::memory_order_acquire); }
+
+    void unlock() { flag_.clear(std::memory_order_release); }
+
+    private:
+    std::atomic_flag flag_{};
+};
+
+using Heap = allocators::SizeClassHeap<MallocPageSource, MallocLock>;
+
+Heap g_heap;
+MallocLock g_init_lock;
+std::atomic_flag g_initialized{};
+
+Heap &GetHeap()
+{
+    if (g_initialized.test(std::memory_order_acquire)) {
+        return g_heap;
     }
 
-    /* Move the pointer past the mem_control_block */
-    memory_location = static_cast<char *>(memory_location) + sizeof(mem_control_block);
-    return memory_location;
+    g_init_lock.lock();
+    if (!g_initialized.test(std::memory_order_relaxed)) {
+        ASSERT_FALSE(kIsKernel);
+        g_heap.Init(GetHeapStart(), static_cast<size_t>(kMemHeapSize));
+        static_cast<void>(g_initialized.test_and_set(std::memory_order_release));
+    }
+    g_init_lock.unlock();
+    return g_heap;
 }
 
-void free(void *firstbyte)
+}  // namespace
+
+void *malloc(size_t size) { return GetHeap().Allocate(size); }
+
+void free(void *ptr)
 {
-    if (!firstbyte)
+    if (!ptr) {
         return;
-
-    mem_control_block *mcb = reinterpret_cast<mem_control_block *>(
-        static_cast<char *>(firstbyte) - sizeof(struct mem_control_block)
-    );
-    mcb->is_available = 1;
+    }
+    GetHeap().Free(ptr);
 }
 
 void *calloc(size_t nmemb, size_t size)
 {
-    size_t total_size = nmemb * size;
-    void *ptr         = malloc(total_size);
+    if (size != 0 && nmemb > static_cast<size_t>(-1) / size) {
+        return nullptr;
+    }
+
+    const size_t total_size = nmemb * size;
+    void *ptr               = malloc(total_size);
     if (ptr) {
         memset(ptr, 0, total_size);
     }
@@ -123,18 +107,49 @@ void *realloc(void *ptr, size_t size)
         free(ptr);
         return nullptr;
     }
+    return GetHeap().Reallocate(ptr, size);
+}
 
-    void *new_ptr = malloc(size);
-    if (new_ptr) {
-        // Copy old data to new location
-        const mem_control_block *mcb = reinterpret_cast<mem_control_block *>(
-            static_cast<char *>(ptr) - sizeof(struct mem_control_block)
-        );
-        const size_t old_size  = mcb->size - sizeof(struct mem_control_block);
-        const size_t copy_size = (old_size < size) ? old_size : size;
-
-        memcpy(new_ptr, ptr, copy_size);
-        free(ptr);
+size_t malloc_usable_size(void *ptr)
+{
+    if (!ptr) {
+        return 0;
     }
-    return new_ptr;
+    return GetHeap().UsableSize(ptr);
+}
+
+struct mallinfo2 mallinfo2(void)
+{
+    const allocators::SizeClassHeapStats stats = GetHeap().GetStats();
+
+    struct mallinfo2 info{};
+    info.arena    = stats.small_bytes + stats.medium_bytes;
+    info.ordblks  = stats.medium_free_blocks;
+    info.hblks    = stats.mapped_count;
+    info.hblkhd   = stats.mapped_bytes;
+    info.usmblks  = stats.peak_in_use_bytes;
+    info.fsmblks  = stats.thread_cached_bytes;
+    info.uordblks = stats.small_in_use_bytes + stats.medium_in_use_bytes;
+    info.fordblks = info.arena - info.uordblks;
+    return info;
+}
+
+void malloc_stats(void)
+{
+    const allocators::SizeClassHeapStats stats = GetHeap().GetStats();
+
+    fprintf(
+        stderr, "small:  %zu bytes in slabs, %zu in use\n", stats.small_bytes,
+        stats.small_in_use_bytes
+    );
+    fprintf(
+        stderr, "medium: %zu bytes, %zu in use, %zu free in %zu blocks\n", stats.medium_bytes,
+        stats.medium_in_use_bytes, stats.medium_free_bytes, stats.medium_free_blocks
+    );
+    fprintf(stderr, "mapped: %zu bytes in %zu mappings\n", stats.mapped_bytes, stats.mapped_count);
+    fprintf(
+        stderr, "thread caches: %s, %zu bytes cached\n",
+        stats.thread_caches_enabled ? "on" : "off", stats.thread_cached_bytes
+    );
+    fprintf(stderr, "peak in use: %zu bytes\n", stats.peak_in_use_bytes);
 }
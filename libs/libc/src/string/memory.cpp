@@ -3,7 +3,430 @@
 // See the AUTHORS file for the full list of contributors.
 
 #include <stddef.h>
+#include "internal/memory_routines.hpp"
 #include "string.h"
+#include "types.h"
+
+#if defined(__x86_64__)
+#include <cpuid.h>
+#endif
+
+/**
+ * Size tiers:
+ * - up to kSmallSize bytes: a few overlapping unaligned scalar moves, all loads before stores,
+ * - above that: rep movsb/stosb once the size crosses the threshold selected from CPUID
+ *   (ERMS/FSRM), otherwise a block loop finished with one overlapping tail block.
+ *
+ * Block loops use 8 byte words in the kernel and SSE2/AVX2 vectors in userspace, where the
+ * scheduler preserves the vector state of the thread.
+ */
+
+#if defined(__x86_64__) && !defined(__ALKOS_KERNEL_LIBC__)
+#define MEM_USE_VECTORS 1
+#endif
+
+namespace
+{
+// ------------------------------
+// Configuration
+// ------------------------------
+
+static constexpr size_t kSmallSize = 32;
+static constexpr size_t kNever     = static_cast<size_t>(-1);
+
+static constexpr size_t kRepThresholdFsrm   = kSmallSize + 1;
+static constexpr size_t kRepThresholdErms   = 256;
+static constexpr size_t kRepThresholdVector = 2048;
+
+static constexpr u64 kByteSpread = 0x0101010101010101ULL;
+
+struct MemoryRoutinesConfig {
+    size_t rep_movsb_threshold;
+    size_t rep_stosb_threshold;
+    bool avx2;
+};
+
+/* Portable paths until InitMemoryRoutines runs */
+constinit MemoryRoutinesConfig g_config{kNever, kNever, false};
+
+// ------------------------------
+// Unaligned access
+// ------------------------------
+
+typedef u16 UnalignedU16 __attribute__((may_alias, aligned(1)));
+typedef u32 UnalignedU32 __attribute__((may_alias, aligned(1)));
+typedef u64 UnalignedU64 __attribute__((may_alias, aligned(1)));
+
+template <typename T>
+struct UnalignedOf;
+
+template <>
+struct UnalignedOf<u16> {
+    using type = UnalignedU16;
+};
+template <>
+struct UnalignedOf<u32> {
+    using type = UnalignedU32;
+};
+template <>
+struct UnalignedOf<u64> {
+    using type = UnalignedU64;
+};
+
+#if defined(MEM_USE_VECTORS)
+typedef char Vec16 __attribute__((vector_size(16)));
+typedef char Vec32 __attribute__((vector_size(32)));
+typedef Vec16 UnalignedVec16 __attribute__((may_alias, aligned(1)));
+typedef Vec32 UnalignedVec32 __attribute__((may_alias, aligned(1)));
+
+template <>
+struct UnalignedOf<Vec16> {
+    using type = UnalignedVec16;
+};
+template <>
+struct UnalignedOf<Vec32> {
+    using type = UnalignedVec32;
+};
+#endif  // MEM_USE_VECTORS
+
+template <typename T>
+FORCE_INLINE_F typename UnalignedOf<T>::type *As(byte *ptr)
+{
+    return reinterpret_cast<typename UnalignedOf<T>::type *>(ptr);
+}
+
+template <typename T>
+FORCE_INLINE_F const typename UnalignedOf<T>::type *As(const byte *ptr)
+{
+    return reinterpret_cast<const typename UnalignedOf<T>::type *>(ptr);
+}
+
+// ------------------------------
+// Small sizes
+// ------------------------------
+
+template <typename T>
+FORCE_INLINE_F void CopyHeadTail(byte *dest, const byte *src, const size_t n)
+{
+    const T head = *As<T>(src);
+    const T tail = *As<T>(src + n - sizeof(T));
+    *As<T>(dest)                 = head;
+    *As<T>(dest + n - sizeof(T)) = tail;
+}
+
+/* Every load happens before the first store, so overlapping buffers are handled as well */
+FORCE_INLINE_F void CopySmall(byte *dest, const byte *src, const size_t n)
+{
+    if (n >= 16) {
+        const u64 head0 = *As<u64>(src);
+        const u64 head1 = *As<u64>(src + 8);
+        const u64 tail0 = *As<u64>(src + n - 16);
+        const u64 tail1 = *As<u64>(src + n - 8);
+        *As<u64>(dest)          = head0;
+        *As<u64>(dest + 8)      = head1;
+        *As<u64>(dest + n - 16) = tail0;
+        *As<u64>(dest + n - 8)  = tail1;
+    } else if (n >= 8) {
+        CopyHeadTail<u64>(dest, src, n);
+    } else if (n >= 4) {
+        CopyHeadTail<u32>(dest, src, n);
+    } else if (n >= 2) {
+        CopyHeadTail<u16>(dest, src, n);
+    } else if (n == 1) {
+        *dest = *src;
+    }
+}
+
+FORCE_INLINE_F void SetSmall(byte *dest, const u64 pattern, const size_t n)
+{
+    if (n >= 16) {
+        *As<u64>(dest)          = pattern;
+        *As<u64>(dest + 8)      = pattern;
+        *As<u64>(dest + n - 16) = pattern;
+        *As<u64>(dest + n - 8)  = pattern;
+    } else if (n >= 8) {
+        *As<u64>(dest)         = pattern;
+        *As<u64>(dest + n - 8) = pattern;
+    } else if (n >= 4) {
+        *As<u32>(dest)         = static_cast<u32>(pattern);
+        *As<u32>(dest + n - 4) = static_cast<u32>(pattern);
+    } else if (n >= 2) {
+        *As<u16>(dest)         = static_cast<u16>(pattern);
+        *As<u16>(dest + n - 2) = static_cast<u16>(pattern);
+    } else if (n == 1) {
+        *dest = static_cast<byte>(pattern);
+    }
+}
+
+// ------------------------------
+// Block loops, n >= sizeof(Block)
+// ------------------------------
+
+/* Safe for overlapping buffers with dest < src */
+template <typename Block>
+FORCE_INLINE_F void CopyForward(byte *dest, const byte *src, const size_t n)
+{
+    static constexpr size_t kSize = sizeof(Block);
+
+    const Block tail = *As<Block>(src + n - kSize);
+    for (size_t i = 0; i + kSize < n; i += kSize) {
+        *As<Block>(dest + i) = *As<Block>(src + i);
+    }
+    *As<Block>(dest + n - kSize) = tail;
+}
+
+/* Safe for overlapping buffers with dest > src */
+template <typename Block>
+FORCE_INLINE_F void CopyBackward(byte *dest, const byte *src, const size_t n)
+{
+    static constexpr size_t kSize = sizeof(Block);
+
+    const Block head = *As<Block>(src);
+    for (size_t i = n; i > kSize; i -= kSize) {
+        *As<Block>(dest + i - kSize) = *As<Block>(src + i - kSize);
+    }
+    *As<Block>(dest) = head;
+}
+
+template <typename Block>
+FORCE_INLINE_F void Fill(byte *dest, const Block &pattern, const size_t n)
+{
+    static constexpr size_t kSize = sizeof(Block);
+
+    for (size_t i = 0; i + kSize < n; i += kSize) {
+        *As<Block>(dest + i) = pattern;
+    }
+    *As<Block>(dest + n - kSize) = pattern;
+}
+
+FORCE_INLINE_F int CompareBytes(const byte *s1, const byte *s2, const size_t n)
+{
+    for (size_t i = 0; i < n; ++i) {
+        if (s1[i] != s2[i]) {
+            return s1[i] < s2[i] ? -1 : 1;
+        }
+    }
+    return 0;
+}
+
+FORCE_INLINE_F int CompareWords(const byte *s1, const byte *s2, const size_t n)
+{
+    size_t i = 0;
+    for (; i + sizeof(u64) <= n; i += sizeof(u64)) {
+        const u64 w1 = *As<u64>(s1 + i);
+        const u64 w2 = *As<u64>(s2 + i);
+        if (w1 != w2) {
+            /* Little endian: the lowest differing bit belongs to the first differing byte */
+            const size_t idx = i + __builtin_ctzll(w1 ^ w2) / 8;
+            return s1[idx] < s2[idx] ? -1 : 1;
+        }
+    }
+    return CompareBytes(s1 + i, s2 + i, n - i);
+}
+
+// ------------------------------
+// Vector loops
+// ------------------------------
+
+#if defined(MEM_USE_VECTORS)
+
+FORCE_INLINE_F int CompareSse2(const byte *s1, const byte *s2, const size_t n)
+{
+    static constexpr u32 kAllEqual = 0xFFFF;
+
+    size_t i = 0;
+    for (; i + sizeof(Vec16) <= n; i += sizeof(Vec16)) {
+        const Vec16 v1 = *As<Vec16>(s1 + i);
+        const Vec16 v2 = *As<Vec16>(s2 + i);
+
+        const u32 mask = static_cast<u32>(__builtin_ia32_pmovmskb128((Vec16)(v1 == v2)));
+        if (mask != kAllEqual) {
+            const size_t idx = i + __builtin_ctz(~mask);
+            return s1[idx] < s2[idx] ? -1 : 1;
+        }
+    }
+    return CompareWords(s1 + i, s2 + i, n - i);
+}
+
+#define AVX2_F __attribute__((target("avx2"))) PREVENT_INLINE
+
+AVX2_F void CopyForwardAvx2(byte *dest, const byte *src, const size_t n)
+{
+    CopyForward<Vec32>(dest, src, n);
+}
+
+AVX2_F void CopyBackwardAvx2(byte *dest, const byte *src, const size_t n)
+{
+    CopyBackward<Vec32>(dest, src, n);
+}
+
+AVX2_F void FillAvx2(byte *dest, const byte value, const size_t n)
+{
+    const Vec32 pattern = Vec32{} + static_cast<char>(value);
+    Fill<Vec32>(dest, pattern, n);
+}
+
+AVX2_F int CompareAvx2(const byte *s1, const byte *s2, const size_t n)
+{
+    static constexpr u32 kAllEqual = 0xFFFFFFFF;
+
+    size_t i = 0;
+    for (; i + sizeof(Vec32) <= n; i += sizeof(Vec32)) {
+        const Vec32 v1 = *As<Vec32>(s1 + i);
+        const Vec32 v2 = *As<Vec32>(s2 + i);
+
+        const u32 mask = static_cast<u32>(__builtin_ia32_pmovmskb256((Vec32)(v1 == v2)));
+        if (mask != kAllEqual) {
+            const size_t idx = i + __builtin_ctz(~mask);
+            return s1[idx] < s2[idx] ? -1 : 1;
+        }
+    }
+    return CompareSse2(s1 + i, s2 + i, n - i);
+}
+
+#undef AVX2_F
+
+#endif  // MEM_USE_VECTORS
+
+// ------------------------------
+// String instructions
+// ------------------------------
+
+#if defined(__x86_64__)
+
+FORCE_INLINE_F void RepMovsb(byte *dest, const byte *src, size_t n)
+{
+    __asm__ volatile("rep movsb" : "+D"(dest), "+S"(src), "+c"(n) : : "memory");
+}
+
+FORCE_INLINE_F void RepStosb(byte *dest, const byte value, size_t n)
+{
+    __asm__ volatile("rep stosb" : "+D"(dest), "+c"(n) : "a"(value) : "memory");
+}
+
+#endif  // __x86_64__
+
+// ------------------------------
+// Tier selection, n > kSmallSize
+// ------------------------------
+
+FORCE_INLINE_F void CopyForwardTiered(byte *dest, const byte *src, const size_t n)
+{
+#if defined(__x86_64__)
+    if (n >= g_config.rep_movsb_threshold) {
+        RepMovsb(dest, src, n);
+        return;
+    }
+#endif
+
+#if defined(MEM_USE_VECTORS)
+    if (g_config.avx2) {
+        CopyForwardAvx2(dest, src, n);
+        return;
+    }
+    CopyForward<Vec16>(dest, src, n);
+#else
+    CopyForward<u64>(dest, src, n);
+#endif
+}
+
+FORCE_INLINE_F void CopyBackwardTiered(byte *dest, const byte *src, const size_t n)
+{
+#if defined(MEM_USE_VECTORS)
+    if (g_config.avx2) {
+        CopyBackwardAvx2(dest, src, n);
+        return;
+    }
+    CopyBackward<Vec16>(dest, src, n);
+#else
+    CopyBackward<u64>(dest, src, n);
+#endif
+}
+
+FORCE_INLINE_F void SetTiered(byte *dest, const byte value, const size_t n)
+{
+#if defined(__x86_64__)
+    if (n >= g_config.rep_stosb_threshold) {
+        RepStosb(dest, value, n);
+        return;
+    }
+#endif
+
+#if defined(MEM_USE_VECTORS)
+    if (g_config.avx2) {
+        FillAvx2(dest, value, n);
+        return;
+    }
+    Fill<Vec16>(dest, Vec16{} + static_cast<char>(value), n);
+#else
+    Fill<u64>(dest, kByteSpread * value, n);
+#endif
+}
+
+FORCE_INLINE_F int CompareTiered(const byte *s1, const byte *s2, const size_t n)
+{
+#if defined(MEM_USE_VECTORS)
+    if (g_config.avx2) {
+        return CompareAvx2(s1, s2, n);
+    }
+    return CompareSse2(s1, s2, n);
+#else
+    return CompareWords(s1, s2, n);
+#endif
+}
+
+}  // namespace
+
+// ------------------------------
+// Initialization
+// ------------------------------
+
+void InitMemoryRoutines()
+{
+#if defined(__x86_64__)
+    static constexpr u32 kCpuidEbxAvx2 = 1 << 5;
+    static constexpr u32 kCpuidEbxErms = 1 << 9;
+
+    u32 eax, ebx, ecx, edx;
+    if (__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx) == 0) {
+        return;
+    }
+
+    const bool erms = (ebx & kCpuidEbxErms) != 0;
+    const bool avx2 = (ebx & kCpuidEbxAvx2) != 0;
+
+#if defined(MEM_USE_VECTORS)
+    static constexpr u32 kCpuidEcxOsxsave = 1 << 27;
+    static constexpr u32 kCpuidEcxAvx     = 1 << 28;
+    static constexpr u32 kXcr0SseAvx      = 0b110;
+
+    /* AVX2 is only usable once the OS has enabled the YMM state in XCR0 */
+    bool ymm_enabled = false;
+    if (__get_cpuid(1, &eax, &ebx, &ecx, &edx) != 0 && (ecx & kCpuidEcxOsxsave) != 0 &&
+        (ecx & kCpuidEcxAvx) != 0) {
+        u32 xcr0_lo, xcr0_hi;
+        __asm__ volatile("xgetbv" : "=a"(xcr0_lo), "=d"(xcr0_hi) : "c"(0));
+        ymm_enabled = (xcr0_lo & kXcr0SseAvx) == kXcr0SseAvx;
+    }
+
+    /* Vector loops beat the rep startup cost up to a few KiB, FSRM only helps below that */
+    g_config.avx2                = avx2 && ymm_enabled;
+    g_config.rep_movsb_threshold = erms ? kRepThresholdVector : kNever;
+    g_config.rep_stosb_threshold = erms ? kRepThresholdVector : kNever;
+#else
+    static constexpr u32 kCpuidEdxFsrm = 1 << 4;
+
+    (void)avx2;
+    const bool fsrm              = (edx & kCpuidEdxFsrm) != 0;
+    g_config.rep_movsb_threshold = fsrm ? kRepThresholdFsrm : (erms ? kRepThresholdErms : kNever);
+    g_config.rep_stosb_threshold = erms ? kRepThresholdErms : kNever;
+#endif  // MEM_USE_VECTORS
+#endif  // __x86_64__
+}
+
+// ------------------------------
+// mem* functions
+// ------------------------------
 
 void *memcpy(void *dest, const void *src, const size_t n)
 {
@@ -11,11 +434,13 @@ void *memcpy(void *dest, const void *src, const size_t n)
         return nullptr;
     }
 
-    auto *d       = static_cast<unsigned char *>(dest);
-    const auto *s = static_cast<const unsigned char *>(src);
+    auto *d       = static_cast<byte *>(dest);
+    const auto *s = static_cast<const byte *>(src);
 
-    for (size_t i = 0; i < n; ++i) {
-        d[i] = s[i];
+    if (n <= kSmallSize) {
+        CopySmall(d, s, n);
+    } else {
+        CopyForwardTiered(d, s, n);
     }
     return dest;
 }
@@ -26,17 +451,18 @@ void *memmove(void *dest, const void *src, const size_t n)
         return nullptr;
     }
 
-    auto *d       = static_cast<unsigned char *>(dest);
-    const auto *s = static_cast<const unsigned char *>(src);
+    auto *d       = static_cast<byte *>(dest);
+    const auto *s = static_cast<const byte *>(src);
 
-    if (d > s) {
-        for (size_t i = n; i > 0; --i) {
-            d[i - 1] = s[i - 1];
-        }
+    const auto d_addr = reinterpret_cast<uptr>(d);
+    const auto s_addr = reinterpret_cast<uptr>(s);
+
+    if (n <= kSmallSize) {
+        CopySmall(d, s, n);
+    } else if (d_addr <= s_addr || d_addr >= s_addr + n) {
+        CopyForwardTiered(d, s, n);
     } else {
-        for (size_t i = 0; i < n; ++i) {
-            d[i] = s[i];
-        }
+        CopyBackwardTiered(d, s, n);
     }
     return dest;
 }
@@ -47,11 +473,13 @@ void *memset(void *dest, const int c, const size_t n)
         return nullptr;
     }
 
-    auto *d = static_cast<unsigned char *>(dest);
-    auto uc = static_cast<unsigned char>(c);
+    auto *d        = static_cast<byte *>(dest);
+    const auto val = static_cast<byte>(c);
 
-    for (size_t i = 0; i < n; ++i) {
-        d[i] = uc;
+    if (n <= kSmallSize) {
+        SetSmall(d, kByteSpread * val, n);
+    } else {
+        SetTiered(d, val, n);
     }
     return dest;
 }
@@ -65,16 +493,5 @@ int memcmp(const void *s1, const void *s2, const size_t n)
         return 0;
     }
 
-    const auto *byte1 = static_cast<const unsigned char *>(s1);
-    const auto *byte2 = static_cast<const unsigned char *>(s2);
-
-    for (size_t i = 0; i < n; ++i) {
-        if (byte1[i] < byte2[i]) {
-            return -1;
-        }
-        if (byte1[i] > byte2[i]) {
-            return 1;
-        }
-    }
-    return 0;
+    return CompareTiered(static_cast<const byte *>(s1), static_cast<const byte *>(s2), n);
 }
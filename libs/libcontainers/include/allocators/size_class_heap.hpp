@@ -0,0 +1,858 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025-2026 The AlkOS Authors
+// See the AUTHORS file for the full list of contributors.
+
+#ifndef LIBS_LIBCONTAINERS_INCLUDE_ALLOCATORS_SIZE_CLASS_HEAP_HPP_
+#define LIBS_LIBCONTAINERS_INCLUDE_ALLOCATORS_SIZE_CLASS_HEAP_HPP_
+
+#include <string.h>
+#include <atomic.hpp>
+#include <defines.hpp>
+
+namespace allocators
+{
+
+struct SizeClassHeapStats {
+    size_t small_bytes;          // Address space taken by slabs
+    size_t small_in_use_bytes;   // Small objects held by callers
+    size_t medium_bytes;         // Address space taken by the medium heap, up to its top
+    size_t medium_in_use_bytes;  // Medium blocks held by callers, headers included
+    size_t medium_free_bytes;    // Free medium blocks below the top
+    size_t medium_free_blocks;
+    size_t mapped_bytes;  // Direct mappings of large objects
+    size_t mapped_count;
+    size_t thread_cached_bytes;  // Small objects parked in thread caches
+    size_t peak_in_use_bytes;
+    bool thread_caches_enabled;
+};
+
+/**
+ * @brief General purpose allocator working inside a reserved, demand paged address range.
+ *
+ * - Small requests (<= kSmallMax) are rounded up to one of kNumClasses size classes and served
+ *   from kSlabSize slabs holding objects of a single class. The slab of an object is found by
+ *   masking its address, so small objects carry no header.
+ * - Medium requests are served by a boundary tag heap: segregated free lists (4 bins per power
+ *   of two) searched best-fit, blocks split on allocation and coalesced with both neighbours
+ *   on free. Memory past the last block (the top) is only touched when the heap grows, and
+ *   freeing the last block gives its space back to the top.
+ * - Large requests (>= kLargeThreshold) are mapped directly through the PageSource. Sources
+ *   that cannot map memory return nullptr and the request falls back to the medium heap.
+ *
+ * The first quarter of the range holds slabs, the rest belongs to the medium heap.
+ *
+ * Small requests go straight to the central slab lists while the heap is uncontended. The first
+ * time a thread finds the central lock taken, thread caches are switched on: threads are told
+ * apart by their stack and keep bounded per class free lists, refilled from and drained to the
+ * central lists in batches.
+ *
+ * @tparam PageSource Provides `void *MapLarge(size_t)`, returning page aligned memory or nullptr,
+ *                    and `void UnmapLarge(void *, size_t)`.
+ * @tparam Lock Provides lock(), try_lock() and unlock().
+ */
+template <typename PageSource, typename Lock>
+class SizeClassHeap
+{
+    public:
+    static constexpr size_t kAlignment      = 16;
+    static constexpr size_t kPageSize       = 4096;
+    static constexpr size_t kSlabSize       = 64 * 1024;
+    static constexpr size_t kSmallMax       = 1024;
+    static constexpr size_t kLargeThreshold = 256 * 1024;
+    static constexpr size_t kNumClasses     = 20;
+
+    private:
+    static constexpr size_t kNumBins          = 128;
+    static constexpr size_t kBinWordBits      = 64;
+    static constexpr size_t kMaxBestFitScan   = 32;
+    static constexpr size_t kNumThreadCaches  = 16;
+    static constexpr size_t kThreadCacheLimit = 64;
+    static constexpr size_t kRefillBatch      = 16;
+    static constexpr size_t kStackKeyShift    = 16;  // User stacks are at least 64 KiB apart
+
+    static constexpr size_t kInUse     = 1 << 0;
+    static constexpr size_t kPrevInUse = 1 << 1;
+    static constexpr size_t kMapped    = 1 << 2;
+    static constexpr size_t kFlagsMask = kAlignment - 1;
+
+    struct FreeObject {
+        FreeObject *next;
+    };
+
+    struct Slab {
+        Slab *next;
+        Slab *prev;
+        FreeObject *free_list;
+        byte *bump;
+        byte *end;
+        u32 used;
+        u16 class_idx;
+        bool in_partial;
+    };
+
+    struct BlockHeader {
+        size_t prev_size;  // Only valid while the previous block is free
+        size_t size_flags;
+    };
+
+    struct FreeBlock : BlockHeader {
+        FreeBlock *next;
+        FreeBlock *prev;
+    };
+
+    struct ThreadCache {
+        Lock lock{};
+        FreeObject *lists[kNumClasses]{};
+        u32 counts[kNumClasses]{};
+        size_t cached_bytes{0};
+    };
+
+    static constexpr size_t AlignUp(const size_t value, const size_t alignment)
+    {
+        return (value + alignment - 1) & ~(alignment - 1);
+    }
+
+    static constexpr size_t kSlabHeaderSize = AlignUp(sizeof(Slab), kAlignment);
+    static constexpr size_t kHeaderSize     = AlignUp(sizeof(BlockHeader), kAlignment);
+    static constexpr size_t kMinBlockSize   = AlignUp(sizeof(FreeBlock), kAlignment);
+
+    static_assert((kSlabSize & (kSlabSize - 1)) == 0, "Slab size must be a power of 2");
+    static_assert(kSmallMax + kSlabHeaderSize <= kSlabSize);
+
+    public:
+    // ------------------------------
+    // Class creation
+    // ------------------------------
+
+    SizeClassHeap()  = default;
+    ~SizeClassHeap() = default;
+
+    SizeClassHeap(const SizeClassHeap &)            = delete;
+    SizeClassHeap &operator=(const SizeClassHeap &) = delete;
+    SizeClassHeap(SizeClassHeap &&)                 = delete;
+    SizeClassHeap &operator=(SizeClassHeap &&)      = delete;
+
+    /**
+     * @brief Hand the heap its address range. Pages are touched in order, starting at the
+     * beginning of the small and medium zones, so the range may be backed on demand.
+     */
+    void Init(void *base, const size_t size, PageSource source = {})
+    {
+        const uptr start = AlignUp(reinterpret_cast<uptr>(base), kSlabSize);
+        const uptr end   = reinterpret_cast<uptr>(base) + size;
+
+        small_base_  = start;
+        small_top_   = start;
+        small_end_   = start + (((end - start) / 4) & ~(kSlabSize - 1));
+        medium_base_ = small_end_;
+        medium_top_  = small_end_;
+        medium_end_  = end & ~(kAlignment - 1);
+        source_      = source;
+    }
+
+    // ------------------------------
+    // Allocation
+    // ------------------------------
+
+    NODISCARD void *Allocate(const size_t size)
+    {
+        if (size <= kSmallMax) {
+            if (void *ptr = AllocateSmall_(ClassIndex(size))) {
+                return ptr;
+            }
+        } else if (size >= kLargeThreshold) {
+            if (void *ptr = AllocateLarge_(size)) {
+                return ptr;
+            }
+        }
+
+        if (size > medium_end_ - medium_base_) {
+            return nullptr;
+        }
+
+        lock_.lock();
+        void *ptr = AllocateMedium_(BlockSizeFor_(size));
+        UpdatePeak_();
+        lock_.unlock();
+        return ptr;
+    }
+
+    void Free(void *ptr)
+    {
+        if (ptr == nullptr) {
+            return;
+        }
+
+        if (IsSmall_(ptr)) {
+            FreeSmall_(ptr);
+            return;
+        }
+
+        lock_.lock();
+        if (IsMedium_(ptr)) {
+            FreeMedium_(HeaderOf_(ptr));
+            lock_.unlock();
+            return;
+        }
+
+        BlockHeader *header   = HeaderOf_(ptr);
+        const size_t map_size = SizeOf_(header);
+        mapped_bytes_ -= map_size;
+        mapped_count_--;
+        lock_.unlock();
+
+        source_.UnmapLarge(header, map_size);
+    }
+
+    /**
+     * @brief Resize an allocation, in place whenever possible: small objects that still fit
+     * their class, medium blocks shrunk by splitting or grown into a free neighbour or the top,
+     * and large mappings with enough slack left.
+     */
+    NODISCARD void *Reallocate(void *ptr, const size_t size)
+    {
+        if (ptr == nullptr) {
+            return Allocate(size);
+        }
+
+        const size_t usable = UsableSize(ptr);
+        if (IsSmall_(ptr)) {
+            if (size <= usable) {
+                return ptr;
+            }
+        } else if (IsMedium_(ptr)) {
+            if (size <= medium_end_ - medium_base_) {
+                lock_.lock();
+                const bool resized = ResizeMedium_(HeaderOf_(ptr), BlockSizeFor_(size));
+                UpdatePeak_();
+                lock_.unlock();
+
+                if (resized) {
+                    return ptr;
+                }
+            }
+        } else if (size <= usable) {
+            return ptr;
+        }
+
+        void *new_ptr = Allocate(size);
+        if (new_ptr == nullptr) {
+            return nullptr;
+        }
+
+        memcpy(new_ptr, ptr, size < usable ? size : usable);
+        Free(ptr);
+        return new_ptr;
+    }
+
+    /**
+     * @brief Number of bytes the caller may use at ptr, at least the requested size.
+     */
+    NODISCARD size_t UsableSize(const void *ptr) const
+    {
+        if (IsSmall_(ptr)) {
+            return ClassSize(SlabOf_(ptr)->class_idx);
+        }
+        return SizeOf_(HeaderOf_(ptr)) - kHeaderSize;
+    }
+
+    // ------------------------------
+    // Size classes
+    // ------------------------------
+
+    /**
+     * @brief 16 byte steps up to 128 bytes, then 4 classes per power of 2 up to kSmallMax.
+     */
+    NODISCARD static constexpr size_t ClassIndex(const size_t size)
+    {
+        if (size <= 128) {
+            return size == 0 ? 0 : (size - 1) / 16;
+        }
+
+        const size_t last = size - 1;
+        const size_t lg   = kBinWordBits - 1 - __builtin_clzll(last);
+        return 8 + (lg - 7) * 4 + ((last - (size_t{1} << lg)) >> (lg - 2));
+    }
+
+    NODISCARD static constexpr size_t ClassSize(const size_t idx)
+    {
+        if (idx < 8) {
+            return (idx + 1) * 16;
+        }
+
+        const size_t base = size_t{128} << ((idx - 8) / 4);
+        return base + ((idx - 8) % 4 + 1) * (base / 4);
+    }
+
+    static_assert(ClassSize(kNumClasses - 1) == kSmallMax);
+    static_assert(ClassIndex(kSmallMax) == kNumClasses - 1);
+
+    // ------------------------------
+    // Statistics
+    // ------------------------------
+
+    NODISCARD SizeClassHeapStats GetStats()
+    {
+        size_t cached = 0;
+        for (ThreadCache &cache : caches_) {
+            cache.lock.lock();
+            cached += cache.cached_bytes;
+            cache.lock.unlock();
+        }
+
+        lock_.lock();
+        SizeClassHeapStats stats{
+            .small_bytes           = small_top_ - small_base_,
+            .small_in_use_bytes    = small_in_use_ - cached,
+            .medium_bytes          = medium_top_ - medium_base_,
+            .medium_in_use_bytes   = medium_in_use_,
+            .medium_free_bytes     = medium_top_ - medium_base_ - medium_in_use_,
+            .medium_free_blocks    = medium_free_blocks_,
+            .mapped_bytes          = mapped_bytes_,
+            .mapped_count          = mapped_count_,
+            .thread_cached_bytes   = cached,
+            .peak_in_use_bytes     = peak_in_use_,
+            .thread_caches_enabled = thread_caches_enabled_.test(std::memory_order_relaxed),
+        };
+        lock_.unlock();
+        return stats;
+    }
+
+    private:
+    // ------------------------------
+    // Small objects
+    // ------------------------------
+
+    void *AllocateSmall_(const size_t cls)
+    {
+        if (!thread_caches_enabled_.test(std::memory_order_relaxed)) {
+            if (lock_.try_lock()) {
+                void *ptr = AllocateFromSlab_(cls);
+                UpdatePeak_();
+                lock_.unlock();
+                return ptr;
+            }
+
+            /* Another thread holds the central lock, from now on small requests use caches */
+            static_cast<void>(thread_caches_enabled_.test_and_set(std::memory_order_relaxed));
+        }
+
+        ThreadCache &cache = LockThreadCache_();
+        if (cache.lists[cls] == nullptr) {
+            RefillCache_(cache, cls);
+        }
+
+        FreeObject *obj = cache.lists[cls];
+        if (obj != nullptr) {
+            cache.lists[cls] = obj->next;
+            cache.counts[cls]--;
+            cache.cached_bytes -= ClassSize(cls);
+        }
+        cache.lock.unlock();
+        return obj;
+    }
+
+    void FreeSmall_(void *ptr)
+    {
+        Slab *slab       = SlabOf_(ptr);
+        const size_t cls = slab->class_idx;
+
+        if (!thread_caches_enabled_.test(std::memory_order_relaxed)) {
+            if (lock_.try_lock()) {
+                FreeToSlab_(slab, ptr);
+                lock_.unlock();
+                return;
+            }
+            static_cast<void>(thread_caches_enabled_.test_and_set(std::memory_order_relaxed));
+        }
+
+        ThreadCache &cache = LockThreadCache_();
+        auto *obj          = static_cast<FreeObject *>(ptr);
+        obj->next          = cache.lists[cls];
+        cache.lists[cls]   = obj;
+        cache.counts[cls]++;
+        cache.cached_bytes += ClassSize(cls);
+
+        if (cache.counts[cls] > kThreadCacheLimit) {
+            DrainCache_(cache, cls, kThreadCacheLimit / 2);
+        }
+        cache.lock.unlock();
+    }
+
+    ThreadCache &LockThreadCache_()
+    {
+        const u64 key = reinterpret_cast<uptr>(__builtin_frame_address(0)) >> kStackKeyShift;
+        const u64 idx = (key * 0x9E3779B97F4A7C15ULL) >> 32;
+
+        ThreadCache &cache = caches_[idx % kNumThreadCaches];
+        cache.lock.lock();
+        return cache;
+    }
+
+    void RefillCache_(ThreadCache &cache, const size_t cls)
+    {
+        lock_.lock();
+        for (size_t i = 0; i < kRefillBatch; ++i) {
+            auto *obj = static_cast<FreeObject *>(AllocateFromSlab_(cls));
+            if (obj == nullptr) {
+                break;
+            }
+
+            obj->next        = cache.lists[cls];
+            cache.lists[cls] = obj;
+            cache.counts[cls]++;
+            cache.cached_bytes += ClassSize(cls);
+        }
+        UpdatePeak_();
+        lock_.unlock();
+    }
+
+    void DrainCache_(ThreadCache &cache, const size_t cls, const size_t keep)
+    {
+        lock_.lock();
+        while (cache.counts[cls] > keep) {
+            FreeObject *obj  = cache.lists[cls];
+            cache.lists[cls] = obj->next;
+            cache.counts[cls]--;
+            cache.cached_bytes -= ClassSize(cls);
+            FreeToSlab_(SlabOf_(obj), obj);
+        }
+        lock_.unlock();
+    }
+
+    void *AllocateFromSlab_(const size_t cls)
+    {
+        Slab *slab = partial_[cls];
+        if (slab == nullptr) {
+            slab = NewSlab_(cls);
+            if (slab == nullptr) {
+                return nullptr;
+            }
+        }
+
+        const size_t size = ClassSize(cls);
+        void *obj;
+        if (slab->free_list != nullptr) {
+            obj             = slab->free_list;
+            slab->free_list = slab->free_list->next;
+        } else {
+            obj = slab->bump;
+            slab->bump += size;
+        }
+        slab->used++;
+        small_in_use_ += size;
+
+        if (slab->free_list == nullptr && slab->bump == slab->end) {
+            UnlinkPartial_(slab);
+        }
+        return obj;
+    }
+
+    void FreeToSlab_(Slab *slab, void *ptr)
+    {
+        const size_t cls = slab->class_idx;
+        auto *obj        = static_cast<FreeObject *>(ptr);
+
+        obj->next       = slab->free_list;
+        slab->free_list = obj;
+        slab->used--;
+        small_in_use_ -= ClassSize(cls);
+
+        if (!slab->in_partial) {
+            LinkPartial_(slab);
+        }
+
+        /* Keep the last partial slab of a class to avoid thrashing on alloc/free pairs */
+        if (slab->used == 0 && (slab->next != nullptr || slab->prev != nullptr)) {
+            UnlinkPartial_(slab);
+            slab->next   = empty_slabs_;
+            empty_slabs_ = slab;
+        }
+    }
+
+    Slab *NewSlab_(const size_t cls)
+    {
+        Slab *slab = empty_slabs_;
+        if (slab != nullptr) {
+            empty_slabs_ = slab->next;
+        } else {
+            if (small_end_ - small_top_ < kSlabSize) {
+                return nullptr;
+            }
+            slab = reinterpret_cast<Slab *>(small_top_);
+            small_top_ += kSlabSize;
+        }
+
+        const size_t size = ClassSize(cls);
+        byte *first       = reinterpret_cast<byte *>(slab) + kSlabHeaderSize;
+
+        slab->free_list = nullptr;
+        slab->bump      = first;
+        slab->end       = first + ((kSlabSize - kSlabHeaderSize) / size) * size;
+        slab->used      = 0;
+        slab->class_idx = static_cast<u16>(cls);
+        slab->next      = nullptr;
+        slab->prev      = nullptr;
+
+        slab->in_partial = false;
+
+        LinkPartial_(slab);
+        return slab;
+    }
+
+    void LinkPartial_(Slab *slab)
+    {
+        Slab *&head = partial_[slab->class_idx];
+
+        slab->prev = nullptr;
+        slab->next = head;
+        if (head != nullptr) {
+            head->prev = slab;
+        }
+        head             = slab;
+        slab->in_partial = true;
+    }
+
+    void UnlinkPartial_(Slab *slab)
+    {
+        if (slab->prev != nullptr) {
+            slab->prev->next = slab->next;
+        } else {
+            partial_[slab->class_idx] = slab->next;
+        }
+        if (slab->next != nullptr) {
+            slab->next->prev = slab->prev;
+        }
+
+        slab->next       = nullptr;
+        slab->prev       = nullptr;
+        slab->in_partial = false;
+    }
+
+    NODISCARD FORCE_INLINE_F bool IsSmall_(const void *ptr) const
+    {
+        const auto addr = reinterpret_cast<uptr>(ptr);
+        return addr >= small_base_ && addr < small_end_;
+    }
+
+    NODISCARD FORCE_INLINE_F static Slab *SlabOf_(const void *ptr)
+    {
+        return reinterpret_cast<Slab *>(reinterpret_cast<uptr>(ptr) & ~(kSlabSize - 1));
+    }
+
+    // ------------------------------
+    // Medium blocks
+    // ------------------------------
+
+    NODISCARD FORCE_INLINE_F static size_t BlockSizeFor_(const size_t size)
+    {
+        const size_t block = AlignUp(size + kHeaderSize, kAlignment);
+        return block < kMinBlockSize ? kMinBlockSize : block;
+    }
+
+    void *AllocateMedium_(const size_t size)
+    {
+        FreeBlock *block = FindFree_(size);
+        if (block == nullptr) {
+            if (medium_end_ - medium_top_ < size) {
+                return nullptr;
+            }
+
+            auto *header       = reinterpret_cast<BlockHeader *>(medium_top_);
+            header->size_flags = size | kInUse | kPrevInUse;
+            medium_top_ += size;
+            medium_in_use_ += size;
+            return PayloadOf_(header);
+        }
+
+        UnlinkFree_(block);
+        const size_t block_size = SizeOf_(block);
+
+        if (block_size - size >= kMinBlockSize) {
+            block->size_flags = size | kInUse | kPrevInUse;
+            MakeFree_(BlockAt_(block, size), block_size - size);
+        } else {
+            block->size_flags |= kInUse;
+            BlockAt_(block, block_size)->size_flags |= kPrevInUse;
+        }
+
+        medium_in_use_ += SizeOf_(block);
+        return PayloadOf_(block);
+    }
+
+    void FreeMedium_(BlockHeader *block)
+    {
+        size_t size = SizeOf_(block);
+        medium_in_use_ -= size;
+
+        if ((block->size_flags & kPrevInUse) == 0) {
+            auto *prev = reinterpret_cast<FreeBlock *>(
+                reinterpret_cast<byte *>(block) - block->prev_size
+            );
+            UnlinkFree_(prev);
+            size += SizeOf_(prev);
+            block = prev;
+        }
+
+        BlockHeader *next = BlockAt_(block, size);
+        if (reinterpret_cast<uptr>(next) == medium_top_) {
+            /* Free blocks never border the top, so the previous block is in use */
+            medium_top_ = reinterpret_cast<uptr>(block);
+            return;
+        }
+
+        if ((next->size_flags & kInUse) == 0) {
+            UnlinkFree_(static_cast<FreeBlock *>(next));
+            size += SizeOf_(next);
+        }
+
+        MakeFree_(block, size);
+    }
+
+    /**
+     * @brief Resize a medium block in place, returns false when the block has to move.
+     */
+    bool ResizeMedium_(BlockHeader *block, const size_t size)
+    {
+        const size_t current = SizeOf_(block);
+        const size_t flags   = block->size_flags & kFlagsMask;
+
+        if (size <= current) {
+            if (current - size >= kMinBlockSize) {
+                block->size_flags = size | flags;
+
+                /* Release the tail through the regular path so it coalesces with the next block */
+                BlockHeader *tail = BlockAt_(block, size);
+                tail->size_flags  = (current - size) | kInUse | kPrevInUse;
+                FreeMedium_(tail);
+            }
+            return true;
+        }
+
+        BlockHeader *next = BlockAt_(block, current);
+        if (reinterpret_cast<uptr>(next) == medium_top_) {
+            if (medium_end_ - reinterpret_cast<uptr>(block) < size) {
+                return false;
+            }
+
+            block->size_flags = size | flags;
+            medium_top_       = reinterpret_cast<uptr>(block) + size;
+            medium_in_use_ += size - current;
+            return true;
+        }
+
+        if ((next->size_flags & kInUse) != 0 || current + SizeOf_(next) < size) {
+            return false;
+        }
+
+        UnlinkFree_(static_cast<FreeBlock *>(next));
+        const size_t total = current + SizeOf_(next);
+
+        if (total - size >= kMinBlockSize) {
+            block->size_flags = size | flags;
+            MakeFree_(BlockAt_(block, size), total - size);
+            medium_in_use_ += size - current;
+        } else {
+            block->size_flags = total | flags;
+            BlockAt_(block, total)->size_flags |= kPrevInUse;
+            medium_in_use_ += total - current;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Turn [block, block + size) into a free block whose previous neighbour is in use
+     * and whose next neighbour is an in use block.
+     */
+    void MakeFree_(BlockHeader *block, const size_t size)
+    {
+        block->size_flags = size | kPrevInUse;
+
+        BlockHeader *next = BlockAt_(block, size);
+        next->prev_size   = size;
+        next->size_flags &= ~kPrevInUse;
+
+        LinkFree_(static_cast<FreeBlock *>(block));
+    }
+
+    FreeBlock *FindFree_(const size_t size)
+    {
+        size_t bin = BinIndex_(size);
+
+        /* Blocks of the first bin may be smaller than requested, blocks of later bins fit */
+        while ((bin = NextNonEmptyBin_(bin)) < kNumBins) {
+            FreeBlock *best = nullptr;
+            size_t scanned  = 0;
+
+            for (FreeBlock *block = bins_[bin]; block != nullptr && scanned < kMaxBestFitScan;
+                 block            = block->next, ++scanned) {
+                const size_t block_size = SizeOf_(block);
+                if (block_size < size || (best != nullptr && block_size >= SizeOf_(best))) {
+                    continue;
+                }
+
+                best = block;
+                if (block_size == size) {
+                    break;
+                }
+            }
+
+            if (best != nullptr) {
+                return best;
+            }
+            ++bin;
+        }
+        return nullptr;
+    }
+
+    NODISCARD static size_t BinIndex_(const size_t size)
+    {
+        const size_t lg  = kBinWordBits - 1 - __builtin_clzll(size);
+        const size_t bin = (lg - 5) * 4 + ((size >> (lg - 2)) & 3);
+        return bin < kNumBins ? bin : kNumBins - 1;
+    }
+
+    NODISCARD size_t NextNonEmptyBin_(const size_t bin) const
+    {
+        for (size_t word = bin / kBinWordBits; word < kNumBins / kBinWordBits; ++word) {
+            u64 bits = bin_bitmap_[word];
+            if (word == bin / kBinWordBits) {
+                bits &= ~0ULL << (bin % kBinWordBits);
+            }
+            if (bits != 0) {
+                return word * kBinWordBits + __builtin_ctzll(bits);
+            }
+        }
+        return kNumBins;
+    }
+
+    void LinkFree_(FreeBlock *block)
+    {
+        const size_t bin = BinIndex_(SizeOf_(block));
+
+        block->prev = nullptr;
+        block->next = bins_[bin];
+        if (block->next != nullptr) {
+            block->next->prev = block;
+        }
+        bins_[bin] = block;
+        bin_bitmap_[bin / kBinWordBits] |= 1ULL << (bin % kBinWordBits);
+        medium_free_blocks_++;
+    }
+
+    void UnlinkFree_(FreeBlock *block)
+    {
+        const size_t bin = BinIndex_(SizeOf_(block));
+
+        if (block->prev != nullptr) {
+            block->prev->next = block->next;
+        } else {
+            bins_[bin] = block->next;
+        }
+        if (block->next != nullptr) {
+            block->next->prev = block->prev;
+        }
+        if (bins_[bin] == nullptr) {
+            bin_bitmap_[bin / kBinWordBits] &= ~(1ULL << (bin % kBinWordBits));
+        }
+        medium_free_blocks_--;
+    }
+
+    NODISCARD FORCE_INLINE_F bool IsMedium_(const void *ptr) const
+    {
+        const auto addr = reinterpret_cast<uptr>(ptr);
+        return addr >= medium_base_ && addr < medium_end_;
+    }
+
+    // ------------------------------
+    // Large objects
+    // ------------------------------
+
+    void *AllocateLarge_(const size_t size)
+    {
+        if (size > ~size_t{0} - kHeaderSize - kPageSize) {
+            return nullptr;
+        }
+
+        const size_t map_size = AlignUp(size + kHeaderSize, kPageSize);
+        auto *header          = static_cast<BlockHeader *>(source_.MapLarge(map_size));
+        if (header == nullptr) {
+            return nullptr;
+        }
+        header->prev_size  = 0;
+        header->size_flags = map_size | kInUse | kMapped;
+
+        lock_.lock();
+        mapped_bytes_ += map_size;
+        mapped_count_++;
+        UpdatePeak_();
+        lock_.unlock();
+
+        return PayloadOf_(header);
+    }
+
+    // ------------------------------
+    // Helpers
+    // ------------------------------
+
+    NODISCARD FORCE_INLINE_F static size_t SizeOf_(const BlockHeader *header)
+    {
+        return header->size_flags & ~kFlagsMask;
+    }
+
+    NODISCARD FORCE_INLINE_F static BlockHeader *BlockAt_(BlockHeader *block, const size_t offset)
+    {
+        return reinterpret_cast<BlockHeader *>(reinterpret_cast<byte *>(block) + offset);
+    }
+
+    NODISCARD FORCE_INLINE_F static BlockHeader *HeaderOf_(const void *ptr)
+    {
+        return reinterpret_cast<BlockHeader *>(reinterpret_cast<uptr>(ptr) - kHeaderSize);
+    }
+
+    NODISCARD FORCE_INLINE_F static void *PayloadOf_(BlockHeader *header)
+    {
+        return reinterpret_cast<byte *>(header) + kHeaderSize;
+    }
+
+    FORCE_INLINE_F void UpdatePeak_()
+    {
+        const size_t in_use = small_in_use_ + medium_in_use_ + mapped_bytes_;
+        if (in_use > peak_in_use_) {
+            peak_in_use_ = in_use;
+        }
+    }
+
+    // ------------------------------
+    // Fields
+    // ------------------------------
+
+    Lock lock_{};
+    std::atomic_flag thread_caches_enabled_{};
+    PageSource source_{};
+
+    uptr small_base_{0};
+    uptr small_top_{0};
+    uptr small_end_{0};
+    Slab *partial_[kNumClasses]{};
+    Slab *empty_slabs_{nullptr};
+
+    uptr medium_base_{0};
+    uptr medium_top_{0};
+    uptr medium_end_{0};
+    FreeBlock *bins_[kNumBins]{};
+    u64 bin_bitmap_[kNumBins / kBinWordBits]{};
+
+    size_t small_in_use_{0};
+    size_t medium_in_use_{0};
+    size_t medium_free_blocks_{0};
+    size_t mapped_bytes_{0};
+    size_t mapped_count_{0};
+    size_t peak_in_use_{0};
+
+    ThreadCache caches_[kNumThreadCaches]{};
+};
+
+}  // namespace allocators
+
+#endif  // LIBS_LIBCONTAINERS_INCLUDE_ALLOCATORS_SIZE_CLASS_HEAP_HPP_
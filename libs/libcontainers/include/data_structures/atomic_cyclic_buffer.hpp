@@ -5,6 +5,7 @@
 #ifndef LIBS_LIBCONTAINERS_INCLUDE_DATA_STRUCTURES_ATOMIC_CYCLIC_BUFFER_HPP_
 #define LIBS_LIBCONTAINERS_INCLUDE_DATA_STRUCTURES_ATOMIC_CYCLIC_BUFFER_HPP_
 
+#include <string.h>
 #include <algorithm.hpp>
 #include <array.hpp>
 #include <atomic.hpp>
@@ -60,10 +61,12 @@ class AtomicCyclicBuffer
 
         // We do this BEFORE updating the write_index_ to ensure the consumer
         // doesn't see the new index before the data is valid.
-        for (size_t i = 0; i < to_write; ++i) {
-            buffer_[write_idx & kMask] = data[i];
-            write_idx++;
-        }
+        // The free region wraps at most once, so it is filled in two contiguous segments.
+        const auto pos   = write_idx & kMask;
+        const auto first = std::min(to_write, kSize - pos);
+        Copy_(buffer_.data() + pos, data.data(), first);
+        Copy_(buffer_.data(), data.data() + first, to_write - first);
+        write_idx += to_write;
 
         // memory_order_release guarantees that the data writes above are visible
         // to the consumer before they see the updated index.
@@ -99,10 +102,11 @@ class AtomicCyclicBuffer
 
         // We do this BEFORE updating the write_index_ to ensure the consumer
         // doesn't see the new index before the data is valid.
-        for (size_t i = 0; i < to_write; ++i) {
-            buffer_[write_idx & kMask] = std::move(data[i]);
-            write_idx++;
-        }
+        const auto pos   = write_idx & kMask;
+        const auto first = std::min(to_write, kSize - pos);
+        Move_(buffer_.data() + pos, data.data(), first);
+        Move_(buffer_.data(), data.data() + first, to_write - first);
+        write_idx += to_write;
 
         // memory_order_release guarantees that the data writes above are visible
         // to the consumer before they see the updated index.
@@ -130,10 +134,11 @@ class AtomicCyclicBuffer
 
         const auto to_read = std::min(out_buffer.size(), count);
 
-        for (size_t i = 0; i < to_read; ++i) {
-            out_buffer[i] = std::move(buffer_[read_idx & kMask]);
-            read_idx++;
-        }
+        const auto pos   = read_idx & kMask;
+        const auto first = std::min(to_read, kSize - pos);
+        Move_(out_buffer.data(), buffer_.data() + pos, first);
+        Move_(out_buffer.data() + first, buffer_.data(), to_read - first);
+        read_idx += to_read;
 
         // memory_order_release guarantees the producer sees we are done with this memory.
         read_index_.store(read_idx, std::memory_order_release);
@@ -141,6 +146,30 @@ class AtomicCyclicBuffer
         return to_read;
     }
 
+    /**
+     * @brief Returns the first contiguous run of readable elements without consuming them.
+     * Thread-safe for ONE consumer. The run stays valid until it is released with Consume().
+     */
+    NODISCARD std::span<const T> Peek() const
+    {
+        const auto write_idx = write_index_.load(std::memory_order_acquire);
+        const auto read_idx  = read_index_.load(std::memory_order_relaxed);
+
+        const auto pos = read_idx & kMask;
+        return std::span<const T>(
+            buffer_.data() + pos, std::min(write_idx - read_idx, kSize - pos)
+        );
+    }
+
+    /**
+     * @brief Releases the first count elements returned by Peek() back to the producer.
+     */
+    void Consume(const SizeType count)
+    {
+        const auto read_idx = read_index_.load(std::memory_order_relaxed);
+        read_index_.store(read_idx + count, std::memory_order_release);
+    }
+
     NODISCARD SizeType Count() const
     {
         auto w = write_index_.load(std::memory_order_relaxed);
@@ -157,6 +186,32 @@ class AtomicCyclicBuffer
     private:
     static constexpr size_t kMask = kSize - 1;
 
+    static void Copy_(T *dst, const T *src, const size_t count)
+    {
+        if constexpr (std::is_trivially_copyable_v<T>) {
+            if (count != 0) {
+                memcpy(dst, src, count * sizeof(T));
+            }
+        } else {
+            for (size_t i = 0; i < count; ++i) {
+                dst[i] = src[i];
+            }
+        }
+    }
+
+    static void Move_(T *dst, T *src, const size_t count)
+    {
+        if constexpr (std::is_trivially_copyable_v<T>) {
+            if (count != 0) {
+                memcpy(dst, src, count * sizeof(T));
+            }
+        } else {
+            for (size_t i = 0; i < count; ++i) {
+                dst[i] = std::move(src[i]);
+            }
+        }
+    }
+
     // Use cache line alignment to prevent False Sharing between cores.
     // If write_index_ and read_index_ sit on the same cache line,
     // the cores will fight over ownership of that line (cache thrashing).
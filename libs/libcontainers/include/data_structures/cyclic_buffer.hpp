@@ -156,6 +156,47 @@ class CyclicBuffer
         return to_read;
     }
 
+    /**
+     * @brief Copies the oldest elements without consuming them, see Discard().
+     * Thread-safe regarding Multiple Producers/Consumers if LockT is valid.
+     * @return Number of elements actually copied.
+     */
+    SizeType Peek(std::span<T> out_buffer)
+    {
+        static_assert(std::is_copy_assignable_v<T>, "T must be copy assignable to use Peek(T)");
+
+        std::lock_guard guard(lock_);
+
+        const size_t write_idx = write_index_.load(std::memory_order_relaxed);
+        const size_t read_idx  = read_index_.load(std::memory_order_relaxed);
+
+        const SizeType to_read = std::min(out_buffer.size(), write_idx - read_idx);
+
+        for (SizeType i = 0; i < to_read; ++i) {
+            out_buffer[i] = buffer_[(read_idx + i) & kMask];
+        }
+
+        return to_read;
+    }
+
+    /**
+     * @brief Consumes the oldest elements without reading them.
+     * Thread-safe regarding Multiple Producers/Consumers if LockT is valid.
+     * @return Number of elements actually consumed.
+     */
+    SizeType Discard(SizeType count)
+    {
+        std::lock_guard guard(lock_);
+
+        const size_t write_idx = write_index_.load(std::memory_order_relaxed);
+        const size_t read_idx  = read_index_.load(std::memory_order_relaxed);
+
+        const SizeType to_discard = std::min(count, write_idx - read_idx);
+        read_index_.store(read_idx + to_discard, std::memory_order_relaxed);
+
+        return to_discard;
+    }
+
     /**
      * @brief Returns an estimate of the number of elements in the buffer.
      * Wait-Free. No Lock acquired.
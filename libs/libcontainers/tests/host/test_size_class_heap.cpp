@@ -0,0 +1,426 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025-2026 The AlkOS Authors
+// See the AUTHORS file for the full list of contributors.
+
+#include <gtest/gtest.h>
+#include <sys/mman.h>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include <allocators/size_class_heap.hpp>
+
+using namespace allocators;
+
+namespace
+{
+
+struct MmapPageSource {
+    void *MapLarge(const size_t size)
+    {
+        void *ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        return ptr == MAP_FAILED ? nullptr : ptr;
+    }
+
+    void UnmapLarge(void *ptr, const size_t size) { munmap(ptr, size); }
+};
+
+struct NoMapPageSource {
+    void *MapLarge(size_t) { return nullptr; }
+    void UnmapLarge(void *, size_t) {}
+};
+
+template <typename PageSource>
+class HeapFixture : public ::testing::Test
+{
+    public:
+    using Heap = SizeClassHeap<PageSource, std::mutex>;
+
+    protected:
+    static constexpr size_t kRangeSize = 1ULL << 30;
+
+    void SetUp() override
+    {
+        range_ = mmap(
+            nullptr, kRangeSize, PROT_READ | PROT_WRITE,
+            MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0
+        );
+        ASSERT_NE(range_, MAP_FAILED);
+
+        heap_ = std::make_unique<Heap>();
+        heap_->Init(range_, kRangeSize);
+    }
+
+    void TearDown() override
+    {
+        heap_.reset();
+        munmap(range_, kRangeSize);
+    }
+
+    static void Fill(void *ptr, const size_t size, const u8 seed)
+    {
+        auto *bytes = static_cast<u8 *>(ptr);
+        for (size_t i = 0; i < size; ++i) {
+            bytes[i] = static_cast<u8>(seed + i * 7);
+        }
+    }
+
+    static bool Check(const void *ptr, const size_t size, const u8 seed)
+    {
+        const auto *bytes = static_cast<const u8 *>(ptr);
+        for (size_t i = 0; i < size; ++i) {
+            if (bytes[i] != static_cast<u8>(seed + i * 7)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void *range_{nullptr};
+    std::unique_ptr<Heap> heap_;
+};
+
+using SizeClassHeapTest      = HeapFixture<MmapPageSource>;
+using SizeClassHeapNoMapTest = HeapFixture<NoMapPageSource>;
+using TestHeap               = SizeClassHeapTest::Heap;
+
+}  // namespace
+
+// ------------------------------
+// Size classes
+// ------------------------------
+
+TEST(SizeClassHeapClassTest, ClassIndex_GivenEverySmallSize_PicksSmallestFittingClass)
+{
+    for (size_t size = 1; size <= TestHeap::kSmallMax; ++size) {
+        const size_t idx = TestHeap::ClassIndex(size);
+        ASSERT_LT(idx, TestHeap::kNumClasses);
+        ASSERT_GE(TestHeap::ClassSize(idx), size) << "size " << size;
+        if (idx > 0) {
+            ASSERT_LT(TestHeap::ClassSize(idx - 1), size) << "size " << size;
+        }
+        ASSERT_EQ(TestHeap::ClassSize(idx) % TestHeap::kAlignment, 0u);
+    }
+}
+
+// ------------------------------
+// Small objects
+// ------------------------------
+
+TEST_F(SizeClassHeapTest, Small_GivenManyAllocations_ReturnsAlignedDisjointMemory)
+{
+    std::vector<std::pair<void *, size_t>> allocs;
+    for (size_t i = 0; i < 20000; ++i) {
+        const size_t size = 1 + (i * 37) % TestHeap::kSmallMax;
+        void *ptr         = heap_->Allocate(size);
+        ASSERT_NE(ptr, nullptr);
+        ASSERT_EQ(reinterpret_cast<uptr>(ptr) % TestHeap::kAlignment, 0u);
+        ASSERT_GE(heap_->UsableSize(ptr), size);
+
+        Fill(ptr, size, static_cast<u8>(i));
+        allocs.emplace_back(ptr, size);
+    }
+
+    for (size_t i = 0; i < allocs.size(); ++i) {
+        ASSERT_TRUE(Check(allocs[i].first, allocs[i].second, static_cast<u8>(i)));
+        heap_->Free(allocs[i].first);
+    }
+
+    EXPECT_EQ(heap_->GetStats().small_in_use_bytes, 0u);
+}
+
+TEST_F(SizeClassHeapTest, Small_GivenFreedObject_ReusesIt)
+{
+    void *first = heap_->Allocate(48);
+    heap_->Free(first);
+    void *second = heap_->Allocate(40);
+
+    EXPECT_EQ(first, second);
+    heap_->Free(second);
+}
+
+TEST_F(SizeClassHeapTest, Small_GivenEmptiedSlabs_ReusesThemForOtherClasses)
+{
+    std::vector<void *> allocs;
+    for (size_t i = 0; i < 10000; ++i) {
+        allocs.push_back(heap_->Allocate(64));
+    }
+    const size_t slab_bytes = heap_->GetStats().small_bytes;
+
+    for (void *ptr : allocs) {
+        heap_->Free(ptr);
+    }
+    allocs.clear();
+
+    for (size_t i = 0; i < 1000; ++i) {
+        allocs.push_back(heap_->Allocate(512));
+    }
+    EXPECT_EQ(heap_->GetStats().small_bytes, slab_bytes);
+
+    for (void *ptr : allocs) {
+        heap_->Free(ptr);
+    }
+}
+
+// ------------------------------
+// Medium blocks
+// ------------------------------
+
+TEST_F(SizeClassHeapTest, Medium_GivenFreedNeighbours_CoalescesThem)
+{
+    void *a     = heap_->Allocate(4000);
+    void *b     = heap_->Allocate(4000);
+    void *c     = heap_->Allocate(4000);
+    void *guard = heap_->Allocate(4000);
+
+    heap_->Free(a);
+    heap_->Free(c);
+    heap_->Free(b);
+    EXPECT_EQ(heap_->GetStats().medium_free_blocks, 1u);
+
+    void *merged = heap_->Allocate(11000);
+    EXPECT_EQ(merged, a);
+
+    heap_->Free(merged);
+    heap_->Free(guard);
+}
+
+TEST_F(SizeClassHeapTest, Medium_GivenLastBlockFreed_ReturnsSpaceToTop)
+{
+    void *a = heap_->Allocate(10000);
+    void *b = heap_->Allocate(20000);
+    heap_->Free(b);
+    heap_->Free(a);
+
+    const auto stats = heap_->GetStats();
+    EXPECT_EQ(stats.medium_bytes, 0u);
+    EXPECT_EQ(stats.medium_free_blocks, 0u);
+    EXPECT_EQ(stats.medium_in_use_bytes, 0u);
+}
+
+TEST_F(SizeClassHeapTest, Medium_GivenSeveralFits_PicksBestFit)
+{
+    std::vector<void *> keep;
+    void *big   = heap_->Allocate(20000);
+    keep.push_back(heap_->Allocate(2000));
+    void *small = heap_->Allocate(5000);
+    keep.push_back(heap_->Allocate(2000));
+
+    heap_->Free(big);
+    heap_->Free(small);
+
+    EXPECT_EQ(heap_->Allocate(4900), small);
+
+    for (void *ptr : keep) {
+        heap_->Free(ptr);
+    }
+}
+
+// ------------------------------
+// Reallocation
+// ------------------------------
+
+TEST_F(SizeClassHeapTest, Realloc_GivenBlockBelowTop_GrowsInPlace)
+{
+    void *ptr = heap_->Allocate(2000);
+    Fill(ptr, 2000, 3);
+
+    void *grown = heap_->Reallocate(ptr, 100000);
+    EXPECT_EQ(grown, ptr);
+    EXPECT_TRUE(Check(grown, 2000, 3));
+
+    heap_->Free(grown);
+}
+
+TEST_F(SizeClassHeapTest, Realloc_GivenFreeNeighbour_GrowsIntoIt)
+{
+    void *ptr   = heap_->Allocate(2000);
+    void *next  = heap_->Allocate(8000);
+    void *guard = heap_->Allocate(2000);
+    Fill(ptr, 2000, 5);
+    heap_->Free(next);
+
+    void *grown = heap_->Reallocate(ptr, 6000);
+    EXPECT_EQ(grown, ptr);
+    EXPECT_TRUE(Check(grown, 2000, 5));
+
+    /* The rest of the neighbour stays usable */
+    void *rest = heap_->Allocate(3000);
+    EXPECT_GT(rest, grown);
+    EXPECT_LT(rest, guard);
+
+    heap_->Free(rest);
+    heap_->Free(grown);
+    heap_->Free(guard);
+}
+
+TEST_F(SizeClassHeapTest, Realloc_GivenShrink_KeepsAddressAndReleasesTail)
+{
+    void *ptr   = heap_->Allocate(50000);
+    void *guard = heap_->Allocate(2000);
+    Fill(ptr, 1000, 9);
+
+    void *shrunk = heap_->Reallocate(ptr, 1500);
+    EXPECT_EQ(shrunk, ptr);
+    EXPECT_TRUE(Check(shrunk, 1000, 9));
+    EXPECT_EQ(heap_->GetStats().medium_free_blocks, 1u);
+
+    heap_->Free(shrunk);
+    heap_->Free(guard);
+}
+
+TEST_F(SizeClassHeapTest, Realloc_GivenSmallObjectOutgrowingClass_MovesData)
+{
+    void *ptr = heap_->Allocate(100);
+    Fill(ptr, 100, 11);
+
+    EXPECT_EQ(heap_->Reallocate(ptr, 110), ptr);
+
+    void *moved = heap_->Reallocate(ptr, 3000);
+    EXPECT_NE(moved, ptr);
+    EXPECT_TRUE(Check(moved, 100, 11));
+
+    heap_->Free(moved);
+}
+
+// ------------------------------
+// Large objects
+// ------------------------------
+
+TEST_F(SizeClassHeapTest, Large_GivenMappingSource_MapsDirectly)
+{
+    void *ptr = heap_->Allocate(1 << 20);
+    ASSERT_NE(ptr, nullptr);
+    Fill(ptr, 1 << 20, 1);
+
+    auto stats = heap_->GetStats();
+    EXPECT_EQ(stats.mapped_count, 1u);
+    EXPECT_GE(stats.mapped_bytes, 1u << 20);
+    EXPECT_EQ(stats.medium_bytes, 0u);
+
+    heap_->Free(ptr);
+    stats = heap_->GetStats();
+    EXPECT_EQ(stats.mapped_count, 0u);
+    EXPECT_EQ(stats.mapped_bytes, 0u);
+}
+
+TEST_F(SizeClassHeapNoMapTest, Large_GivenSourceWithoutMappings_FallsBackToHeap)
+{
+    void *ptr = heap_->Allocate(1 << 20);
+    ASSERT_NE(ptr, nullptr);
+    Fill(ptr, 1 << 20, 1);
+
+    const auto stats = heap_->GetStats();
+    EXPECT_EQ(stats.mapped_count, 0u);
+    EXPECT_GE(stats.medium_in_use_bytes, 1u << 20);
+
+    heap_->Free(ptr);
+    EXPECT_EQ(heap_->GetStats().medium_bytes, 0u);
+}
+
+// ------------------------------
+// Stress
+// ------------------------------
+
+TEST_F(SizeClassHeapTest, Random_GivenMixedWorkload_KeepsContentsAndAccounting)
+{
+    std::mt19937 rng(1234);
+    std::map<void *, std::pair<size_t, u8>> live;
+
+    for (size_t step = 0; step < 20000; ++step) {
+        const u32 op = rng() % 10;
+        if (op < 5 || live.empty()) {
+            const size_t size = (rng() % 8 == 0) ? rng() % 300000 : rng() % 2048;
+            void *ptr         = heap_->Allocate(size);
+            ASSERT_NE(ptr, nullptr);
+
+            const u8 seed = static_cast<u8>(step);
+            Fill(ptr, size, seed);
+            live[ptr] = {size, seed};
+        } else if (op < 8) {
+            auto it = std::next(live.begin(), rng() % live.size());
+            ASSERT_TRUE(Check(it->first, it->second.first, it->second.second));
+            heap_->Free(it->first);
+            live.erase(it);
+        } else {
+            auto it               = std::next(live.begin(), rng() % live.size());
+            auto [size, seed]     = it->second;
+            const size_t new_size = rng() % 100000;
+            void *ptr             = heap_->Reallocate(it->first, new_size);
+            ASSERT_NE(ptr, nullptr);
+            ASSERT_TRUE(Check(ptr, std::min(size, new_size), seed));
+
+            live.erase(it);
+            Fill(ptr, new_size, seed);
+            live[ptr] = {new_size, seed};
+        }
+    }
+
+    for (auto &[ptr, info] : live) {
+        ASSERT_TRUE(Check(ptr, info.first, info.second));
+        heap_->Free(ptr);
+    }
+
+    const auto stats = heap_->GetStats();
+    EXPECT_EQ(stats.small_in_use_bytes, 0u);
+    EXPECT_EQ(stats.medium_in_use_bytes, 0u);
+    EXPECT_EQ(stats.medium_bytes, 0u);
+    EXPECT_EQ(stats.mapped_bytes, 0u);
+}
+
+TEST_F(SizeClassHeapTest, Threads_GivenConcurrentSmallChurn_KeepsContents)
+{
+    constexpr size_t kThreads = 8;
+    constexpr size_t kRounds  = 20000;
+
+    std::vector<std::thread> threads;
+    std::atomic<bool> failed{false};
+
+    for (size_t t = 0; t < kThreads; ++t) {
+        threads.emplace_back([&, t]() {
+            std::mt19937 rng(static_cast<u32>(t));
+            std::vector<std::pair<void *, size_t>> mine;
+
+            for (size_t i = 0; i < kRounds; ++i) {
+                if (mine.size() < 64 && (rng() % 3 != 0 || mine.empty())) {
+                    const size_t size = 1 + rng() % (2 * TestHeap::kSmallMax);
+                    void *ptr         = heap_->Allocate(size);
+                    if (ptr == nullptr) {
+                        failed = true;
+                        return;
+                    }
+                    Fill(ptr, size, static_cast<u8>(t));
+                    mine.emplace_back(ptr, size);
+                } else {
+                    const size_t idx = rng() % mine.size();
+                    if (!Check(mine[idx].first, mine[idx].second, static_cast<u8>(t))) {
+                        failed = true;
+                    }
+                    heap_->Free(mine[idx].first);
+                    mine[idx] = mine.back();
+                    mine.pop_back();
+                }
+            }
+
+            for (auto &[ptr, size] : mine) {
+                if (!Check(ptr, size, static_cast<u8>(t))) {
+                    failed = true;
+                }
+                heap_->Free(ptr);
+            }
+        });
+    }
+
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_FALSE(failed);
+
+    const auto stats = heap_->GetStats();
+    EXPECT_EQ(stats.small_in_use_bytes, 0u);
+    EXPECT_EQ(stats.medium_in_use_bytes, 0u);
+}
@@ -22,6 +22,8 @@ struct PACK Color {
     static constexpr Color Blue() { return {0, 0, 255, 255}; }
     static constexpr Color White() { return {255, 255, 255, 255}; }
     static constexpr Color Black() { return {0, 0, 0, 255}; }
+
+    constexpr bool operator==(const Color &) const = default;
 };
 
 struct PixelFormat {
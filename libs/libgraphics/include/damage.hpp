@@ -0,0 +1,44 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025-2026 The AlkOS Authors
+// See the AUTHORS file for the full list of contributors.
+
+#ifndef LIBS_LIBGRAPHICS_INCLUDE_DAMAGE_HPP_
+#define LIBS_LIBGRAPHICS_INCLUDE_DAMAGE_HPP_
+
+#include <types.h>
+#include <array.hpp>
+#include <span.hpp>
+
+#include "geometry.hpp"
+
+namespace Graphics
+{
+
+/**
+ * @brief Areas of a surface changed since the last copy to the screen. Overlapping rectangles
+ * are merged on insertion, so the stored ones never overlap and no pixel is copied twice.
+ * Once full, the list collapses into the bounding box of everything it holds.
+ */
+class DamageList
+{
+    public:
+    static constexpr size_t kCapacity = 32;
+
+    /**
+     * @brief Record a changed area, the caller clips it to the surface beforehand
+     */
+    void Add(Rect rect);
+
+    void Clear() { count_ = 0; }
+
+    NODISCARD std::span<const Rect> GetRects() const { return {rects_.data(), count_}; }
+    NODISCARD bool IsEmpty() const { return count_ == 0; }
+
+    private:
+    std::array<Rect, kCapacity> rects_{};
+    size_t count_{0};
+};
+
+}  // namespace Graphics
+
+#endif  // LIBS_LIBGRAPHICS_INCLUDE_DAMAGE_HPP_
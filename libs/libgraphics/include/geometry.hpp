@@ -6,6 +6,7 @@
 #define LIBS_LIBGRAPHICS_INCLUDE_GEOMETRY_HPP_
 
 #include <types.h>
+#include <algorithm.hpp>
 #include <string.hpp>
 
 namespace Graphics
@@ -23,6 +24,73 @@ struct Rect {
     i32 h;
 };
 
+NODISCARD constexpr bool IsEmpty(const Rect &r) { return r.w <= 0 || r.h <= 0; }
+
+NODISCARD constexpr bool Overlaps(const Rect &a, const Rect &b)
+{
+    return a.x < b.x + b.w && b.x < a.x + a.w && a.y < b.y + b.h && b.y < a.y + a.h;
+}
+
+NODISCARD constexpr bool Contains(const Rect &outer, const Rect &inner)
+{
+    return inner.x >= outer.x && inner.y >= outer.y && inner.x + inner.w <= outer.x + outer.w &&
+           inner.y + inner.h <= outer.y + outer.h;
+}
+
+/// Common part of both rectangles, empty if they do not overlap
+NODISCARD constexpr Rect Intersect(const Rect &a, const Rect &b)
+{
+    const i32 x = std::max(a.x, b.x);
+    const i32 y = std::max(a.y, b.y);
+    return {x, y, std::min(a.x + a.w, b.x + b.w) - x, std::min(a.y + a.h, b.y + b.h) - y};
+}
+
+/// Smallest rectangle covering both rectangles
+NODISCARD constexpr Rect Union(const Rect &a, const Rect &b)
+{
+    const i32 x = std::min(a.x, b.x);
+    const i32 y = std::min(a.y, b.y);
+    return {x, y, std::max(a.x + a.w, b.x + b.w) - x, std::max(a.y + a.h, b.y + b.h) - y};
+}
+
+/**
+ * @brief Parts of a not covered by b, as up to 4 disjoint rectangles: the full width bands
+ * above and below b, then the pieces left and right of it
+ * @return Number of rectangles written to out
+ */
+NODISCARD constexpr size_t Subtract(const Rect &a, const Rect &b, Rect (&out)[4])
+{
+    if (IsEmpty(a)) {
+        return 0;
+    }
+
+    const Rect common = Intersect(a, b);
+    if (IsEmpty(common)) {
+        out[0] = a;
+        return 1;
+    }
+
+    const i32 a_right      = a.x + a.w;
+    const i32 a_bottom     = a.y + a.h;
+    const i32 common_right = common.x + common.w;
+    const i32 common_bot   = common.y + common.h;
+
+    size_t count = 0;
+    if (common.y > a.y) {
+        out[count++] = {a.x, a.y, a.w, common.y - a.y};
+    }
+    if (common_bot < a_bottom) {
+        out[count++] = {a.x, common_bot, a.w, a_bottom - common_bot};
+    }
+    if (common.x > a.x) {
+        out[count++] = {a.x, common.y, common.x - a.x, common.h};
+    }
+    if (common_right < a_right) {
+        out[count++] = {common_right, common.y, a_right - common_right, common.h};
+    }
+    return count;
+}
+
 struct TextCmd {
     i32 x;
     i32 y;
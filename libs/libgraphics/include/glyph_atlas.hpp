@@ -0,0 +1,89 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025-2026 The AlkOS Authors
+// See the AUTHORS file for the full list of contributors.
+
+#ifndef LIBS_LIBGRAPHICS_INCLUDE_GLYPH_ATLAS_HPP_
+#define LIBS_LIBGRAPHICS_INCLUDE_GLYPH_ATLAS_HPP_
+
+#include <types.h>
+#include <array.hpp>
+#include <span.hpp>
+
+#include "color.hpp"
+#include "font/psf2_font.hpp"
+#include "geometry.hpp"
+#include "native_pixel.hpp"
+#include "surface.hpp"
+
+namespace Graphics
+{
+
+/**
+ * @brief Cache of font glyphs rasterized at a fixed scale. Every glyph is a tile of packed native
+ * pixels, so drawing a character is one row copy per pixel row. Tiles are opaque - the
+ * background is drawn as well.
+ *
+ * Each glyph has a single tile, keyed by the colors it was rasterized with. A tile is rasterized
+ * again only when its glyph is requested in other colors, so switching colors does not drop the
+ * tiles of the other glyphs.
+ * @note This class does not own the tile storage.
+ */
+class GlyphAtlas
+{
+    public:
+    static constexpr size_t kMaxGlyphs = 256;
+
+    /**
+     * @brief Number of pixels the storage has to hold for the font at the given scale
+     */
+    NODISCARD static size_t GetRequiredPixels(const Psf2Font &font, u8 scale);
+
+    /**
+     * @param storage At least GetRequiredPixels() pixels, empty leaves the atlas invalid
+     */
+    GlyphAtlas(
+        const Psf2Font &font, const PixelFormat &format, u8 scale, std::span<NativePixel> storage
+    );
+
+    /**
+     * @brief Change the colors of the tiles returned by GetTile()
+     */
+    void SetColors(Color fg, Color bg);
+
+    /**
+     * @brief Area of GetSurface() holding the glyph in the current colors, rasterized if it is
+     * not cached in them
+     */
+    NODISCARD Rect GetTile(char c);
+
+    NODISCARD const Surface &GetSurface() const { return tiles_; }
+    NODISCARD bool IsValid() const { return tiles_.IsValid(); }
+
+    NODISCARD u32 GetTileWidth() const { return tile_width_; }
+    NODISCARD u32 GetTileHeight() const { return tile_height_; }
+    NODISCARD u8 GetScale() const { return scale_; }
+
+    private:
+    struct TileColors {
+        u32 fg;
+        u32 bg;
+        bool valid;
+    };
+
+    void Rasterize(u32 index, char c);
+
+    const Psf2Font &font_;
+    PixelFormat format_;
+    u8 scale_;
+    u32 tile_width_;
+    u32 tile_height_;
+    Surface tiles_{};
+
+    NativePixel fg_{};
+    NativePixel bg_{};
+    std::array<TileColors, kMaxGlyphs> tile_colors_{};
+};
+
+}  // namespace Graphics
+
+#endif  // LIBS_LIBGRAPHICS_INCLUDE_GLYPH_ATLAS_HPP_
@@ -9,8 +9,10 @@
 #include <span.hpp>
 
 #include "color.hpp"
+#include "damage.hpp"
 #include "font/glyph.hpp"
 #include "geometry.hpp"
+#include "glyph_atlas.hpp"
 #include "native_pixel.hpp"
 #include "surface.hpp"
 
@@ -53,6 +55,28 @@ class Painter
     template <FontType FontT>
     void DrawString(const TextCmd &cmd, const FontT &font);
 
+    /**
+     * @brief Copy the cached tile of the character, cmd.scale has to match the atlas
+     */
+    void DrawChar(const CharCmd &cmd, GlyphAtlas &atlas);
+    void DrawString(const TextCmd &cmd, GlyphAtlas &atlas);
+
+    // -------------------------------------------------------------------------
+    // Damage Tracking
+    // -------------------------------------------------------------------------
+
+    /**
+     * @brief Record an area changed by writing to the target directly, e.g. when scrolling
+     */
+    void AddDamage(Rect r);
+
+    /**
+     * @brief Areas changed by the painter since the last ClearDamage()
+     */
+    NODISCARD const DamageList &GetDamage() const { return damage_; }
+
+    void ClearDamage() { damage_.Clear(); }
+
     // -------------------------------------------------------------------------
     // Accessors
     // -------------------------------------------------------------------------
@@ -61,11 +85,10 @@ class Painter
     NODISCARD const PixelFormat &GetFormat() const { return format_; }
 
     private:
-    void FillScanline(std::span<NativePixel> dest, NativePixel color);
-
     Surface &target_;
     PixelFormat format_;
     NativePixel packed_color_;
+    DamageList damage_{};
 };
 
 }  // namespace Graphics
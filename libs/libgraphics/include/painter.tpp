@@ -25,6 +25,9 @@ void Painter::DrawChar(const CharCmd &cmd, const FontT &font)
         return;
     }
 
+    // Recorded up front, the damage of every set pixel below falls inside it
+    AddDamage({cmd.x, cmd.y, scaled_width, scaled_height});
+
     for (u32 row = 0; row < glyph.height; ++row) {
         const byte *row_data = glyph.buffer + (static_cast<size_t>(row * glyph.stride));
 
@@ -0,0 +1,28 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025-2026 The AlkOS Authors
+// See the AUTHORS file for the full list of contributors.
+
+#ifndef LIBS_LIBGRAPHICS_INCLUDE_PIXEL_OPS_H_
+#define LIBS_LIBGRAPHICS_INCLUDE_PIXEL_OPS_H_
+
+#include <defines.h>
+#include <types.h>
+
+/* C interface of the bulk pixel operations from pixel_ops.hpp, for programs written in C */
+
+BEGIN_DECL_C
+
+/**
+ * @brief Convert an 8 bit indexed image to 32 bit pixels, see Graphics::ExpandIndexed()
+ * @param dest Top left pixel of the destination area
+ * @param dest_pitch Bytes between consecutive destination rows
+ * @param palette 256 pixels already in the framebuffer format
+ */
+void ExpandIndexedPixels(
+    u32 *dest, u32 dest_pitch, const u8 *src, u32 width, u32 height, u32 src_pitch,
+    const u32 *palette, u32 scale
+);
+
+END_DECL_C
+
+#endif  // LIBS_LIBGRAPHICS_INCLUDE_PIXEL_OPS_H_
@@ -0,0 +1,81 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025-2026 The AlkOS Authors
+// See the AUTHORS file for the full list of contributors.
+
+#ifndef LIBS_LIBGRAPHICS_INCLUDE_PIXEL_OPS_HPP_
+#define LIBS_LIBGRAPHICS_INCLUDE_PIXEL_OPS_HPP_
+
+#include <types.h>
+#include <span.hpp>
+
+#include "geometry.hpp"
+#include "native_pixel.hpp"
+#include "surface.hpp"
+
+namespace Graphics
+{
+
+/**
+ * @brief Instruction set used by the bulk pixel operations. The best one supported by the CPU
+ * is selected on first use, the kernel build always runs the scalar code as it does not
+ * preserve the vector state.
+ */
+enum class PixelOpsIsa : u8 {
+    kScalar = 0,
+    kSse2,
+    kAvx2,
+};
+
+NODISCARD PixelOpsIsa GetPixelOpsIsa();
+
+/**
+ * @brief Force a different implementation, e.g. for benchmarks
+ * @return The implementation in use, isa is lowered to the best supported one
+ */
+PixelOpsIsa SetPixelOpsIsa(PixelOpsIsa isa);
+
+// ------------------------------
+// Spans
+// ------------------------------
+
+void FillPixels(std::span<NativePixel> dest, NativePixel color);
+
+/**
+ * @brief dest = src * alpha + dest * (255 - alpha), computed per 8 bit channel
+ * @note The spans must not overlap
+ */
+void BlendPixels(std::span<NativePixel> dest, std::span<const NativePixel> src, u8 alpha);
+
+// ------------------------------
+// Rectangles
+// ------------------------------
+
+/**
+ * @brief Copy src_rect of src to dest with its top left corner at `at`, clipped to both
+ * surfaces. Both may be the same surface, overlapping areas are moved correctly.
+ * @return The area of dest written, empty if nothing was visible
+ */
+Rect CopyRect(Surface &dest, Point at, const Surface &src, Rect src_rect);
+
+/**
+ * @brief Like CopyRect, but blends the pixels into dest with a constant alpha
+ * @note The source and destination areas must not overlap
+ */
+Rect BlendRect(Surface &dest, Point at, const Surface &src, Rect src_rect, u8 alpha);
+
+/**
+ * @brief Convert an 8 bit indexed image to native pixels, each source pixel becomes a
+ * scale x scale block of dest. Dest is only written, so it may be write-combined memory.
+ * @param src_pitch Bytes between consecutive source rows
+ * @param palette 256 native pixels
+ * @param scale 1, 2 or 3
+ * @note The scaled image has to fit into dest at `at`
+ */
+void ExpandIndexed(
+    Surface &dest, Point at, const u8 *src, u32 width, u32 height, u32 src_pitch,
+    std::span<const NativePixel> palette, u32 scale
+);
+
+}  // namespace Graphics
+
+#endif  // LIBS_LIBGRAPHICS_INCLUDE_PIXEL_OPS_HPP_
@@ -36,21 +36,10 @@ class Surface
     // Methods
     // -------------------------------------------------------------------------
 
-    void CopyFrom(const Surface &src)
-    {
-        // TODO: support clipping/scaling
-        ASSERT_EQ(width_, src.width_);
-        ASSERT_EQ(height_, src.height_);
-
-        for (u32 y = 0; y < height_; ++y) {
-            std::span<NativePixel> dest_row      = GetScanline(y);
-            std::span<const NativePixel> src_row = src.GetScanline(y);
-
-            // We use the width for the copy size, not the pitch,
-            // to handle stride differences correctly.
-            memcpy(dest_row.data(), src_row.data(), width_ * sizeof(NativePixel));
-        }
-    }
+    /**
+     * @brief Copy a surface of the same size, see CopyRect() for partial copies
+     */
+    void CopyFrom(const Surface &src);
 
     // -------------------------------------------------------------------------
     // Accessors
@@ -0,0 +1,44 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025-2026 The AlkOS Authors
+// See the AUTHORS file for the full list of contributors.
+
+#include "damage.hpp"
+
+namespace Graphics
+{
+
+void DamageList::Add(Rect rect)
+{
+    if (Graphics::IsEmpty(rect)) {
+        return;
+    }
+
+    size_t i = 0;
+    while (i < count_) {
+        if (Contains(rects_[i], rect)) {
+            // Stored rectangles never overlap, so nothing was merged into rect yet
+            return;
+        }
+
+        if (!Overlaps(rects_[i], rect)) {
+            ++i;
+            continue;
+        }
+
+        // The union may overlap rectangles already checked, start over
+        rect      = Union(rects_[i], rect);
+        rects_[i] = rects_[--count_];
+        i         = 0;
+    }
+
+    if (count_ == kCapacity) {
+        for (size_t j = 0; j < count_; ++j) {
+            rect = Union(rects_[j], rect);
+        }
+        count_ = 0;
+    }
+
+    rects_[count_++] = rect;
+}
+
+}  // namespace Graphics
@@ -0,0 +1,103 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025-2026 The AlkOS Authors
+// See the AUTHORS file for the full list of contributors.
+
+#include "glyph_atlas.hpp"
+
+#include <string.h>
+
+#include "pixel_ops.hpp"
+
+namespace Graphics
+{
+
+size_t GlyphAtlas::GetRequiredPixels(const Psf2Font &font, const u8 scale)
+{
+    const size_t tile_pixels = static_cast<size_t>(font.GetWidth()) * font.GetHeight();
+    return kMaxGlyphs * tile_pixels * scale * scale;
+}
+
+GlyphAtlas::GlyphAtlas(
+    const Psf2Font &font, const PixelFormat &format, const u8 scale,
+    std::span<NativePixel> storage
+)
+    : font_(font),
+      format_(format),
+      scale_(scale),
+      tile_width_(font.GetWidth() * scale),
+      tile_height_(font.GetHeight() * scale)
+{
+    ASSERT_NOT_ZERO(scale_);
+    SetColors(Color::White(), Color::Black());
+
+    if (storage.empty()) {
+        return;
+    }
+
+    R_ASSERT_GE(storage.size(), GetRequiredPixels(font, scale));
+    tiles_ = Surface(
+        storage.data(), tile_width_, tile_height_ * static_cast<u32>(kMaxGlyphs),
+        tile_width_ * static_cast<u32>(sizeof(NativePixel))
+    );
+}
+
+void GlyphAtlas::SetColors(const Color fg, const Color bg)
+{
+    fg_ = NativePixel::FromColor(fg, format_);
+    bg_ = NativePixel::FromColor(bg, format_);
+}
+
+Rect GlyphAtlas::GetTile(const char c)
+{
+    ASSERT_TRUE(IsValid());
+
+    const u32 index   = static_cast<u8>(c);
+    TileColors &cache = tile_colors_[index];
+    if (!cache.valid || cache.fg != fg_.value || cache.bg != bg_.value) {
+        Rasterize(index, c);
+        cache = {fg_.value, bg_.value, true};
+    }
+
+    return {
+        0, static_cast<i32>(index * tile_height_), static_cast<i32>(tile_width_),
+        static_cast<i32>(tile_height_)
+    };
+}
+
+void GlyphAtlas::Rasterize(const u32 index, const char c)
+{
+    const Glyph glyph = font_.GetGlyph(c);
+    const u32 top     = index * tile_height_;
+
+    for (u32 row = 0; row < glyph.height; ++row) {
+        const byte *row_data          = glyph.buffer + static_cast<size_t>(row) * glyph.stride;
+        std::span<NativePixel> pixels = tiles_.GetScanline(top + row * scale_);
+
+        // PSF rows are MSB first
+        const auto is_set = [row_data](const u32 col) {
+            return (row_data[col >> 3] & (1 << (7 - (col & 7)))) != 0;
+        };
+
+        // Runs of equal bits become a single fill
+        u32 col = 0;
+        while (col < glyph.width) {
+            u32 end = col + 1;
+            while (end < glyph.width && is_set(end) == is_set(col)) {
+                ++end;
+            }
+
+            FillPixels(pixels.subspan(col * scale_, (end - col) * scale_), is_set(col) ? fg_ : bg_);
+            col = end;
+        }
+
+        // The scaled copies of the row are identical
+        for (u32 copy = 1; copy < scale_; ++copy) {
+            memcpy(
+                tiles_.GetScanline(top + row * scale_ + copy).data(), pixels.data(),
+                pixels.size_bytes()
+            );
+        }
+    }
+}
+
+}  // namespace Graphics
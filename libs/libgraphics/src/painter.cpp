@@ -4,9 +4,10 @@
 
 #include "painter.hpp"
 
-#include <string.h>
 #include <algorithm.hpp>
 
+#include "pixel_ops.hpp"
+
 namespace Graphics
 {
 
@@ -27,21 +28,7 @@ void Painter::DrawPixel(Point p)
         return;
     }
     target_.Pixel(static_cast<u32>(x), static_cast<u32>(y)) = packed_color_;
-}
-
-void Painter::FillScanline(std::span<NativePixel> dest, NativePixel color)
-{
-    u32 raw = color.value;
-
-    // Optimization: If byte pattern is repeating, use memset
-    if ((raw & 0xFF) == ((raw >> 8) & 0xFF) && (raw & 0xFF) == ((raw >> 16) & 0xFF) &&
-        (raw & 0xFF) == ((raw >> 24) & 0xFF)) {
-        memset(dest.data(), raw & 0xFF, dest.size_bytes());
-    } else {
-        for (auto &px : dest) {
-            px = color;
-        }
-    }
+    damage_.Add({x, y, 1, 1});
 }
 
 void Painter::Clear(Color color)
@@ -54,12 +41,14 @@ void Painter::Clear(Color color)
     if (pitch == width * sizeof(NativePixel)) {
         std::span<NativePixel> first_line = target_.GetScanline(0);
         std::span<NativePixel> full_buffer(first_line.data(), width * height);
-        FillScanline(full_buffer, raw);
+        FillPixels(full_buffer, raw);
     } else {
         for (u32 y = 0; y < height; ++y) {
-            FillScanline(target_.GetScanline(y), raw);
+            FillPixels(target_.GetScanline(y), raw);
         }
     }
+
+    damage_.Add({0, 0, static_cast<i32>(width), static_cast<i32>(height)});
 }
 
 void Painter::FillRect(Rect r)
@@ -95,10 +84,46 @@ void Painter::FillRect(Rect r)
 
     for (i32 row = 0; row < h; ++row) {
         std::span<NativePixel> line = target_.GetScanline(static_cast<u32>(y + row));
-        FillScanline(line.subspan(static_cast<size_t>(x), static_cast<size_t>(w)), packed_color_);
+        FillPixels(line.subspan(static_cast<size_t>(x), static_cast<size_t>(w)), packed_color_);
+    }
+
+    damage_.Add({x, y, w, h});
+}
+
+void Painter::DrawChar(const CharCmd &cmd, GlyphAtlas &atlas)
+{
+    ASSERT_EQ(cmd.scale, atlas.GetScale());
+
+    const Rect area = CopyRect(target_, {cmd.x, cmd.y}, atlas.GetSurface(), atlas.GetTile(cmd.c));
+    damage_.Add(area);
+}
+
+void Painter::DrawString(const TextCmd &cmd, GlyphAtlas &atlas)
+{
+    i32 cursor_x = cmd.x;
+    i32 cursor_y = cmd.y;
+
+    for (char c : cmd.text) {
+        if (c == '\n') {
+            cursor_x = cmd.x;
+            cursor_y += static_cast<i32>(atlas.GetTileHeight());
+        } else if (c == '\r') {
+            cursor_x = cmd.x;
+        } else {
+            DrawChar({.x = cursor_x, .y = cursor_y, .c = c, .scale = cmd.scale}, atlas);
+            cursor_x += static_cast<i32>(atlas.GetTileWidth());
+        }
     }
 }
 
+void Painter::AddDamage(Rect r)
+{
+    const Rect bounds{
+        0, 0, static_cast<i32>(target_.GetWidth()), static_cast<i32>(target_.GetHeight())
+    };
+    damage_.Add(Intersect(bounds, r));
+}
+
 void Painter::DrawRect(Rect r)
 {
     i32 x = r.x;
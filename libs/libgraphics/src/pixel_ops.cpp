@@ -0,0 +1,574 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025-2026 The AlkOS Authors
+// See the AUTHORS file for the full list of contributors.
+
+#include "pixel_ops.hpp"
+#include "pixel_ops.h"
+
+#include <string.h>
+
+#if defined(__x86_64__)
+#include <cpuid.h>
+#endif
+
+/**
+ * Every operation has a scalar implementation. Userspace builds add SSE2 (always present on
+ * x86_64) and AVX2 loops, selected by CPUID on first use. The kernel sticks to the scalar
+ * code, the scheduler does not preserve the vector state of kernel threads.
+ *
+ * Vector loops finish the last pixels with the scalar code, fills use one overlapping store.
+ */
+
+#if defined(__x86_64__) && !defined(__ALKOS_KERNEL_LIBGRAPHICS__)
+#define GRAPHICS_USE_VECTORS 1
+#endif
+
+namespace Graphics
+{
+namespace
+{
+// ------------------------------
+// Dispatch
+// ------------------------------
+
+struct PixelOpsConfig {
+    bool detected;
+    PixelOpsIsa supported;
+    PixelOpsIsa active;
+};
+
+constinit PixelOpsConfig g_config{false, PixelOpsIsa::kScalar, PixelOpsIsa::kScalar};
+
+PixelOpsIsa DetectIsa()
+{
+#if defined(GRAPHICS_USE_VECTORS)
+    static constexpr u32 kCpuidEbxAvx2    = 1 << 5;
+    static constexpr u32 kCpuidEcxOsxsave = 1 << 27;
+    static constexpr u32 kCpuidEcxAvx     = 1 << 28;
+    static constexpr u32 kXcr0SseAvx      = 0b110;
+
+    u32 eax, ebx, ecx, edx;
+    if (__get_cpuid(1, &eax, &ebx, &ecx, &edx) == 0 || (ecx & kCpuidEcxOsxsave) == 0 ||
+        (ecx & kCpuidEcxAvx) == 0) {
+        return PixelOpsIsa::kSse2;
+    }
+
+    /* AVX2 is only usable once the OS has enabled the YMM state in XCR0 */
+    u32 xcr0_lo, xcr0_hi;
+    __asm__ volatile("xgetbv" : "=a"(xcr0_lo), "=d"(xcr0_hi) : "c"(0));
+    if ((xcr0_lo & kXcr0SseAvx) != kXcr0SseAvx) {
+        return PixelOpsIsa::kSse2;
+    }
+
+    if (__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx) == 0 || (ebx & kCpuidEbxAvx2) == 0) {
+        return PixelOpsIsa::kSse2;
+    }
+    return PixelOpsIsa::kAvx2;
+#else
+    return PixelOpsIsa::kScalar;
+#endif  // GRAPHICS_USE_VECTORS
+}
+
+FORCE_INLINE_F void EnsureDetected()
+{
+    if (g_config.detected) {
+        return;
+    }
+
+    /* Racing threads compute the same values, no lock needed */
+    g_config.supported = DetectIsa();
+    g_config.active    = g_config.supported;
+    g_config.detected  = true;
+}
+
+FORCE_INLINE_F PixelOpsIsa ActiveIsa()
+{
+    EnsureDetected();
+    return g_config.active;
+}
+
+// ------------------------------
+// Scalar
+// ------------------------------
+
+typedef u64 AliasedU64 __attribute__((may_alias));
+
+/* NativePixel is packed, but every pixel buffer is 4 byte aligned in practice */
+FORCE_INLINE_F u32 *AsWords(NativePixel *pixels)
+{
+    void *raw = pixels;
+    return static_cast<u32 *>(raw);
+}
+
+FORCE_INLINE_F const u32 *AsWords(const NativePixel *pixels)
+{
+    const void *raw = pixels;
+    return static_cast<const u32 *>(raw);
+}
+
+FORCE_INLINE_F u8 BlendChannel(const u32 src, const u32 dest, const u32 alpha)
+{
+    /* Rounded (src * alpha + dest * (255 - alpha)) / 255 without a division */
+    const u32 t = src * alpha + dest * (255 - alpha) + 128;
+    return static_cast<u8>((t + (t >> 8)) >> 8);
+}
+
+void FillScalar(u32 *dest, size_t count, const u32 value)
+{
+    if (count > 0 && reinterpret_cast<uptr>(dest) % sizeof(u64) != 0) {
+        *dest++ = value;
+        --count;
+    }
+
+    const u64 pattern = (static_cast<u64>(value) << 32) | value;
+    auto *words       = reinterpret_cast<AliasedU64 *>(dest);
+    for (size_t i = 0; i < count / 2; ++i) {
+        words[i] = pattern;
+    }
+
+    if (count % 2 != 0) {
+        dest[count - 1] = value;
+    }
+}
+
+void BlendScalar(u8 *dest, const u8 *src, const size_t size, const u8 alpha)
+{
+    for (size_t i = 0; i < size; ++i) {
+        dest[i] = BlendChannel(src[i], dest[i], alpha);
+    }
+}
+
+template <u32 kScale>
+FORCE_INLINE_F void ExpandRowScalar(
+    u32 *const *rows, const u8 *src, const size_t begin, const size_t end, const u32 *palette
+)
+{
+    for (size_t x = begin; x < end; ++x) {
+        const u32 pixel = palette[src[x]];
+        for (u32 row = 0; row < kScale; ++row) {
+            for (u32 col = 0; col < kScale; ++col) {
+                rows[row][x * kScale + col] = pixel;
+            }
+        }
+    }
+}
+
+// ------------------------------
+// Vector loops
+// ------------------------------
+
+#if defined(GRAPHICS_USE_VECTORS)
+
+typedef u32 Px4 __attribute__((vector_size(16)));
+typedef u32 Px8 __attribute__((vector_size(32)));
+typedef u8 Bytes8 __attribute__((vector_size(8)));
+typedef u8 Bytes16 __attribute__((vector_size(16)));
+typedef u8 Bytes32 __attribute__((vector_size(32)));
+typedef u16 Words16 __attribute__((vector_size(32)));
+typedef u16 Words32 __attribute__((vector_size(64)));
+typedef int Idx8 __attribute__((vector_size(32)));
+
+typedef Px4 UnalignedPx4 __attribute__((may_alias, aligned(1)));
+typedef Px8 UnalignedPx8 __attribute__((may_alias, aligned(1)));
+typedef Bytes8 UnalignedBytes8 __attribute__((may_alias, aligned(1)));
+typedef Bytes16 UnalignedBytes16 __attribute__((may_alias, aligned(1)));
+typedef Bytes32 UnalignedBytes32 __attribute__((may_alias, aligned(1)));
+
+template <typename T>
+struct UnalignedOf;
+
+template <>
+struct UnalignedOf<Px4> {
+    using type = UnalignedPx4;
+};
+template <>
+struct UnalignedOf<Px8> {
+    using type = UnalignedPx8;
+};
+template <>
+struct UnalignedOf<Bytes8> {
+    using type = UnalignedBytes8;
+};
+template <>
+struct UnalignedOf<Bytes16> {
+    using type = UnalignedBytes16;
+};
+template <>
+struct UnalignedOf<Bytes32> {
+    using type = UnalignedBytes32;
+};
+
+template <typename T>
+FORCE_INLINE_F typename UnalignedOf<T>::type *As(void *ptr)
+{
+    return reinterpret_cast<typename UnalignedOf<T>::type *>(ptr);
+}
+
+template <typename T>
+FORCE_INLINE_F const typename UnalignedOf<T>::type *As(const void *ptr)
+{
+    return reinterpret_cast<const typename UnalignedOf<T>::type *>(ptr);
+}
+
+template <typename Px>
+FORCE_INLINE_F void FillVector(u32 *dest, const size_t count, const u32 value)
+{
+    static constexpr size_t kLanes = sizeof(Px) / sizeof(u32);
+
+    if (count < kLanes) {
+        FillScalar(dest, count, value);
+        return;
+    }
+
+    const Px pattern = Px{} + value;
+    for (size_t i = 0; i + kLanes < count; i += kLanes) {
+        *As<Px>(dest + i) = pattern;
+    }
+    *As<Px>(dest + count - kLanes) = pattern;
+}
+
+/* Channels are widened to 16 bits, the products of BlendChannel do not fit in 8 */
+template <typename Bytes, typename Words>
+FORCE_INLINE_F void BlendVector(u8 *dest, const u8 *src, const size_t size, const u8 alpha)
+{
+    const Words src_weight  = Words{} + static_cast<u16>(alpha);
+    const Words dest_weight = Words{} + static_cast<u16>(255 - alpha);
+
+    size_t i = 0;
+    for (; i + sizeof(Bytes) <= size; i += sizeof(Bytes)) {
+        const Words s = __builtin_convertvector(*As<Bytes>(src + i), Words);
+        const Words d = __builtin_convertvector(*As<Bytes>(dest + i), Words);
+        const Words t = s * src_weight + d * dest_weight + 128;
+
+        *As<Bytes>(dest + i) = __builtin_convertvector((t + (t >> 8)) >> 8, Bytes);
+    }
+    BlendScalar(dest + i, src + i, size - i, alpha);
+}
+
+/* Repeat every pixel kScale times, out holds kScale vectors of consecutive output pixels */
+template <u32 kScale>
+FORCE_INLINE_F void ScaleLanes(const Px4 &px, Px4 (&out)[kScale])
+{
+    if constexpr (kScale == 1) {
+        out[0] = px;
+    } else if constexpr (kScale == 2) {
+        out[0] = __builtin_shufflevector(px, px, 0, 0, 1, 1);
+        out[1] = __builtin_shufflevector(px, px, 2, 2, 3, 3);
+    } else {
+        out[0] = __builtin_shufflevector(px, px, 0, 0, 0, 1);
+        out[1] = __builtin_shufflevector(px, px, 1, 1, 2, 2);
+        out[2] = __builtin_shufflevector(px, px, 2, 3, 3, 3);
+    }
+}
+
+template <u32 kScale>
+FORCE_INLINE_F void ScaleLanes(const Px8 &px, Px8 (&out)[kScale])
+{
+    if constexpr (kScale == 1) {
+        out[0] = px;
+    } else if constexpr (kScale == 2) {
+        out[0] = __builtin_shufflevector(px, px, 0, 0, 1, 1, 2, 2, 3, 3);
+        out[1] = __builtin_shufflevector(px, px, 4, 4, 5, 5, 6, 6, 7, 7);
+    } else {
+        out[0] = __builtin_shufflevector(px, px, 0, 0, 0, 1, 1, 1, 2, 2);
+        out[1] = __builtin_shufflevector(px, px, 2, 3, 3, 3, 4, 4, 4, 5);
+        out[2] = __builtin_shufflevector(px, px, 5, 5, 6, 6, 6, 7, 7, 7);
+    }
+}
+
+template <typename Px, u32 kScale>
+FORCE_INLINE_F void StoreScaled(u32 *const *rows, const size_t x, const Px &px)
+{
+    static constexpr size_t kLanes = sizeof(Px) / sizeof(u32);
+
+    Px out[kScale];
+    ScaleLanes<kScale>(px, out);
+
+    for (u32 row = 0; row < kScale; ++row) {
+        for (u32 part = 0; part < kScale; ++part) {
+            *As<Px>(rows[row] + x * kScale + part * kLanes) = out[part];
+        }
+    }
+}
+
+template <u32 kScale>
+FORCE_INLINE_F void ExpandRowSse2(
+    u32 *const *rows, const u8 *src, const size_t width, const u32 *palette
+)
+{
+    size_t x = 0;
+    for (; x + 4 <= width; x += 4) {
+        const Px4 px = {
+            palette[src[x]], palette[src[x + 1]], palette[src[x + 2]], palette[src[x + 3]]
+        };
+        StoreScaled<Px4, kScale>(rows, x, px);
+    }
+    ExpandRowScalar<kScale>(rows, src, x, width, palette);
+}
+
+#define AVX2_F __attribute__((target("avx2"))) PREVENT_INLINE
+
+AVX2_F void FillAvx2(u32 *dest, const size_t count, const u32 value)
+{
+    FillVector<Px8>(dest, count, value);
+}
+
+AVX2_F void BlendAvx2(u8 *dest, const u8 *src, const size_t size, const u8 alpha)
+{
+    BlendVector<Bytes32, Words32>(dest, src, size, alpha);
+}
+
+template <u32 kScale>
+AVX2_F void ExpandRowAvx2(u32 *const *rows, const u8 *src, const size_t width, const u32 *palette)
+{
+    const Idx8 all_lanes = Idx8{} - 1;
+    const auto *base     = reinterpret_cast<const int *>(palette);
+
+    size_t x = 0;
+    for (; x + 8 <= width; x += 8) {
+        const Idx8 indices = __builtin_convertvector(*As<Bytes8>(src + x), Idx8);
+        const Px8 px =
+            (Px8)__builtin_ia32_gathersiv8si(Idx8{}, base, indices, all_lanes, sizeof(u32));
+        StoreScaled<Px8, kScale>(rows, x, px);
+    }
+    ExpandRowScalar<kScale>(rows, src, x, width, palette);
+}
+
+#undef AVX2_F
+
+#endif  // GRAPHICS_USE_VECTORS
+
+// ------------------------------
+// Rectangles
+// ------------------------------
+
+/**
+ * @brief Clip a copy of src_rect to `at` against both surfaces
+ * @return Visible area of dest, src_rect is shrunk to the matching source pixels
+ */
+Rect ClipCopy(const Surface &dest, const Point at, const Surface &src, Rect &src_rect)
+{
+    const Rect src_bounds{
+        0, 0, static_cast<i32>(src.GetWidth()), static_cast<i32>(src.GetHeight())
+    };
+    const Rect dest_bounds{
+        0, 0, static_cast<i32>(dest.GetWidth()), static_cast<i32>(dest.GetHeight())
+    };
+
+    const Rect visible = Intersect(src_bounds, src_rect);
+    const Rect area{
+        at.x + visible.x - src_rect.x, at.y + visible.y - src_rect.y, visible.w, visible.h
+    };
+    const Rect clipped = Intersect(dest_bounds, area);
+    if (Graphics::IsEmpty(clipped)) {
+        return {0, 0, 0, 0};
+    }
+
+    src_rect = {
+        visible.x + clipped.x - area.x, visible.y + clipped.y - area.y, clipped.w, clipped.h
+    };
+    return clipped;
+}
+
+template <u32 kScale>
+void ExpandImage(
+    Surface &dest, const Point at, const u8 *src, const u32 width, const u32 height,
+    const u32 src_pitch, const u32 *palette
+)
+{
+    const PixelOpsIsa isa = ActiveIsa();
+
+    for (u32 y = 0; y < height; ++y) {
+        u32 *rows[kScale];
+        for (u32 row = 0; row < kScale; ++row) {
+            const u32 dest_y = static_cast<u32>(at.y) + y * kScale + row;
+            rows[row]        = AsWords(dest.GetScanline(dest_y).data() + at.x);
+        }
+
+        const u8 *line = src + static_cast<size_t>(y) * src_pitch;
+        switch (isa) {
+#if defined(GRAPHICS_USE_VECTORS)
+            case PixelOpsIsa::kAvx2:
+                ExpandRowAvx2<kScale>(rows, line, width, palette);
+                break;
+            case PixelOpsIsa::kSse2:
+                ExpandRowSse2<kScale>(rows, line, width, palette);
+                break;
+#endif  // GRAPHICS_USE_VECTORS
+            default:
+                ExpandRowScalar<kScale>(rows, line, 0, width, palette);
+                break;
+        }
+    }
+}
+
+}  // namespace
+
+// ------------------------------
+// Dispatch
+// ------------------------------
+
+PixelOpsIsa GetPixelOpsIsa() { return ActiveIsa(); }
+
+PixelOpsIsa SetPixelOpsIsa(const PixelOpsIsa isa)
+{
+    EnsureDetected();
+    g_config.active = isa < g_config.supported ? isa : g_config.supported;
+    return g_config.active;
+}
+
+// ------------------------------
+// Spans
+// ------------------------------
+
+void FillPixels(std::span<NativePixel> dest, const NativePixel color)
+{
+    auto *pixels  = AsWords(dest.data());
+    const u32 raw = color.value;
+
+    // A repeating byte pattern is a plain memset, which may use the string instructions
+    if (raw == (raw & 0xFF) * 0x01010101U) {
+        memset(pixels, static_cast<int>(raw & 0xFF), dest.size_bytes());
+        return;
+    }
+
+    switch (ActiveIsa()) {
+#if defined(GRAPHICS_USE_VECTORS)
+        case PixelOpsIsa::kAvx2:
+            FillAvx2(pixels, dest.size(), raw);
+            return;
+        case PixelOpsIsa::kSse2:
+            FillVector<Px4>(pixels, dest.size(), raw);
+            return;
+#endif  // GRAPHICS_USE_VECTORS
+        default:
+            FillScalar(pixels, dest.size(), raw);
+            return;
+    }
+}
+
+void BlendPixels(std::span<NativePixel> dest, std::span<const NativePixel> src, const u8 alpha)
+{
+    ASSERT_EQ(dest.size(), src.size());
+
+    auto *d       = reinterpret_cast<u8 *>(dest.data());
+    const auto *s = reinterpret_cast<const u8 *>(src.data());
+
+    switch (ActiveIsa()) {
+#if defined(GRAPHICS_USE_VECTORS)
+        case PixelOpsIsa::kAvx2:
+            BlendAvx2(d, s, dest.size_bytes(), alpha);
+            return;
+        case PixelOpsIsa::kSse2:
+            BlendVector<Bytes16, Words16>(d, s, dest.size_bytes(), alpha);
+            return;
+#endif  // GRAPHICS_USE_VECTORS
+        default:
+            BlendScalar(d, s, dest.size_bytes(), alpha);
+            return;
+    }
+}
+
+// ------------------------------
+// Rectangles
+// ------------------------------
+
+Rect CopyRect(Surface &dest, const Point at, const Surface &src, Rect src_rect)
+{
+    const Rect area = ClipCopy(dest, at, src, src_rect);
+    if (Graphics::IsEmpty(area)) {
+        return area;
+    }
+
+    const size_t row_bytes = static_cast<size_t>(area.w) * sizeof(NativePixel);
+    NativePixel *dest_top  = dest.GetScanline(static_cast<u32>(area.y)).data() + area.x;
+    const NativePixel *src_top =
+        src.GetScanline(static_cast<u32>(src_rect.y)).data() + src_rect.x;
+
+    // Whole packed rows form one block
+    if (dest.GetPitch() == row_bytes && src.GetPitch() == row_bytes) {
+        memmove(dest_top, src_top, row_bytes * static_cast<size_t>(area.h));
+        return area;
+    }
+
+    // Moving down within one surface has to start at the bottom to not overwrite unread rows
+    const bool bottom_up = reinterpret_cast<uptr>(dest_top) > reinterpret_cast<uptr>(src_top);
+    for (i32 i = 0; i < area.h; ++i) {
+        const i32 row = bottom_up ? area.h - 1 - i : i;
+        memmove(
+            dest.GetScanline(static_cast<u32>(area.y + row)).data() + area.x,
+            src.GetScanline(static_cast<u32>(src_rect.y + row)).data() + src_rect.x, row_bytes
+        );
+    }
+    return area;
+}
+
+Rect BlendRect(Surface &dest, const Point at, const Surface &src, Rect src_rect, const u8 alpha)
+{
+    const Rect area = ClipCopy(dest, at, src, src_rect);
+    if (Graphics::IsEmpty(area)) {
+        return area;
+    }
+
+    const auto width = static_cast<size_t>(area.w);
+    for (i32 row = 0; row < area.h; ++row) {
+        const auto dest_row = dest.GetScanline(static_cast<u32>(area.y + row));
+        const auto src_row  = src.GetScanline(static_cast<u32>(src_rect.y + row));
+        BlendPixels(
+            dest_row.subspan(static_cast<size_t>(area.x), width),
+            src_row.subspan(static_cast<size_t>(src_rect.x), width), alpha
+        );
+    }
+    return area;
+}
+
+void ExpandIndexed(
+    Surface &dest, const Point at, const u8 *src, const u32 width, const u32 height,
+    const u32 src_pitch, std::span<const NativePixel> palette, const u32 scale
+)
+{
+    ASSERT_EQ(256_size, palette.size());
+    ASSERT_GE(at.x, 0);
+    ASSERT_GE(at.y, 0);
+    ASSERT_LE(static_cast<u64>(at.x) + static_cast<u64>(width) * scale, dest.GetWidth());
+    ASSERT_LE(static_cast<u64>(at.y) + static_cast<u64>(height) * scale, dest.GetHeight());
+
+    const u32 *colors = AsWords(palette.data());
+    switch (scale) {
+        case 1:
+            ExpandImage<1>(dest, at, src, width, height, src_pitch, colors);
+            return;
+        case 2:
+            ExpandImage<2>(dest, at, src, width, height, src_pitch, colors);
+            return;
+        case 3:
+            ExpandImage<3>(dest, at, src, width, height, src_pitch, colors);
+            return;
+        default:
+            R_FAIL_ALWAYS("Unsupported indexed image scale");
+    }
+}
+
+}  // namespace Graphics
+
+// ------------------------------
+// C interface
+// ------------------------------
+
+void ExpandIndexedPixels(
+    u32 *dest, const u32 dest_pitch, const u8 *src, const u32 width, const u32 height,
+    const u32 src_pitch, const u32 *palette, const u32 scale
+)
+{
+    if (width == 0 || height == 0) {
+        return;
+    }
+
+    Graphics::Surface target(
+        reinterpret_cast<Graphics::NativePixel *>(dest), width * scale, height * scale, dest_pitch
+    );
+    Graphics::ExpandIndexed(
+        target, {0, 0}, src, width, height, src_pitch,
+        {reinterpret_cast<const Graphics::NativePixel *>(palette), 256}, scale
+    );
+}
@@ -0,0 +1,20 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025-2026 The AlkOS Authors
+// See the AUTHORS file for the full list of contributors.
+
+#include "surface.hpp"
+
+#include "pixel_ops.hpp"
+
+namespace Graphics
+{
+
+void Surface::CopyFrom(const Surface &src)
+{
+    ASSERT_EQ(width_, src.width_);
+    ASSERT_EQ(height_, src.height_);
+
+    CopyRect(*this, {0, 0}, src, {0, 0, static_cast<i32>(width_), static_cast<i32>(height_)});
+}
+
+}  // namespace Graphics
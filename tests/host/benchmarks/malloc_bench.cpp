@@ -0,0 +1,242 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025-2026 The AlkOS Authors
+// See the AUTHORS file for the full list of contributors.
+
+// Compares allocators::SizeClassHeap (the libc malloc engine) against the first-fit list it
+// replaced and the host malloc on a few typical workloads. Not registered with CTest:
+//   make bench_malloc && ./bench_malloc
+
+#include <sys/mman.h>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include <allocators/size_class_heap.hpp>
+
+namespace
+{
+
+constexpr size_t kRangeSize = 4ULL << 30;
+
+void *ReserveRange()
+{
+    void *range = mmap(
+        nullptr, kRangeSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE,
+        -1, 0
+    );
+    if (range == MAP_FAILED) {
+        perror("mmap");
+        exit(1);
+    }
+    return range;
+}
+
+struct MmapPageSource {
+    void *MapLarge(const size_t size)
+    {
+        void *ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        return ptr == MAP_FAILED ? nullptr : ptr;
+    }
+
+    void UnmapLarge(void *ptr, const size_t size) { munmap(ptr, size); }
+};
+
+// ------------------------------
+// Allocators under test
+// ------------------------------
+
+class SizeClassAllocator
+{
+    public:
+    static constexpr const char *kName = "size-class";
+
+    SizeClassAllocator() : range_(ReserveRange()) { heap_.Init(range_, kRangeSize); }
+    ~SizeClassAllocator() { munmap(range_, kRangeSize); }
+
+    void *Alloc(const size_t size) { return heap_.Allocate(size); }
+    void *Realloc(void *ptr, const size_t size) { return heap_.Reallocate(ptr, size); }
+    void Free(void *ptr) { heap_.Free(ptr); }
+
+    private:
+    void *range_;
+    allocators::SizeClassHeap<MmapPageSource, std::mutex> heap_;
+};
+
+/* The previous libc malloc: a first-fit scan over every block ever allocated, without splitting
+ * or coalescing. Locked so that the threaded workload is comparable. */
+class FirstFitAllocator
+{
+    struct Header {
+        size_t size;
+        bool available;
+    };
+
+    public:
+    static constexpr const char *kName = "first-fit";
+
+    FirstFitAllocator() : range_(ReserveRange()), start_(static_cast<byte *>(range_)), end_(start_)
+    {
+    }
+    ~FirstFitAllocator() { munmap(range_, kRangeSize); }
+
+    void *Alloc(size_t size)
+    {
+        size = (size + sizeof(Header) + 15) & ~size_t{15};
+
+        std::lock_guard guard(lock_);
+        for (byte *cur = start_; cur != end_; cur += reinterpret_cast<Header *>(cur)->size) {
+            auto *header = reinterpret_cast<Header *>(cur);
+            if (header->available && header->size >= size) {
+                header->available = false;
+                return cur + sizeof(Header);
+            }
+        }
+
+        auto *header = reinterpret_cast<Header *>(end_);
+        *header      = {size, false};
+        end_ += size;
+        return header + 1;
+    }
+
+    void *Realloc(void *ptr, const size_t size)
+    {
+        void *new_ptr         = Alloc(size);
+        const size_t old_size = (static_cast<Header *>(ptr) - 1)->size - sizeof(Header);
+        memcpy(new_ptr, ptr, old_size < size ? old_size : size);
+        Free(ptr);
+        return new_ptr;
+    }
+
+    void Free(void *ptr)
+    {
+        std::lock_guard guard(lock_);
+        (static_cast<Header *>(ptr) - 1)->available = true;
+    }
+
+    private:
+    void *range_;
+    byte *start_;
+    byte *end_;
+    std::mutex lock_;
+};
+
+class HostAllocator
+{
+    public:
+    static constexpr const char *kName = "host";
+
+    void *Alloc(const size_t size) { return malloc(size); }
+    void *Realloc(void *ptr, const size_t size) { return realloc(ptr, size); }
+    void Free(void *ptr) { free(ptr); }
+};
+
+// ------------------------------
+// Workloads
+// ------------------------------
+
+/* Short lived small objects, as produced by strings and container nodes */
+template <typename Allocator>
+void SmallChurn(Allocator &alloc, const u32 seed)
+{
+    std::mt19937 rng(seed);
+    std::vector<void *> live(512, nullptr);
+
+    for (size_t i = 0; i < 400000; ++i) {
+        void *&slot = live[rng() % live.size()];
+        if (slot != nullptr) {
+            alloc.Free(slot);
+        }
+        slot = alloc.Alloc(8 + rng() % 256);
+    }
+    for (void *ptr : live) {
+        if (ptr != nullptr) {
+            alloc.Free(ptr);
+        }
+    }
+}
+
+/* Sizes spread from bytes to hundreds of KiB with a large live set */
+template <typename Allocator>
+void MixedSizes(Allocator &alloc, const u32 seed)
+{
+    std::mt19937 rng(seed);
+    std::vector<void *> live(4096, nullptr);
+
+    for (size_t i = 0; i < 100000; ++i) {
+        void *&slot = live[rng() % live.size()];
+        if (slot != nullptr) {
+            alloc.Free(slot);
+        }
+
+        const u32 kind    = rng() % 100;
+        const size_t size = kind < 80 ? rng() % 1024 : kind < 98 ? rng() % 65536 : rng() % 524288;
+        slot              = alloc.Alloc(size);
+    }
+    for (void *ptr : live) {
+        if (ptr != nullptr) {
+            alloc.Free(ptr);
+        }
+    }
+}
+
+/* Buffers growing one append at a time, as done by vectors and string builders */
+template <typename Allocator>
+void ReallocGrowth(Allocator &alloc, const u32 seed)
+{
+    std::mt19937 rng(seed);
+    for (size_t round = 0; round < 200; ++round) {
+        void *ptr   = nullptr;
+        size_t size = 0;
+        for (size_t step = 0; step < 500; ++step) {
+            size += 16 + rng() % 256;
+            ptr = ptr == nullptr ? alloc.Alloc(size) : alloc.Realloc(ptr, size);
+        }
+        alloc.Free(ptr);
+    }
+}
+
+template <typename Allocator, typename Workload>
+void Run(const char *workload_name, Workload workload, const size_t num_threads)
+{
+    Allocator alloc;
+
+    const auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < num_threads; ++t) {
+        threads.emplace_back([&, t]() {
+            workload(alloc, static_cast<u32>(t + 1));
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    printf(
+        "%-16s %-12s threads=%zu %10.2f ms\n", workload_name, Allocator::kName, num_threads,
+        std::chrono::duration<double, std::milli>(elapsed).count()
+    );
+}
+
+template <typename Allocator>
+void RunAll()
+{
+    Run<Allocator>("small-churn", SmallChurn<Allocator>, 1);
+    Run<Allocator>("mixed-sizes", MixedSizes<Allocator>, 1);
+    Run<Allocator>("realloc-growth", ReallocGrowth<Allocator>, 1);
+    Run<Allocator>("small-churn", SmallChurn<Allocator>, 4);
+}
+
+}  // namespace
+
+int main()
+{
+    RunAll<SizeClassAllocator>();
+    RunAll<HostAllocator>();
+    RunAll<FirstFitAllocator>();
+    return 0;
+}
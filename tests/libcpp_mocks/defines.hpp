@@ -12,7 +12,7 @@
 #include <type_traits>
 #include <utility>
 
-#include "types.h"
+#include "types.hpp"
 
 // ------------------------------
 // Environment checks
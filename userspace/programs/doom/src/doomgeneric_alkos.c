@@ -11,6 +11,7 @@
 #include <time.h>
 
 static GuiBufferInfo BufferInfo;
+static bool s_DrawsToScreen = false;
 
 #define KEYQUEUE_SIZE 16
 
@@ -18,114 +19,8 @@ static unsigned short s_KeyQueue[KEYQUEUE_SIZE];
 static unsigned int s_KeyQueueWriteIndex = 0;
 static unsigned int s_KeyQueueReadIndex  = 0;
 
-// Keys that Doom cares about
-static const VirtualKey s_MonitoredKeys[] = {
-    // Movement
-    VK_ArrowLeft,
-    VK_ArrowRight,
-    VK_ArrowUp,
-    VK_ArrowDown,
-    // Actions
-    VK_Space,
-    VK_LeftCtrl,
-    VK_RightCtrl,
-    VK_LeftAlt,
-    VK_RightAlt,
-    // Menu/System
-    VK_Escape,
-    VK_Enter,
-    VK_Grave,
-    VK_Backspace,
-    // Function keys
-    VK_F1,
-    VK_F2,
-    VK_F3,
-    VK_F4,
-    VK_F5,
-    VK_F6,
-    VK_F7,
-    VK_F8,
-    VK_F9,
-    VK_F10,
-    VK_F11,
-    VK_F12,
-    // Modifiers
-    VK_LeftShift,
-    VK_RightShift,
-    VK_CapsLock,
-    VK_NumLock,
-    VK_ScrollLock,
-    // Navigation
-    VK_Home,
-    VK_End,
-    VK_PageUp,
-    VK_PageDown,
-    VK_Insert,
-    VK_Delete,
-    // Numpad
-    VK_NumPad0,
-    VK_NumPad1,
-    VK_NumPad2,
-    VK_NumPad3,
-    VK_NumPad4,
-    VK_NumPad5,
-    VK_NumPad6,
-    VK_NumPad7,
-    VK_NumPad8,
-    VK_NumPad9,
-    VK_NumPadEnter,
-    VK_NumPadDivide,
-    VK_NumPadMultiply,
-    VK_NumPadAdd,
-    VK_NumPadSubtract,
-    VK_NumPadDecimal,
-    // Special chars
-    VK_Minus,
-    VK_Equal,
-    // Letters (for typing)
-    VK_A,
-    VK_B,
-    VK_C,
-    VK_D,
-    VK_E,
-    VK_F,
-    VK_G,
-    VK_H,
-    VK_I,
-    VK_J,
-    VK_K,
-    VK_L,
-    VK_M,
-    VK_N,
-    VK_O,
-    VK_P,
-    VK_Q,
-    VK_R,
-    VK_S,
-    VK_T,
-    VK_U,
-    VK_V,
-    VK_W,
-    VK_X,
-    VK_Y,
-    VK_Z,
-    // Number row (for typing)
-    VK_Key0,
-    VK_Key1,
-    VK_Key2,
-    VK_Key3,
-    VK_Key4,
-    VK_Key5,
-    VK_Key6,
-    VK_Key7,
-    VK_Key8,
-    VK_Key9,
-};
-
-#define NUM_MONITORED_KEYS (sizeof(s_MonitoredKeys) / sizeof(s_MonitoredKeys[0]))
-
-// Previous state of monitored keys (to detect press/release)
-static bool s_PrevKeyStates[NUM_MONITORED_KEYS] = {0};
+// Held keys repeat their press events, only state changes reach Doom
+static bool s_KeyStates[256] = {0};
 
 // Convert VirtualKey to Doom key
 static unsigned char convertToDoomKey(VirtualKey vk)
@@ -344,6 +239,9 @@ void DG_Init()
         exit(-1);
     }
 
+    // Render straight to the display, frames then need no kernel copy
+    s_DrawsToScreen = __platform_set_graphic_session_mode(kGuiSessionDirect) == 0;
+
     // Set screen dimensions
     DG_ScreenBuffer = (uint32_t *)BufferInfo.buffer_ptr;
     DG_ScreenWidth  = BufferInfo.width;
@@ -351,7 +249,15 @@ void DG_Init()
     // DG_ScreenMode = &mode_scale_2x; // 640x400
 }
 
-void DG_DrawFrame() { __platform_blit(); }
+void DG_DrawFrame()
+{
+    if (!s_DrawsToScreen) {
+        __platform_blit(NULL, 0);
+    }
+
+    // Render no faster than the display refreshes, leaving the CPU to the other sessions
+    __platform_wait_frame(NULL);
+}
 
 void DG_SleepMs(uint32_t ms)
 {
@@ -369,17 +275,17 @@ uint32_t DG_GetTicksMs()
 
 int DG_GetKey(int *pressed, unsigned char *doomKey)
 {
-    // Poll all monitored keys and detect state changes
-    // TODO: Inefficient - better to have an event-driven system
-    for (unsigned int i = 0; i < NUM_MONITORED_KEYS; ++i) {
-        VirtualKey vk     = s_MonitoredKeys[i];
-        bool currentState = GetKeyState(vk);
-
-        // Detect state change
-        if (currentState != s_PrevKeyStates[i]) {
-            // Key state changed
-            addKeyToQueue(currentState ? 1 : 0, vk);
-            s_PrevKeyStates[i] = currentState;
+    // Refill the queue with every event pending in the kernel, one syscall per tic
+    if (s_KeyQueueReadIndex == s_KeyQueueWriteIndex) {
+        InputEvent events[KEYQUEUE_SIZE - 1];
+        const int count = ReadInputEvents(events, KEYQUEUE_SIZE - 1, 0);
+
+        for (int i = 0; i < count; ++i) {
+            const VirtualKey vk = events[i].key;
+            if (s_KeyStates[vk] != events[i].pressed) {
+                s_KeyStates[vk] = events[i].pressed;
+                addKeyToQueue(events[i].pressed ? 1 : 0, vk);
+            }
         }
     }
 
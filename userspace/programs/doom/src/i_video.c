@@ -24,6 +24,7 @@
 
 #include <deh_str.h>
 #include <i_scale.h>
+#include <pixel_ops.h>
 #include <w_wad.h>
 static const char rcsid[] = "$Id: i_x.c,v 1.6 1997/02/03 22:45:10 b1 Exp $";
 
@@ -94,6 +95,10 @@ static struct color colors[256];
 
 #endif  // CMAP256
 
+// Palette packed to the 32 bit framebuffer format
+
+static uint32_t native_palette[256];
+
 void I_GetEvent(void);
 
 // The screen buffer; this is modified to draw things to the screen
@@ -248,9 +253,29 @@ void I_UpdateNoBlit(void) {}
 // I_FinishUpdate
 //
 
+// Integer scale of the selected screen mode, 0 if the frame needs the generic conversion
+
+static int I_NativeScale(void)
+{
+    if (s_Fb.bits_per_pixel != 32) {
+        return 0;
+    }
+
+    if (DG_ScreenMode == &mode_scale_1x) {
+        return 1;
+    }
+    if (DG_ScreenMode == &mode_scale_2x) {
+        return 2;
+    }
+    if (DG_ScreenMode == &mode_scale_3x) {
+        return 3;
+    }
+    return 0;
+}
+
 void I_FinishUpdate(void)
 {
-    int i, k, stride;
+    int i, k, stride, scale;
     struct color c;
     uint16_t p16;
     uint32_t p32;
@@ -258,6 +283,19 @@ void I_FinishUpdate(void)
 
     stride = s_Fb.bits_per_pixel / 8;
 
+    // Scale and convert in one pass, straight from the game buffer to the screen
+    scale = I_NativeScale();
+    if (scale != 0) {
+        line_out = (byte *)DG_ScreenBuffer + (offsetY * DG_ScreenWidth + offsetX) * stride;
+        ExpandIndexedPixels(
+            (uint32_t *)line_out, DG_ScreenWidth * stride, I_VideoBuffer, SCREENWIDTH,
+            SCREENHEIGHT, SCREENWIDTH, native_palette, scale
+        );
+
+        DG_DrawFrame();
+        return;
+    }
+
     /* DRAW SCREEN */
     line_in = (byte *)DG_ScreenBuffer;
     DG_ScreenMode->DrawScreen(0, 0, SCREENWIDTH, SCREENHEIGHT);
@@ -343,6 +381,10 @@ void I_SetPalette(byte *palette)
         colors[i].r = gammatable[usegamma][*palette++];
         colors[i].g = gammatable[usegamma][*palette++];
         colors[i].b = gammatable[usegamma][*palette++];
+
+        native_palette[i] = (colors[i].r << s_Fb.red.offset) |
+                            (colors[i].g << s_Fb.green.offset) |
+                            (colors[i].b << s_Fb.blue.offset);
     }
 
 #ifdef CMAP256
@@ -0,0 +1,108 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025-2026 The AlkOS Authors
+// See the AUTHORS file for the full list of contributors.
+
+#include <stdio.h>
+#include <alkos/sys/time.h>
+#include <pixel_ops.hpp>
+
+using namespace Graphics;
+
+/**
+ * libgraphics pixel pipeline benchmark. Prints a table of Mpixels/s for every bulk pixel
+ * operation, once per instruction set supported by the CPU. Copies go through memmove and do
+ * not depend on the selected instruction set.
+ */
+
+static constexpr u32 kWidth      = 1024;
+static constexpr u32 kHeight     = 768;
+static constexpr u32 kIndexedW   = 320;
+static constexpr u32 kIndexedH   = 200;
+static constexpr size_t kRepeats = 32;
+static constexpr u32 kFillColor  = 0x00123456;  // Not a repeating byte, which is a memset
+static constexpr u8 kBlendAlpha  = 128;
+
+static constexpr const char *kIsas[] = {"scalar", "sse2", "avx2"};
+
+static NativePixel g_src[kWidth * kHeight];
+static NativePixel g_dest[kWidth * kHeight];
+static u8 g_indexed[kIndexedW * kIndexedH];
+static NativePixel g_palette[256];
+
+static u64 NowNs()
+{
+    /* Precise process time is reported in nanoseconds */
+    return GetClockValueSysCall(kProcTimePrecise).remainder;
+}
+
+template <typename Fn>
+static u64 MeasureMpixels(const u64 pixels, Fn fn)
+{
+    const u64 start = NowNs();
+    for (size_t i = 0; i < kRepeats; ++i) {
+        fn();
+    }
+    const u64 end = NowNs();
+
+    /* Pixels per ns * 1000 */
+    return end == start ? 0 : pixels * kRepeats * 1000 / (end - start);
+}
+
+extern "C" int main()
+{
+    for (u32 i = 0; i < kWidth * kHeight; ++i) {
+        g_src[i]  = NativePixel(i * 0x9E3779B9U);
+        g_dest[i] = NativePixel(i);
+    }
+    for (u32 i = 0; i < kIndexedW * kIndexedH; ++i) {
+        g_indexed[i] = static_cast<u8>(i * 7);
+    }
+    for (u32 i = 0; i < 256; ++i) {
+        g_palette[i] = NativePixel(i * 0x010101U);
+    }
+
+    Surface src(g_src, kWidth, kHeight, kWidth * sizeof(NativePixel));
+    Surface dest(g_dest, kWidth, kHeight, kWidth * sizeof(NativePixel));
+    const Rect full{0, 0, static_cast<i32>(kWidth), static_cast<i32>(kHeight)};
+    const u64 full_pixels = static_cast<u64>(kWidth) * kHeight;
+
+    printf(
+        "%8s %10s %10s %10s %10s %10s %10s\n", "isa", "fill", "copy", "blend", "expand1x",
+        "expand2x", "expand3x"
+    );
+    for (u32 isa = 0; isa < sizeof(kIsas) / sizeof(kIsas[0]); ++isa) {
+        if (SetPixelOpsIsa(static_cast<PixelOpsIsa>(isa)) != static_cast<PixelOpsIsa>(isa)) {
+            break;
+        }
+
+        const u64 fill = MeasureMpixels(full_pixels, [&dest]() {
+            FillPixels({dest.GetRawBuffer(), kWidth * kHeight}, NativePixel(kFillColor));
+        });
+        const u64 copy = MeasureMpixels(full_pixels, [&]() {
+            CopyRect(dest, {0, 0}, src, full);
+        });
+        const u64 blend = MeasureMpixels(full_pixels, [&]() {
+            BlendRect(dest, {0, 0}, src, full, kBlendAlpha);
+        });
+
+        u64 expand[3];
+        for (u32 scale = 1; scale <= 3; ++scale) {
+            const u64 pixels  = static_cast<u64>(kIndexedW * scale) * kIndexedH * scale;
+            expand[scale - 1] = MeasureMpixels(pixels, [&dest, scale]() {
+                ExpandIndexed(
+                    dest, {0, 0}, g_indexed, kIndexedW, kIndexedH, kIndexedW, g_palette, scale
+                );
+            });
+        }
+
+        printf(
+            "%8s %10llu %10llu %10llu %10llu %10llu %10llu\n", kIsas[isa],
+            static_cast<unsigned long long>(fill), static_cast<unsigned long long>(copy),
+            static_cast<unsigned long long>(blend), static_cast<unsigned long long>(expand[0]),
+            static_cast<unsigned long long>(expand[1]), static_cast<unsigned long long>(expand[2])
+        );
+    }
+    printf("(Mpixels/s)\n");
+
+    return 0;
+}
@@ -2,7 +2,6 @@
 // Copyright (c) 2025-2026 The AlkOS Authors
 // See the AUTHORS file for the full list of contributors.
 
-#include <alkos/sys/thread.h>
 #include <alkos/video.h>
 #include <platform.h>
 #include <stdio.h>
@@ -21,6 +20,16 @@ extern "C" int main()
         return 1;
     }
 
+    // Share the screen with the shell, the gradient takes the right half
+    GuiRect frame = {
+        static_cast<u32>(info.width / 2), 0, static_cast<u32>(info.width - info.width / 2),
+        static_cast<u32>(info.height)
+    };
+    if (__platform_set_graphic_session_frame(&frame) == 0) {
+        info.width  = frame.width;
+        info.height = frame.height;
+    }
+
     u32 *fb = static_cast<u32 *>(info.buffer_ptr);
 
     u32 t = static_cast<u32>(time(NULL));
@@ -55,11 +64,12 @@ extern "C" int main()
         }
 
         // Blit to screen
-        __platform_blit();
+        __platform_blit(nullptr, 0);
 
         color_offset += 1;
 
-        NanoSleep(16'000'000);
+        // Paced by the display, slower while the session is in the background
+        __platform_wait_frame(nullptr);
     }
 
     return 0;
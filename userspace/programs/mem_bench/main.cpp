@@ -0,0 +1,77 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025-2026 The AlkOS Authors
+// See the AUTHORS file for the full list of contributors.
+
+#include <stdio.h>
+#include <string.h>
+#include <alkos/sys/time.h>
+
+/**
+ * mem* benchmark. Prints a table of ns per call for memcpy, memmove, memset and memcmp over
+ * sizes spanning every tier: small scalar moves, vector loops and rep string instructions.
+ */
+
+static constexpr size_t kMaxSize       = 1 << 20;
+static constexpr size_t kBytesPerSize  = 64 << 20;  // Bytes processed per measurement
+static constexpr size_t kMinIterations = 16;
+static constexpr size_t kSizes[]       = {8,    16,    32,    64,     128,    256,     512,
+                                          1024, 2048,  4096,  16384,  65536,  262144,  kMaxSize};
+
+static byte g_src[kMaxSize + 64];
+static byte g_dest[kMaxSize + 64];
+
+static u64 NowNs()
+{
+    /* Precise process time is reported in nanoseconds */
+    return GetClockValueSysCall(kProcTimePrecise).remainder;
+}
+
+template <typename Fn>
+static u64 MeasureNsPerCall(const size_t size, Fn fn)
+{
+    const size_t iterations = kBytesPerSize / size > kMinIterations ? kBytesPerSize / size
+                                                                    : kMinIterations;
+
+    const u64 start = NowNs();
+    for (size_t i = 0; i < iterations; ++i) {
+        fn(size);
+    }
+    const u64 end = NowNs();
+
+    return (end - start) / iterations;
+}
+
+extern "C" int main()
+{
+    memset(g_src, 0x5A, sizeof(g_src));
+    memset(g_dest, 0x5A, sizeof(g_dest));
+
+    /* Keep the results observable so the calls are not optimized away */
+    volatile int sink = 0;
+
+    printf("%10s %10s %10s %10s %10s\n", "size", "memcpy", "memmove", "memset", "memcmp");
+    for (const size_t size : kSizes) {
+        const u64 copy_ns = MeasureNsPerCall(size, [](const size_t n) {
+            memcpy(g_dest, g_src, n);
+        });
+        const u64 move_ns = MeasureNsPerCall(size, [](const size_t n) {
+            memmove(g_src + 1, g_src, n);
+        });
+        const u64 set_ns = MeasureNsPerCall(size, [](const size_t n) {
+            memset(g_dest, static_cast<int>(n), n);
+        });
+        memcpy(g_dest, g_src, size);
+        const u64 cmp_ns = MeasureNsPerCall(size, [&sink](const size_t n) {
+            sink = sink + memcmp(g_dest, g_src, n);
+        });
+
+        printf(
+            "%10zu %10llu %10llu %10llu %10llu\n", size, static_cast<unsigned long long>(copy_ns),
+            static_cast<unsigned long long>(move_ns), static_cast<unsigned long long>(set_ns),
+            static_cast<unsigned long long>(cmp_ns)
+        );
+    }
+    printf("(ns per call)\n");
+
+    return 0;
+}
@@ -4,19 +4,49 @@
 
 #include "graphics_console.hpp"
 
+#include <stdlib.h>
 #include <string.h>
 #include <types.h>
 #include <algorithm.hpp>
 
+#include <alkos/sys/video.h>
+#include <assert.h>
+#include <pixel_ops.hpp>
+
 namespace System
 {
 
-GraphicsConsole::GraphicsConsole(Graphics::Painter &painter, const Graphics::Psf2Font &font)
-    : painter_(painter), font_(font)
+namespace
+{
+
+// Lines kept above the live screen
+constexpr u64 kScrollbackLines = 512;
+
+// Auto-scale based on resolution
+u8 SelectScale(Graphics::Painter &painter)
 {
-    // Auto-scale based on resolution
-    scale_ = static_cast<u8>(std::max(1u, painter_.GetTarget().GetWidth() / 400));
+    return static_cast<u8>(std::max(1u, painter.GetTarget().GetWidth() / 400));
+}
+
+std::span<Graphics::NativePixel> AllocateAtlas(const Graphics::Psf2Font &font, const u8 scale)
+{
+    const size_t pixels = Graphics::GlyphAtlas::GetRequiredPixels(font, scale);
+    void *storage       = malloc(pixels * sizeof(Graphics::NativePixel));
+    if (storage == nullptr) {
+        return {};
+    }
+    return {static_cast<Graphics::NativePixel *>(storage), pixels};
+}
+
+}  // namespace
 
+GraphicsConsole::GraphicsConsole(Graphics::Painter &painter, const Graphics::Psf2Font &font)
+    : painter_(painter),
+      font_(font),
+      scale_(SelectScale(painter)),
+      atlas_storage_(AllocateAtlas(font, scale_)),
+      atlas_(font, painter.GetFormat(), scale_, atlas_storage_)
+{
     glyph_w_ = font_.GetWidth() * scale_;
     glyph_h_ = font_.GetHeight() * scale_;
 
@@ -24,9 +54,22 @@ GraphicsConsole::GraphicsConsole(Graphics::Painter &painter, const Graphics::Psf
     max_cols_ = painter_.GetTarget().GetWidth() / glyph_w_;
     max_rows_ = painter_.GetTarget().GetHeight() / glyph_h_;
 
+    line_capacity_ = max_rows_ + kScrollbackLines;
+    cells_         = static_cast<Cell *>(malloc(line_capacity_ * max_cols_ * sizeof(Cell)));
+    dirty_         = static_cast<DirtySpan *>(malloc(line_capacity_ * sizeof(DirtySpan)));
+    R_ASSERT_NOT_NULL(cells_);
+    R_ASSERT_NOT_NULL(dirty_);
+
     Clear();
 }
 
+GraphicsConsole::~GraphicsConsole()
+{
+    free(atlas_storage_.data());
+    free(cells_);
+    free(dirty_);
+}
+
 void GraphicsConsole::SetColors(Graphics::Color fg, Graphics::Color bg)
 {
     fg_color_ = fg;
@@ -35,46 +78,158 @@ void GraphicsConsole::SetColors(Graphics::Color fg, Graphics::Color bg)
 
 void GraphicsConsole::Clear()
 {
+    // The cleared text stays in the scrollback
+    screen_top_ += cursor_y_ + (cursor_x_ > 0 ? 1 : 0);
+    view_top_    = screen_top_;
+    painted_top_ = screen_top_;
+    cursor_x_    = 0;
+    cursor_y_    = 0;
+
+    // Cleared lines match the surface after the fill, nothing to draw
     painter_.Clear(bg_color_);
-    cursor_x_ = 0;
-    cursor_y_ = 0;
+    for (u32 row = 0; row < max_rows_; ++row) {
+        ResetLine(screen_top_ + row);
+        GetDirty(screen_top_ + row) = {max_cols_, 0};
+    }
 }
 
-void GraphicsConsole::ScrollUp()
+void GraphicsConsole::Flush()
 {
-    // Scroll by one line height
-    auto &surface      = painter_.GetTarget();
-    u32 pitch          = surface.GetPitch();
-    u32 bytes_per_line = pitch * glyph_h_;
-    u32 total_height   = surface.GetHeight();
+    MoveScreen(static_cast<i64>(view_top_ - painted_top_));
 
-    u8 *raw_buf = reinterpret_cast<u8 *>(surface.GetRawBuffer());
+    for (u32 row = 0; row < max_rows_; ++row) {
+        const u64 line   = view_top_ + row;
+        DirtySpan &dirty = GetDirty(line);
+        if (dirty.begin < dirty.end) {
+            DrawLine(row, line, dirty.begin, dirty.end);
+        }
+        dirty = {max_cols_, 0};
+    }
 
-    // Move memory up
-    // Dest: Start of buffer
-    // Src: Start of buffer + one line of pixels
-    // Size: Total size - one line of pixels
-    memmove(
-        raw_buf, raw_buf + bytes_per_line, static_cast<size_t>(pitch * (total_height - glyph_h_))
-    );
+    BlitDamage(painter_.GetDamage());
+    painter_.ClearDamage();
+}
+
+void GraphicsConsole::ScrollView(const i32 lines)
+{
+    if (lines > 0) {
+        view_top_ -= std::min(static_cast<u64>(lines), view_top_ - GetOldestLine());
+    } else {
+        view_top_ += std::min(static_cast<u64>(-static_cast<i64>(lines)), screen_top_ - view_top_);
+    }
+}
 
-    // Clear bottom area using the painter to ensure correct color format
-    painter_.SetColor(bg_color_);
-    painter_.FillRect(
-        {0, static_cast<i32>(total_height - glyph_h_), static_cast<i32>(surface.GetWidth()),
-         static_cast<i32>(glyph_h_)}
-    );
+u64 GraphicsConsole::GetOldestLine() const
+{
+    const u64 lines = screen_top_ + max_rows_;
+    return lines > line_capacity_ ? lines - line_capacity_ : 0;
+}
+
+void GraphicsConsole::ResetLine(const u64 line)
+{
+    Cell *cells = GetLine(line);
+    for (u32 col = 0; col < max_cols_; ++col) {
+        cells[col] = {' ', fg_color_, bg_color_};
+    }
+    GetDirty(line) = {0, max_cols_};
+}
+
+void GraphicsConsole::SetCell(const u32 col, const Cell cell)
+{
+    const u64 line = screen_top_ + cursor_y_;
+    Cell &current  = GetLine(line)[col];
+    if (current == cell) {
+        return;
+    }
+
+    current          = cell;
+    DirtySpan &dirty = GetDirty(line);
+    dirty.begin      = std::min(dirty.begin, col);
+    dirty.end        = std::max(dirty.end, col + 1);
 }
 
 void GraphicsConsole::NewLine()
 {
     cursor_x_ = 0;
-    cursor_y_++;
 
-    if (cursor_y_ >= max_rows_) {
-        cursor_y_ = max_rows_ - 1;
-        ScrollUp();
+    if (cursor_y_ + 1 < max_rows_) {
+        cursor_y_++;
+        return;
     }
+
+    // Only the ring moves here, the surface follows once on flush
+    screen_top_++;
+    ResetLine(screen_top_ + max_rows_ - 1);
+}
+
+void GraphicsConsole::MoveScreen(const i64 lines)
+{
+    if (lines == 0) {
+        return;
+    }
+
+    const u64 distance = static_cast<u64>(lines > 0 ? lines : -lines);
+    painted_top_       = view_top_;
+
+    if (distance >= max_rows_) {
+        for (u32 row = 0; row < max_rows_; ++row) {
+            GetDirty(view_top_ + row) = {0, max_cols_};
+        }
+        return;
+    }
+
+    // Keep the rows still in view, draw only the exposed ones
+    const u32 kept   = max_rows_ - static_cast<u32>(distance);
+    const i32 offset = static_cast<i32>(distance * glyph_h_);
+    auto &surface    = painter_.GetTarget();
+
+    const Graphics::Rect src{
+        0, lines > 0 ? offset : 0, static_cast<i32>(max_cols_ * glyph_w_),
+        static_cast<i32>(kept * glyph_h_)
+    };
+    painter_.AddDamage(Graphics::CopyRect(surface, {0, lines > 0 ? 0 : offset}, surface, src));
+
+    const u32 exposed_begin = lines > 0 ? kept : 0;
+    for (u32 row = exposed_begin; row < exposed_begin + distance; ++row) {
+        GetDirty(view_top_ + row) = {0, max_cols_};
+    }
+}
+
+void GraphicsConsole::DrawLine(const u32 row, const u64 line, const u32 begin, const u32 end)
+{
+    const Cell *cells = GetLine(line);
+    for (u32 col = begin; col < end; ++col) {
+        DrawCell(row, col, cells[col]);
+    }
+}
+
+void GraphicsConsole::DrawCell(const u32 row, const u32 col, const Cell &cell)
+{
+    Graphics::CharCmd cmd{
+        .x     = static_cast<i32>(col * glyph_w_),
+        .y     = static_cast<i32>(row * glyph_h_),
+        .c     = cell.c,
+        .scale = scale_
+    };
+
+    // Atlas tiles carry their background, a tile is rasterized again only for another color pair
+    if (atlas_.IsValid()) {
+        atlas_.SetColors(cell.fg, cell.bg);
+        painter_.DrawChar(cmd, atlas_);
+    } else {
+        DrawCharFromFont(cmd, cell);
+    }
+}
+
+void GraphicsConsole::DrawCharFromFont(const Graphics::CharCmd &cmd, const Cell &cell)
+{
+    // Clear background for char
+    painter_.SetColor(cell.bg);
+    painter_.FillRect({cmd.x, cmd.y, static_cast<i32>(glyph_w_), static_cast<i32>(glyph_h_)});
+
+    // Draw foreground
+    painter_.SetColor(cell.fg);
+    painter_.DrawChar(cmd, font_);
 }
 
 void GraphicsConsole::InternalPutChar(char c)
@@ -92,31 +247,12 @@ void GraphicsConsole::InternalPutChar(char c)
     if (c == '\b') {
         if (cursor_x_ > 0) {
             cursor_x_--;
-            // Erase char
-            painter_.SetColor(bg_color_);
-            painter_.FillRect(
-                {static_cast<i32>(cursor_x_ * glyph_w_), static_cast<i32>(cursor_y_ * glyph_h_),
-                 static_cast<i32>(glyph_w_), static_cast<i32>(glyph_h_)}
-            );
+            SetCell(cursor_x_, {' ', fg_color_, bg_color_});
         }
         return;
     }
 
-    // Draw the character
-    Graphics::CharCmd cmd{
-        .x     = static_cast<i32>(cursor_x_ * glyph_w_),
-        .y     = static_cast<i32>(cursor_y_ * glyph_h_),
-        .c     = c,
-        .scale = scale_
-    };
-
-    // Clear background for char
-    painter_.SetColor(bg_color_);
-    painter_.FillRect({cmd.x, cmd.y, static_cast<i32>(glyph_w_), static_cast<i32>(glyph_h_)});
-
-    // Draw foreground
-    painter_.SetColor(fg_color_);
-    painter_.DrawChar(cmd, font_);
+    SetCell(cursor_x_, {c, fg_color_, bg_color_});
 
     cursor_x_++;
     if (cursor_x_ >= max_cols_) {
@@ -129,6 +265,9 @@ IO::IoResult GraphicsConsole::Write(std::span<const byte> buffer)
     for (const auto &b : buffer) {
         InternalPutChar(static_cast<char>(b));
     }
+
+    // New output brings the view back to the live screen
+    view_top_ = screen_top_;
     return buffer.size();
 }
 
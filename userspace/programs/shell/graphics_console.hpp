@@ -7,6 +7,7 @@
 
 #include <color.hpp>
 #include <font/psf2_font.hpp>
+#include <glyph_atlas.hpp>
 #include <span.hpp>
 
 #include "painter.hpp"
@@ -23,6 +24,10 @@ class GraphicsConsole : public IO::IWriter
 {
     public:
     GraphicsConsole(Graphics::Painter &painter, const Graphics::Psf2Font &font);
+    ~GraphicsConsole() override;
+
+    GraphicsConsole(const GraphicsConsole &)            = delete;
+    GraphicsConsole &operator=(const GraphicsConsole &) = delete;
 
     // -------------------------------------------------------------------------
     // IWriter Interface
@@ -36,6 +41,24 @@ class GraphicsConsole : public IO::IWriter
 
     void Clear();
 
+    /**
+     * @brief Draw the cells changed since the last flush and copy them to the screen.
+     * All scrolling done in between is applied as a single move of the screen contents.
+     */
+    void Flush();
+
+    // -------------------------------------------------------------------------
+    // Scrollback
+    // -------------------------------------------------------------------------
+
+    /**
+     * @brief Move the view by the given number of lines, positive values go back in history.
+     * The view is clamped to the stored history and returns to the bottom on the next write.
+     */
+    void ScrollView(i32 lines);
+
+    NODISCARD u32 GetRows() const { return max_rows_; }
+
     // -------------------------------------------------------------------------
     // Configuration
     // -------------------------------------------------------------------------
@@ -47,9 +70,33 @@ class GraphicsConsole : public IO::IWriter
     // Internal Helpers
     // -------------------------------------------------------------------------
 
+    struct Cell {
+        char c;
+        Graphics::Color fg;
+        Graphics::Color bg;
+
+        bool operator==(const Cell &) const = default;
+    };
+
+    /// Columns of a line changed since it was last drawn, [begin, end)
+    struct DirtySpan {
+        u32 begin;
+        u32 end;
+    };
+
     void InternalPutChar(char c);
+    void SetCell(u32 col, Cell cell);
     void NewLine();
-    void ScrollUp();
+    void ResetLine(u64 line);
+
+    NODISCARD Cell *GetLine(u64 line) { return cells_ + (line % line_capacity_) * max_cols_; }
+    NODISCARD DirtySpan &GetDirty(u64 line) { return dirty_[line % line_capacity_]; }
+    NODISCARD u64 GetOldestLine() const;
+
+    void MoveScreen(i64 lines);
+    void DrawLine(u32 row, u64 line, u32 begin, u32 end);
+    void DrawCell(u32 row, u32 col, const Cell &cell);
+    void DrawCharFromFont(const Graphics::CharCmd &cmd, const Cell &cell);
 
     Graphics::Painter &painter_;
     const Graphics::Psf2Font &font_;
@@ -58,6 +105,16 @@ class GraphicsConsole : public IO::IWriter
     u32 cursor_x_{0};
     u32 cursor_y_{0};
 
+    // Ring of lines, line n is stored at n % line_capacity_. The live screen starts at
+    // screen_top_, the view may be moved back into history. painted_top_ is the line at the
+    // top of the surface, the surface is moved to the view on flush.
+    Cell *cells_{nullptr};
+    DirtySpan *dirty_{nullptr};
+    u64 line_capacity_{0};
+    u64 screen_top_{0};
+    u64 view_top_{0};
+    u64 painted_top_{0};
+
     // Cache dimensions
     u32 max_cols_{0};
     u32 max_rows_{0};
@@ -67,6 +124,10 @@ class GraphicsConsole : public IO::IWriter
 
     Graphics::Color fg_color_{Graphics::Color::White()};
     Graphics::Color bg_color_{Graphics::Color::Black()};
+
+    // Rasterized glyphs, characters are drawn from the font directly if allocation failed
+    std::span<Graphics::NativePixel> atlas_storage_;
+    Graphics::GlyphAtlas atlas_;
 };
 
 }  // namespace System
@@ -22,11 +22,11 @@ extern "C" int main()
     System::Shell shell(console);
 
     shell.Init();
-    Blit();
+    console.Flush();
 
     while (true) {
         shell.Update();
-        Blit();
+        console.Flush();
 
         NanoSleep(16'000'000);
     }
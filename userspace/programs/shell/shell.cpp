@@ -9,6 +9,7 @@
 #include <string.hpp>
 
 #include <alkos/calls.h>
+#include <alkos/sys/input.h>
 #include <autogen/version.hpp>
 
 static u64 ParsePid(const std::string_view str)
@@ -77,6 +78,8 @@ void Shell::PrintPrompt()
 
 void Shell::Update()
 {
+    UpdateScrollback();
+
     char c;
     auto read = fread(&c, 1, 1, stdin);
     if (read != 1) {
@@ -85,6 +88,26 @@ void Shell::Update()
     OnInput(c);
 }
 
+void Shell::UpdateScrollback()
+{
+    // Half a screen per key press, held keys repeat
+    const i32 lines = static_cast<i32>(console_.GetRows() / 2);
+
+    InputEvent events[kMaxInputEvents];
+    const int count = ReadInputEvents(events, kMaxInputEvents, 0);
+    for (int i = 0; i < count; ++i) {
+        if (!events[i].pressed) {
+            continue;
+        }
+
+        if (events[i].key == VK_PageUp) {
+            console_.ScrollView(lines);
+        } else if (events[i].key == VK_PageDown) {
+            console_.ScrollView(-lines);
+        }
+    }
+}
+
 void Shell::OnInput(char c)
 {
     // Handle Special Keys
@@ -73,12 +73,19 @@ class Shell
 
     void OnInput(char c);
 
+    /**
+     * @brief Move the console view through the history on PageUp/PageDown
+     */
+    void UpdateScrollback();
+
     // Data
     GraphicsConsole &console_;
     Path current_dir_{Path::kRoot};
 
     static constexpr size_t kMaxInput = 128;
     data_structures::StaticVector<char, kMaxInput> input_buffer_;
+
+    static constexpr size_t kMaxInputEvents = 16;
 };
 
 }  // namespace System
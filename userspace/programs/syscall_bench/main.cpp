@@ -0,0 +1,66 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2025-2026 The AlkOS Authors
+// See the AUTHORS file for the full list of contributors.
+
+#include <stdio.h>
+#include <alkos/sys/time.h>
+#include <alkos/syscall.h>
+
+/**
+ * Null syscall microbenchmark. Issues kSysNop, which goes through the entry bookkeeping and the
+ * dispatch table but does no work, so the measured time is the cost of entering and leaving
+ * the kernel through each mechanism.
+ */
+
+static constexpr size_t kIterations  = 1'000'000;
+static constexpr size_t kWarmup      = 10'000;
+static constexpr size_t kNullSyscall = kSysNop;
+
+static size_t NullSyscallInt80()
+{
+    size_t ret;
+    __asm__ volatile("int $0x80" : "=a"(ret) : "0"(kNullSyscall) : "memory", "cc");
+    return ret;
+}
+
+static size_t NullSyscallFast()
+{
+    size_t ret;
+    __asm__ volatile("syscall" : "=a"(ret) : "0"(kNullSyscall) : "rcx", "r11", "memory", "cc");
+    return ret;
+}
+
+static u64 NowNs()
+{
+    /* Precise process time is reported in nanoseconds */
+    return GetClockValueSysCall(kProcTimePrecise).remainder;
+}
+
+template <typename Fn>
+static u64 MeasureNsPerCall(Fn fn)
+{
+    for (size_t i = 0; i < kWarmup; ++i) {
+        fn();
+    }
+
+    const u64 start = NowNs();
+    for (size_t i = 0; i < kIterations; ++i) {
+        fn();
+    }
+    const u64 end = NowNs();
+
+    return (end - start) / kIterations;
+}
+
+extern "C" int main()
+{
+    printf("Null syscall benchmark, %zu iterations per path\n", kIterations);
+
+    const u64 int80_ns = MeasureNsPerCall(NullSyscallInt80);
+    const u64 fast_ns  = MeasureNsPerCall(NullSyscallFast);
+
+    printf("  int 0x80:        %llu ns/call\n", static_cast<unsigned long long>(int80_ns));
+    printf("  syscall/sysret:  %llu ns/call\n", static_cast<unsigned long long>(fast_ns));
+
+    return 0;
+}